@@ -33,6 +33,9 @@ namespace iroha {
           expected::Result<std::unique_ptr<shared_model::interface::Block>,
                            GetBlockError>;
 
+      using SerializedBlockResult =
+          expected::Result<std::string, GetBlockError>;
+
       virtual ~BlockQuery() = default;
 
       /**
@@ -43,6 +46,15 @@ namespace iroha {
       virtual BlockResult getBlock(
           shared_model::interface::types::HeightType height) = 0;
 
+      /**
+       * Retrieve serialized Block_v1 of the block with given height without
+       * building the block, if block storage keeps the blobs
+       * @param height - height of a block to retrieve
+       * @return bytes of the block with given height
+       */
+      virtual SerializedBlockResult getSerializedBlock(
+          shared_model::interface::types::HeightType height) = 0;
+
       /**
        * Get height of the top block.
        * @return height
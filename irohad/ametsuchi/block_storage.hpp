@@ -9,9 +9,11 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -21,6 +23,16 @@ namespace iroha {
      */
     class BlockStorage {
      public:
+      /// Location of a transaction in a stored block
+      struct TxLocation {
+        /// number of the transaction in the block
+        size_t index;
+        /// offset of the serialized transaction in the block blob
+        uint64_t offset;
+        /// size of the serialized transaction, 0 if it is not known
+        uint32_t size;
+      };
+
       /**
        * Append block, if the storage doesn't already contain the same block
        * @return true if inserted successfully, false otherwise
@@ -35,6 +47,28 @@ namespace iroha {
       virtual boost::optional<std::unique_ptr<shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const = 0;
 
+      /**
+       * Get the serialized Block_v1 of the block with given height. Storages,
+       * which keep the block blobs, return them without parsing
+       * @return bytes of the block if exists, boost::none otherwise
+       */
+      virtual boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const = 0;
+
+      /**
+       * Get the transactions of the block with given height. Storages, which
+       * keep the block blobs, read only the bytes of the transactions if all
+       * their sizes are known
+       * @param height - height of the block
+       * @param locations - locations of the transactions in the block
+       * @return transactions in the order of locations if the block and all
+       * of them exist, boost::none otherwise
+       */
+      virtual boost::optional<
+          std::vector<std::unique_ptr<shared_model::interface::Transaction>>>
+      fetchTransactions(shared_model::interface::types::HeightType height,
+                        const std::vector<TxLocation> &locations) const = 0;
+
       /**
        * Returns the size of the storage
        */
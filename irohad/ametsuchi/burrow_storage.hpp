@@ -41,6 +41,9 @@ namespace iroha {
           std::string_view address,
           std::string_view data,
           std::vector<std::string_view> topics) = 0;
+
+      /// Persist the changes buffered during the engine call.
+      virtual expected::Result<void, std::string> flush() = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
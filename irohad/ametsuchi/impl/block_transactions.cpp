@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_transactions.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include "backend/protobuf/transaction.hpp"
+#include "block.pb.h"
+#include "common/cloneable.hpp"
+
+using namespace iroha::ametsuchi;
+using google::protobuf::internal::WireFormatLite;
+using shared_model::interface::types::ByteRange;
+
+namespace {
+  /**
+   * Iterate through the length delimited fields with given number of the
+   * serialized message, skipping the other fields
+   * @param function - called with offset and size of each field value
+   * @return false if the message is malformed
+   */
+  template <typename Function>
+  bool forEachEmbedded(ByteRange message, int field_number, Function function) {
+    google::protobuf::io::CodedInputStream input(
+        reinterpret_cast<const uint8_t *>(message.data()),
+        static_cast<int>(message.size()));
+    while (auto tag = input.ReadTag()) {
+      if (WireFormatLite::GetTagFieldNumber(tag) == field_number
+          and WireFormatLite::GetTagWireType(tag)
+              == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+        uint32_t length;
+        if (not input.ReadVarint32(&length)) {
+          return false;
+        }
+        auto offset = static_cast<size_t>(input.CurrentPosition());
+        if (offset + length > message.size() or not input.Skip(length)) {
+          return false;
+        }
+        function(offset, length);
+      } else if (not WireFormatLite::SkipField(&input, tag)) {
+        return false;
+      }
+    }
+    return input.ConsumedEntireMessage();
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    boost::optional<std::vector<BlockStorage::TxLocation>> findTransactions(
+        ByteRange block) {
+      if (block.size() > std::numeric_limits<int>::max()) {
+        return boost::none;
+      }
+      boost::optional<ByteRange> payload;
+      if (not forEachEmbedded(
+              block,
+              iroha::protocol::Block_v1::kPayloadFieldNumber,
+              [&](size_t offset, size_t size) {
+                payload = block.substr(offset, size);
+              })
+          or not payload) {
+        return boost::none;
+      }
+
+      const auto payload_offset = payload->data() - block.data();
+      std::vector<BlockStorage::TxLocation> locations;
+      if (not forEachEmbedded(
+              *payload,
+              iroha::protocol::Block_v1::Payload::kTransactionsFieldNumber,
+              [&](size_t offset, size_t size) {
+                locations.push_back(
+                    BlockStorage::TxLocation{locations.size(),
+                                             payload_offset + offset,
+                                             static_cast<uint32_t>(size)});
+              })) {
+        return boost::none;
+      }
+      return locations;
+    }
+
+    std::unique_ptr<shared_model::interface::Transaction> parseTransaction(
+        ByteRange transaction) {
+      iroha::protocol::Transaction proto;
+      if (not proto.ParseFromArray(transaction.data(),
+                                   static_cast<int>(transaction.size()))) {
+        return nullptr;
+      }
+      return std::make_unique<shared_model::proto::Transaction>(
+          std::move(proto));
+    }
+
+    boost::optional<TransactionsType> pickTransactions(
+        const shared_model::interface::Block &block,
+        const std::vector<BlockStorage::TxLocation> &locations) {
+      const auto transactions = block.transactions();
+      TransactionsType result;
+      result.reserve(locations.size());
+      for (const auto &location : locations) {
+        if (location.index >= transactions.size()) {
+          return boost::none;
+        }
+        result.push_back(clone(transactions[location.index]));
+      }
+      return result;
+    }
+
+    bool allSizesKnown(const std::vector<BlockStorage::TxLocation> &locations) {
+      return std::all_of(
+          locations.begin(), locations.end(), [](const auto &location) {
+            return location.size > 0;
+          });
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_BLOCK_TRANSACTIONS_HPP
+#define IROHA_AMETSUCHI_BLOCK_TRANSACTIONS_HPP
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "ametsuchi/block_storage.hpp"
+#include "interfaces/common_objects/byte_range.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    using TransactionsType =
+        std::vector<std::unique_ptr<shared_model::interface::Transaction>>;
+
+    /**
+     * Find the serialized transactions in the serialized block without
+     * parsing them
+     * @param block - serialized iroha::protocol::Block_v1
+     * @return locations of the transactions in the block order, boost::none
+     * if the block is malformed
+     */
+    boost::optional<std::vector<BlockStorage::TxLocation>> findTransactions(
+        shared_model::interface::types::ByteRange block);
+
+    /**
+     * Parse the serialized iroha::protocol::Transaction
+     * @return the transaction, nullptr if the bytes are malformed
+     */
+    std::unique_ptr<shared_model::interface::Transaction> parseTransaction(
+        shared_model::interface::types::ByteRange transaction);
+
+    /**
+     * Copy the transactions from the block by their indices
+     * @return transactions in the order of locations, boost::none if any of
+     * them does not exist
+     */
+    boost::optional<TransactionsType> pickTransactions(
+        const shared_model::interface::Block &block,
+        const std::vector<BlockStorage::TxLocation> &locations);
+
+    /// @return true if the sizes of all the transactions are known
+    bool allSizesKnown(const std::vector<BlockStorage::TxLocation> &locations);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_BLOCK_TRANSACTIONS_HPP
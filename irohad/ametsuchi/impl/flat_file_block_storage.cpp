@@ -7,7 +7,9 @@
 
 #include <boost/filesystem.hpp>
 
+#include "ametsuchi/impl/block_transactions.hpp"
 #include "backend/protobuf/block.hpp"
+#include "common/bind.hpp"
 #include "common/byteutils.hpp"
 #include "logger/logger.hpp"
 
@@ -57,6 +59,23 @@ FlatFileBlockStorage::fetch(
           });
 }
 
+boost::optional<std::string> FlatFileBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  // blocks are stored as JSON, so the block has to be parsed and serialized
+  return fetch(height) | [](const auto &block) {
+    return boost::make_optional(
+        shared_model::crypto::toBinaryString(block->blob()));
+  };
+}
+
+boost::optional<TransactionsType> FlatFileBlockStorage::fetchTransactions(
+    shared_model::interface::types::HeightType height,
+    const std::vector<TxLocation> &locations) const {
+  // blocks are stored as JSON, so the whole block has to be parsed
+  return fetch(height) |
+      [&](const auto &block) { return pickTransactions(*block, locations); };
+}
+
 size_t FlatFileBlockStorage::size() const {
   return flat_file_storage_->blockIdentifiers().size();
 }
@@ -5,6 +5,9 @@
 
 #include "ametsuchi/impl/in_memory_block_storage.hpp"
 
+#include "ametsuchi/impl/block_transactions.hpp"
+#include "cryptography/blob.hpp"
+
 using namespace iroha::ametsuchi;
 
 bool InMemoryBlockStorage::insert(
@@ -24,6 +27,25 @@ InMemoryBlockStorage::fetch(
   }
 }
 
+boost::optional<std::string> InMemoryBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  auto it = block_store_.find(height);
+  if (it == block_store_.end()) {
+    return boost::none;
+  }
+  return shared_model::crypto::toBinaryString(it->second->blob());
+}
+
+boost::optional<TransactionsType> InMemoryBlockStorage::fetchTransactions(
+    shared_model::interface::types::HeightType height,
+    const std::vector<TxLocation> &locations) const {
+  auto it = block_store_.find(height);
+  if (it == block_store_.end()) {
+    return boost::none;
+  }
+  return pickTransactions(*it->second, locations);
+}
+
 size_t InMemoryBlockStorage::size() const {
   return block_store_.size();
 }
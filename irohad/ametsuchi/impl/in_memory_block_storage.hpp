@@ -24,6 +24,15 @@ namespace iroha {
       boost::optional<std::unique_ptr<shared_model::interface::Block>> fetch(
           shared_model::interface::types::HeightType height) const override;
 
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<
+          std::vector<std::unique_ptr<shared_model::interface::Transaction>>>
+      fetchTransactions(
+          shared_model::interface::types::HeightType height,
+          const std::vector<TxLocation> &locations) const override;
+
       size_t size() const override;
 
       void clear() override;
@@ -15,6 +15,7 @@
 #include "ametsuchi/impl/postgres_indexer.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "interfaces/commands/command.hpp"
@@ -31,6 +32,8 @@ namespace iroha {
         logger::LoggerManagerTreePtr log_manager)
         : ledger_state_(std::move(ledger_state)),
           sql_(command_executor->getSession()),
+          command_executor_(command_executor),
+          wsv_cache_(command_executor->getWsvCache()),
           wsv_command_(std::make_unique<PostgresWsvCommand>(sql_)),
           peer_query_(
               std::make_unique<PeerQueryWsv>(std::make_shared<PostgresWsvQuery>(
@@ -44,6 +47,7 @@ namespace iroha {
           committed(false),
           log_(log_manager->getLogger()) {
       sql_ << "BEGIN";
+      wsv_cache_.begin();
     }
 
     bool MutableStorageImpl::apply(
@@ -96,13 +100,16 @@ namespace iroha {
     bool MutableStorageImpl::withSavepoint(Function &&function) {
       try {
         sql_ << "SAVEPOINT savepoint_";
+        wsv_cache_.savepoint("savepoint_");
 
         auto function_executed = std::forward<Function>(function)();
 
         if (function_executed) {
           sql_ << "RELEASE SAVEPOINT savepoint_";
+          wsv_cache_.releaseSavepoint("savepoint_");
         } else {
           sql_ << "ROLLBACK TO SAVEPOINT savepoint_";
+          wsv_cache_.rollbackToSavepoint("savepoint_");
         }
         return function_executed;
       } catch (std::exception &e) {
@@ -145,18 +152,24 @@ namespace iroha {
         assert(ledger_state_);
         return "Tried to commit mutable storage with no blocks applied.";
       }
+      if (auto error = expected::resultToOptionalError(
+              command_executor_->flushWsvCache())) {
+        return expected::makeError(std::move(error).value());
+      }
       try {
         sql_ << "COMMIT";
         committed = true;
       } catch (std::exception &e) {
         return expected::makeError(e.what());
       }
+      wsv_cache_.publish();
       return MutableStorage::CommitResult{ledger_state_.value(),
                                           std::move(block_storage_)};
     }
 
     MutableStorageImpl::~MutableStorageImpl() {
       if (not committed) {
+        wsv_cache_.rollback();
         try {
           sql_ << "ROLLBACK";
         } catch (std::exception &e) {
@@ -22,6 +22,7 @@ namespace iroha {
     class PostgresCommandExecutor;
     class PostgresWsvCommand;
     class TransactionExecutor;
+    class WsvCacheOverlay;
 
     class MutableStorageImpl : public MutableStorage {
       friend class StorageImpl;
@@ -42,7 +43,7 @@ namespace iroha {
                  MutableStoragePredicate predicate) override;
 
       boost::optional<std::shared_ptr<const iroha::LedgerState>>
-      getLedgerState() const;
+      getLedgerState() const override;
 
       expected::Result<CommitResult, std::string> commit() && override;
 
@@ -67,6 +68,8 @@ namespace iroha {
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
 
       soci::session &sql_;
+      std::shared_ptr<PostgresCommandExecutor> command_executor_;
+      WsvCacheOverlay &wsv_cache_;
       std::unique_ptr<PostgresWsvCommand> wsv_command_;
       std::unique_ptr<PeerQuery> peer_query_;
       std::unique_ptr<BlockIndex> block_index_;
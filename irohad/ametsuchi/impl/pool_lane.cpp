@@ -0,0 +1,140 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/pool_lane.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <fmt/format.h>
+#include <soci/soci.h>
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  /// How long the statistics wait for the leases of the lane
+  const std::chrono::milliseconds kStatsLockTimeout{10};
+}  // namespace
+
+PoolLane::PoolLane(std::string name,
+                   std::shared_ptr<soci::connection_pool> pool,
+                   size_t size,
+                   Limits limits)
+    : name_(std::move(name)),
+      pool_(std::move(pool)),
+      size_(size),
+      limits_(std::move(limits)),
+      waiting_(0),
+      leased_(0),
+      rejected_(0),
+      timed_out_(0),
+      total_wait_(Clock::duration::zero()),
+      max_wait_(Clock::duration::zero()) {}
+
+iroha::expected::Result<std::unique_ptr<soci::session>, std::string>
+PoolLane::lease() {
+  const auto started = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    if (limits_.max_waiting and waiting_ >= *limits_.max_waiting) {
+      ++rejected_;
+      return expected::makeError(
+          fmt::format("All {} connections are busy and {} requests are "
+                      "waiting for them.",
+                      name_,
+                      waiting_));
+    }
+    ++waiting_;
+  }
+
+  std::unique_lock<std::timed_mutex> lease_lock(lease_mutex_, std::defer_lock);
+  size_t position;
+  bool found;
+  if (limits_.wait_timeout) {
+    const auto deadline = started + *limits_.wait_timeout;
+    found = lease_lock.try_lock_until(deadline)
+        and pool_->try_lease(
+                position,
+                static_cast<int>(std::max<std::chrono::milliseconds::rep>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        deadline - Clock::now())
+                        .count(),
+                    0)));
+  } else {
+    lease_lock.lock();
+    found = pool_->try_lease(position, -1);
+  }
+  if (not found) {
+    finishWait(started, timed_out_);
+    return expected::makeError(
+        fmt::format("Timed out waiting for a {} connection.", name_));
+  }
+
+  // the session takes the connection which has just been found free, since
+  // nobody else leases from the pool of the lane meanwhile
+  pool_->give_back(position);
+  try {
+    auto session = std::make_unique<soci::session>(*pool_);
+    finishWait(started, leased_);
+    return session;
+  } catch (const std::exception &e) {
+    finishWait(started, timed_out_);
+    return expected::makeError(fmt::format(
+        "Failed to take a {} connection: {}", name_, e.what()));
+  }
+}
+
+void PoolLane::close() {
+  std::lock_guard<std::timed_mutex> lock(lease_mutex_);
+  std::vector<std::unique_ptr<soci::session>> sessions;
+  for (size_t i = 0; i < size_; ++i) {
+    sessions.push_back(std::make_unique<soci::session>(*pool_));
+    sessions.back()->close();
+  }
+}
+
+PoolLaneStats PoolLane::stats() const {
+  // a caller holding the leases waits for a connection, so none is free
+  size_t free = 0;
+  std::unique_lock<std::timed_mutex> lease_lock(lease_mutex_,
+                                                kStatsLockTimeout);
+  if (lease_lock.owns_lock()) {
+    // the free connections are counted by taking them for a moment
+    std::vector<size_t> positions;
+    size_t position;
+    while (positions.size() < size_ and pool_->try_lease(position, 0)) {
+      positions.push_back(position);
+    }
+    for (auto taken : positions) {
+      pool_->give_back(taken);
+    }
+    free = positions.size();
+    lease_lock.unlock();
+  }
+
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  return PoolLaneStats{
+      size_,
+      size_ - free,
+      waiting_,
+      leased_,
+      rejected_,
+      timed_out_,
+      std::chrono::duration_cast<std::chrono::microseconds>(total_wait_),
+      std::chrono::duration_cast<std::chrono::microseconds>(max_wait_)};
+}
+
+const std::string &PoolLane::name() const {
+  return name_;
+}
+
+void PoolLane::finishWait(Clock::time_point started, uint64_t &outcome) {
+  const auto wait = Clock::now() - started;
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  --waiting_;
+  ++outcome;
+  total_wait_ += wait;
+  max_wait_ = std::max(max_wait_, wait);
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POOL_LANE_HPP
+#define IROHA_POOL_LANE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <boost/optional.hpp>
+#include "common/result.hpp"
+
+namespace soci {
+  class connection_pool;
+  class session;
+}  // namespace soci
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Sizes of the database connection lanes. The commit lane serves the
+     * commit of blocks and the other work of the ledger, the validation lane
+     * serves the block, peer and setting queries of the peer itself, and the
+     * query lane serves the queries of the clients. A lane of zero size
+     * shares the connections of the commit lane, and its connections are
+     * leased from the commit lane, so the query limits apply only to a query
+     * lane of nonzero size
+     */
+    struct PoolOptions {
+      size_t commit_connections = 10;
+      size_t validation_connections = 0;
+      size_t query_connections = 0;
+      /// number of client queries which may wait for a connection, the
+      /// others are rejected at once
+      size_t max_waiting_queries = 64;
+      /// the longest wait of a client query for a connection
+      std::chrono::milliseconds query_wait_timeout{1000};
+      /// period of logging the statistics of the lanes, if set
+      boost::optional<std::chrono::milliseconds> stats_period;
+    };
+
+    /**
+     * Statistics of a lane since its creation
+     */
+    struct PoolLaneStats {
+      size_t size;
+      /// connections which are taken at the moment
+      size_t in_use;
+      /// callers which are waiting for a connection at the moment
+      size_t waiting;
+      uint64_t leased;
+      uint64_t rejected;
+      uint64_t timed_out;
+      std::chrono::microseconds total_wait;
+      std::chrono::microseconds max_wait;
+    };
+
+    /**
+     * Connections reserved for one kind of work. At most max_waiting
+     * callers wait for a connection, each at most wait_timeout, and the
+     * others are rejected at once, so that a burst of this work neither piles
+     * up nor takes the connections of the other lanes
+     */
+    class PoolLane {
+     public:
+      /// The waits for a connection are not limited if the limits are not set
+      struct Limits {
+        boost::optional<size_t> max_waiting;
+        boost::optional<std::chrono::milliseconds> wait_timeout;
+      };
+
+      /**
+       * @param pool - connections of the lane, which must be taken only
+       * with lease, otherwise only its occupancy is tracked
+       */
+      PoolLane(std::string name,
+               std::shared_ptr<soci::connection_pool> pool,
+               size_t size,
+               Limits limits);
+
+      /**
+       * Take a connection of the lane
+       * @return session, which returns the connection on destruction, or
+       * error if the lane is saturated or the wait has timed out
+       */
+      expected::Result<std::unique_ptr<soci::session>, std::string> lease();
+
+      /// Close all the connections of the lane, waiting for them to return
+      void close();
+
+      PoolLaneStats stats() const;
+
+      const std::string &name() const;
+
+     private:
+      using Clock = std::chrono::steady_clock;
+
+      /// Account the finished wait of a caller in the statistics
+      void finishWait(Clock::time_point started, uint64_t &outcome);
+
+      const std::string name_;
+      std::shared_ptr<soci::connection_pool> pool_;
+      const size_t size_;
+      const Limits limits_;
+
+      /// serializes the leases, so that the connection which is found free
+      /// is taken by the same caller
+      mutable std::timed_mutex lease_mutex_;
+      mutable std::mutex stats_mutex_;
+      size_t waiting_;
+      uint64_t leased_;
+      uint64_t rejected_;
+      uint64_t timed_out_;
+      Clock::duration total_wait_;
+      Clock::duration max_wait_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POOL_LANE_HPP
@@ -7,6 +7,7 @@
 
 #include <soci/soci.h>
 #include "ametsuchi/impl/failover_callback_holder.hpp"
+#include "ametsuchi/impl/pool_lane.hpp"
 
 using namespace iroha::ametsuchi;
 
@@ -17,3 +18,29 @@ PoolWrapper::PoolWrapper(
     : connection_pool_(std::move(connection_pool)),
       failover_callback_holder_(std::move(failover_callback_holder)),
       enable_prepared_transactions_(enable_prepared_transactions) {}
+
+PoolWrapper::PoolWrapper(
+    std::shared_ptr<soci::connection_pool> connection_pool,
+    std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
+    bool enable_prepared_transactions,
+    std::shared_ptr<PoolLane> commit_lane,
+    std::shared_ptr<PoolLane> validation_lane,
+    std::shared_ptr<PoolLane> query_lane)
+    : connection_pool_(std::move(connection_pool)),
+      failover_callback_holder_(std::move(failover_callback_holder)),
+      enable_prepared_transactions_(enable_prepared_transactions),
+      commit_lane_(std::move(commit_lane)),
+      validation_lane_(std::move(validation_lane)),
+      query_lane_(std::move(query_lane)) {}
+
+PoolWrapper::~PoolWrapper() = default;
+
+std::vector<std::shared_ptr<PoolLane>> PoolWrapper::lanes() const {
+  std::vector<std::shared_ptr<PoolLane>> lanes;
+  for (const auto &lane : {commit_lane_, validation_lane_, query_lane_}) {
+    if (lane) {
+      lanes.push_back(lane);
+    }
+  }
+  return lanes;
+}
@@ -7,6 +7,7 @@
 #define IROHA_POOL_WRAPPER_HPP
 
 #include <memory>
+#include <vector>
 
 namespace soci {
   class connection_pool;
@@ -15,6 +16,7 @@ namespace soci {
 namespace iroha {
   namespace ametsuchi {
     class FailoverCallbackHolder;
+    class PoolLane;
 
     struct PoolWrapper {
       PoolWrapper(
@@ -22,9 +24,32 @@ namespace iroha {
           std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
           bool enable_prepared_transactions);
 
+      /**
+       * @param commit_lane - lane of connection_pool
+       * @param validation_lane - lane of the validation connections or null
+       * if they are taken from connection_pool
+       * @param query_lane - lane of the query connections or null if they
+       * are taken from connection_pool
+       */
+      PoolWrapper(
+          std::shared_ptr<soci::connection_pool> connection_pool,
+          std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
+          bool enable_prepared_transactions,
+          std::shared_ptr<PoolLane> commit_lane,
+          std::shared_ptr<PoolLane> validation_lane,
+          std::shared_ptr<PoolLane> query_lane);
+
+      ~PoolWrapper();
+
+      /// The lanes which are set
+      std::vector<std::shared_ptr<PoolLane>> lanes() const;
+
       std::shared_ptr<soci::connection_pool> connection_pool_;
       std::unique_ptr<FailoverCallbackHolder> failover_callback_holder_;
       bool enable_prepared_transactions_;
+      std::shared_ptr<PoolLane> commit_lane_;
+      std::shared_ptr<PoolLane> validation_lane_;
+      std::shared_ptr<PoolLane> query_lane_;
     };
 
   }  // namespace ametsuchi
@@ -8,6 +8,7 @@
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include "ametsuchi/impl/block_transactions.hpp"
 #include "ametsuchi/tx_cache_response.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/commands/command_variant.hpp"
@@ -73,9 +74,18 @@ PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
   auto height = block.height();
+  // offsets are indexed to read the transactions without the whole block
+  const auto locations = findTransactions(block.blob().range());
+  if (not locations or locations->size() != block.transactions().size()) {
+    log_->warn("Could not locate transactions of block {}", height);
+  }
   for (const auto &tx : block.transactions() | boost::adaptors::indexed(0)) {
     const auto &creator_id = tx.value().creatorAccountId();
-    const TxPosition position{height, static_cast<size_t>(tx.index())};
+    TxPosition position{height, static_cast<size_t>(tx.index())};
+    if (locations and locations->size() == block.transactions().size()) {
+      position.offset = (*locations)[position.index].offset;
+      position.size = (*locations)[position.index].size;
+    }
 
     indexer_->committedTxHash(tx.value().hash());
     makeAccountAssetIndex(creator_id,
@@ -39,6 +39,18 @@ namespace iroha {
       return std::move(*block);
     }
 
+    BlockQuery::SerializedBlockResult PostgresBlockQuery::getSerializedBlock(
+        shared_model::interface::types::HeightType height) {
+      auto block = block_storage_.fetchSerialized(height);
+      if (not block) {
+        auto error =
+            boost::format("Failed to retrieve block with height %d") % height;
+        return expected::makeError(
+            GetBlockError{GetBlockError::Code::kNoBlock, error.str()});
+      }
+      return std::move(*block);
+    }
+
     shared_model::interface::types::HeightType
     PostgresBlockQuery::getTopBlockHeight() {
       return block_storage_.size();
@@ -50,7 +62,8 @@ namespace iroha {
       const auto &hash_str = hash.hex();
 
       try {
-        sql_ << "SELECT status FROM tx_status_by_hash WHERE hash = :hash",
+        sql_ << "SELECT status FROM tx_status_by_hash "
+                "WHERE hash = decode(:hash, 'hex')",
             soci::into(res), soci::use(hash_str);
       } catch (const std::exception &e) {
         log_->error("Failed to execute query: {}", e.what());
@@ -31,6 +31,9 @@ namespace iroha {
       BlockResult getBlock(
           shared_model::interface::types::HeightType height) override;
 
+      SerializedBlockResult getSerializedBlock(
+          shared_model::interface::types::HeightType height) override;
+
       shared_model::interface::types::HeightType getTopBlockHeight() override;
 
       std::optional<TxCacheStatusType> checkTxPresence(
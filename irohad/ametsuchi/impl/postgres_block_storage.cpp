@@ -5,13 +5,45 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
-#include "common/hexutils.hpp"
+#include <soci/postgresql/soci-postgresql.h>
+#include "ametsuchi/impl/block_transactions.hpp"
+#include "common/bind.hpp"
 #include "logger/logger.hpp"
 
 using namespace iroha::ametsuchi;
 
 using shared_model::interface::types::HeightType;
 
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  /**
+   * Execute a statement with libpq directly, since soci exchanges all the
+   * values in text format. Block bytes are passed and received in binary
+   * format to avoid both escaping and copying.
+   * @param params - statement parameters
+   * @param lengths - lengths of binary parameters, ignored for text ones
+   * @param formats - 0 for text parameters, 1 for binary ones
+   */
+  PgResultPtr execBinary(soci::session &sql,
+                         const std::string &query,
+                         const std::vector<const char *> &params,
+                         const std::vector<int> &lengths,
+                         const std::vector<int> &formats) {
+    auto *backend =
+        static_cast<soci::postgresql_session_backend *>(sql.get_backend());
+    return PgResultPtr{PQexecParams(backend->conn_,
+                                    query.c_str(),
+                                    static_cast<int>(params.size()),
+                                    nullptr,
+                                    params.data(),
+                                    lengths.data(),
+                                    formats.data(),
+                                    1),
+                       &PQclear};
+  }
+}  // namespace
+
 PostgresBlockStorage::PostgresBlockStorage(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<BlockTransportFactory> block_factory,
@@ -36,65 +68,142 @@ bool PostgresBlockStorage::insert(
     return false;
   }
 
-  auto b = block->blob().hex();
+  const auto &bytes = block->blob().blob();
+  const auto height = std::to_string(inserted_height);
 
   soci::session sql(*pool_wrapper_->connection_pool_);
-  soci::statement st = (sql.prepare << "INSERT INTO " << table_
-                                    << " (height, block_data) VALUES(:height, "
-                                       ":block_data)",
-                        soci::use(inserted_height),
-                        soci::use(b));
-  log_->debug("insert block {}: {}", inserted_height, b);
-  try {
-    st.execute(true);
-    return true;
-  } catch (const std::exception &e) {
-    log_->warn(
-        "Failed to insert block {}, reason {}", inserted_height, e.what());
+  log_->debug("insert block {}: {} bytes", inserted_height, bytes.size());
+  auto result = execBinary(
+      sql,
+      "INSERT INTO " + table_ + " (height, block_data) VALUES($1, $2)",
+      {height.c_str(), reinterpret_cast<const char *>(bytes.data())},
+      {0, static_cast<int>(bytes.size())},
+      {0, 1});
+  if (PQresultStatus(result.get()) != PGRES_COMMAND_OK) {
+    log_->warn("Failed to insert block {}, reason {}",
+               inserted_height,
+               PQresultErrorMessage(result.get()));
     return false;
   }
+  return true;
 }
 
 boost::optional<std::unique_ptr<shared_model::interface::Block>>
 PostgresBlockStorage::fetch(
     shared_model::interface::types::HeightType height) const {
+  auto serialized = fetchSerialized(height);
+  if (not serialized) {
+    return boost::none;
+  }
+
+  log_->debug("fetched block {}: {} bytes", height, serialized->size());
+  iroha::protocol::Block block;
+  if (not block.mutable_block_v1()->ParseFromString(*serialized)) {
+    log_->error("Could not parse block at height {}", height);
+    return boost::none;
+  }
+  // the bytes may be large, so release them before building the block
+  serialized = boost::none;
+
+  return block_factory_->createBlock(std::move(block))
+      .match(
+          [&](auto &&v) {
+            return boost::make_optional(
+                std::unique_ptr<shared_model::interface::Block>(
+                    std::move(v.value)));
+          },
+          [&](const auto &e)
+              -> boost::optional<
+                  std::unique_ptr<shared_model::interface::Block>> {
+            log_->error(
+                "Could not build block at height {}: {}", height, e.error);
+            return boost::none;
+          });
+}
+
+boost::optional<std::string> PostgresBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  const auto height_str = std::to_string(height);
+
   soci::session sql(*pool_wrapper_->connection_pool_);
-  using QueryTuple = boost::tuple<boost::optional<std::string>>;
-  QueryTuple row;
-  try {
-    sql << "SELECT block_data FROM " << table_ << " WHERE height = :height",
-        soci::use(height), soci::into(row);
-  } catch (const std::exception &e) {
-    log_->error("Failed to execute query: {}", e.what());
+  auto result = execBinary(
+      sql,
+      "SELECT block_data FROM " + table_ + " WHERE height = $1",
+      {height_str.c_str()},
+      {0},
+      {0});
+  if (PQresultStatus(result.get()) != PGRES_TUPLES_OK) {
+    log_->error("Failed to execute query: {}",
+                PQresultErrorMessage(result.get()));
     return boost::none;
   }
-  return rebind(viewQuery<QueryTuple>(row)) | [&, this](auto row) {
-    return iroha::ametsuchi::apply(row, [&, this](auto &block_data) {
-      log_->debug("fetched: {}", block_data);
-      return iroha::hexstringToBytestring(block_data) |
-          [&, this](auto byte_block) {
-            iroha::protocol::Block_v1 b1;
-            b1.ParseFromString(byte_block);
-            iroha::protocol::Block block;
-            *block.mutable_block_v1() = b1;
-            return block_factory_->createBlock(std::move(block))
-                .match(
-                    [&](auto &&v) {
-                      return boost::make_optional(
-                          std::unique_ptr<shared_model::interface::Block>(
-                              std::move(v.value)));
-                    },
-                    [&](const auto &e)
-                        -> boost::optional<
-                            std::unique_ptr<shared_model::interface::Block>> {
-                      log_->error("Could not build block at height {}: {}",
-                                  height,
-                                  e.error);
-                      return boost::none;
-                    });
-          };
-    });
-  };
+  if (PQntuples(result.get()) == 0) {
+    return boost::none;
+  }
+  return std::string(PQgetvalue(result.get(), 0, 0),
+                     PQgetlength(result.get(), 0, 0));
+}
+
+boost::optional<TransactionsType> PostgresBlockStorage::fetchTransactions(
+    shared_model::interface::types::HeightType height,
+    const std::vector<TxLocation> &locations) const {
+  if (not allSizesKnown(locations)) {
+    return fetch(height) |
+        [&](const auto &block) { return pickTransactions(*block, locations); };
+  }
+
+  if (locations.empty()) {
+    return TransactionsType{};
+  }
+
+  const auto height_str = std::to_string(height);
+  std::string offsets = "{", sizes = "{";
+  for (const auto &location : locations) {
+    offsets += std::to_string(location.offset) + ",";
+    sizes += std::to_string(location.size) + ",";
+  }
+  offsets.back() = '}';
+  sizes.back() = '}';
+
+  // only the bytes of the transactions are transferred
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  auto result = execBinary(
+      sql,
+      "SELECT substring(block_data FROM tx.tx_offset + 1 FOR tx.tx_size) "
+      "FROM "
+          + table_
+          + ", unnest($2::bigint[], $3::integer[]) WITH ORDINALITY "
+            "AS tx(tx_offset, tx_size, n) "
+            "WHERE height = $1 "
+            "AND length(block_data) >= tx.tx_offset + tx.tx_size "
+            "ORDER BY tx.n",
+      {height_str.c_str(), offsets.c_str(), sizes.c_str()},
+      {0, 0, 0},
+      {0, 0, 0});
+  if (PQresultStatus(result.get()) != PGRES_TUPLES_OK) {
+    log_->error("Failed to execute query: {}",
+                PQresultErrorMessage(result.get()));
+    return boost::none;
+  }
+  if (static_cast<size_t>(PQntuples(result.get())) != locations.size()) {
+    return boost::none;
+  }
+
+  TransactionsType transactions;
+  transactions.reserve(locations.size());
+  for (int row = 0; row < PQntuples(result.get()); ++row) {
+    auto transaction = parseTransaction(
+        {reinterpret_cast<const std::byte *>(PQgetvalue(result.get(), row, 0)),
+         static_cast<size_t>(PQgetlength(result.get(), row, 0))});
+    if (not transaction) {
+      log_->error("Could not parse transaction {} of block at height {}",
+                  locations[row].index,
+                  height);
+      return boost::none;
+    }
+    transactions.push_back(std::move(transaction));
+  }
+  return transactions;
 }
 
 size_t PostgresBlockStorage::size() const {
@@ -9,6 +9,11 @@
 
 using namespace iroha::ametsuchi;
 
+namespace {
+  /// number of rows converted by a single statement during migration
+  constexpr size_t kMigrationBatchSize = 1000;
+}  // namespace
+
 PostgresBlockStorageFactory::PostgresBlockStorageFactory(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
@@ -36,12 +41,69 @@ PostgresBlockStorageFactory::createTable(soci::session &sql,
                                          const std::string &table) {
   soci::statement st =
       (sql.prepare << "CREATE TABLE IF NOT EXISTS " << table
-                   << "(height bigint PRIMARY KEY, block_data text not null)");
+                   << "(height bigint PRIMARY KEY, block_data bytea not null)");
   try {
     st.execute(true);
-    return {};
   } catch (const std::exception &e) {
     return expected::makeError("Unable to create block store: "
                                + std::string(e.what()));
   }
+  return migrateHexBlocks(sql, table) |
+             [&]() -> expected::Result<void, std::string> {
+    // the transactions are read by ranges of the blocks, which does not need
+    // to decompress the whole blocks if they are stored uncompressed
+    try {
+      sql << "ALTER TABLE " << table
+          << " ALTER COLUMN block_data SET STORAGE EXTERNAL";
+    } catch (const std::exception &e) {
+      return expected::makeError("Unable to set block store storage: "
+                                 + std::string(e.what()));
+    }
+    return {};
+  };
+}
+
+iroha::expected::Result<void, std::string>
+PostgresBlockStorageFactory::migrateHexBlocks(soci::session &sql,
+                                              const std::string &table) {
+  try {
+    boost::optional<std::string> data_type;
+    sql << "SELECT data_type FROM information_schema.columns "
+           "WHERE table_schema = current_schema() "
+           "AND table_name = lower(:table) AND column_name = 'block_data'",
+        soci::use(table), soci::into(data_type);
+    if (data_type != std::string{"text"}) {
+      return {};
+    }
+
+    sql << "ALTER TABLE " << table
+        << " ADD COLUMN IF NOT EXISTS block_data_bytea bytea";
+
+    long long converted = 0;
+    do {
+      soci::statement st =
+          (sql.prepare << "UPDATE " << table
+                       << " SET block_data_bytea = decode(block_data, 'hex') "
+                          "WHERE height IN (SELECT height FROM "
+                       << table
+                       << " WHERE block_data_bytea IS NULL LIMIT "
+                       << kMigrationBatchSize << ")");
+      st.execute(true);
+      converted = st.get_affected_rows();
+    } while (converted > 0);
+
+    soci::transaction tr(sql);
+    sql << "UPDATE " << table
+        << " SET block_data_bytea = decode(block_data, 'hex') "
+           "WHERE block_data_bytea IS NULL";
+    sql << "ALTER TABLE " << table << " DROP COLUMN block_data";
+    sql << "ALTER TABLE " << table
+        << " RENAME COLUMN block_data_bytea TO block_data";
+    sql << "ALTER TABLE " << table << " ALTER COLUMN block_data SET NOT NULL";
+    tr.commit();
+    return {};
+  } catch (const std::exception &e) {
+    return expected::makeError("Unable to migrate block store: "
+                               + std::string(e.what()));
+  }
 }
@@ -22,10 +22,24 @@ namespace iroha {
           logger::LoggerPtr log);
       std::unique_ptr<BlockStorage> create() override;
 
+      /**
+       * Create a table keeping blocks as raw protobuf bytes. A table created
+       * by previous versions, which keeps hex-encoded blocks in a text
+       * column, is converted in place.
+       */
       static iroha::expected::Result<void, std::string> createTable(
           soci::session &sql, const std::string &table);
 
      private:
+      /**
+       * Convert hex text block_data column of the table to bytea. Rows are
+       * converted in small batches, each in a separate transaction, so that
+       * the table stays available during the conversion. The conversion is
+       * resumed if it was interrupted.
+       */
+      static iroha::expected::Result<void, std::string> migrateHexBlocks(
+          soci::session &sql, const std::string &table);
+
       std::shared_ptr<PoolWrapper> pool_wrapper_;
       std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
       std::function<std::string()> table_name_provider_;
@@ -8,26 +8,105 @@
 #include <optional>
 
 #include <soci/soci.h>
+#include <boost/algorithm/string/case_conv.hpp>
 #include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/impl/soci_string_view.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "common/obj_utils.hpp"
 #include "common/result.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace iroha::expected;
 
+namespace {
+  const std::string kSlotQuery =
+      "select encode(value, 'hex') from burrow_account_key_value "
+      "where address = decode(:address, 'hex') and key = decode(:key, 'hex')";
+
+  const std::string kFlushSlotsQuery = R"(
+      insert into burrow_account_key_value (address, key, value)
+      select decode(address, 'hex'), decode(key, 'hex'), decode(value, 'hex')
+      from unnest(
+          cast(:addresses as text[]),
+          cast(:keys as text[]),
+          cast(:values as text[])) as slots(address, key, value)
+      on conflict (address, key) do update set value = excluded.value)";
+
+  // log indices are taken from the sequence beforehand, so that topics are
+  // bound to their logs by the log number
+  const std::string kFlushLogsQuery = R"(
+      with inserted_call_id as (
+          insert into engine_calls (tx_hash, cmd_index)
+          values (:tx_hash, :cmd_index)
+          on conflict (tx_hash, cmd_index) do nothing
+          returning call_id
+      ),
+      engine_call as (
+          select call_id from inserted_call_id
+          union
+          select call_id from engine_calls
+          where tx_hash = :tx_hash and cmd_index = :cmd_index
+      ),
+      new_logs as (
+          select
+              n,
+              nextval(pg_get_serial_sequence('burrow_tx_logs', 'log_idx'))
+                  as log_idx,
+              address,
+              data
+          from unnest(cast(:addresses as text[]), cast(:data as text[]))
+              with ordinality as logs(address, data, n)
+      ),
+      inserted_logs as (
+          insert into burrow_tx_logs (log_idx, call_id, address, data)
+          select new_logs.log_idx, engine_call.call_id, address, data
+          from new_logs, engine_call
+          returning log_idx
+      )
+      insert into burrow_tx_logs_topics (topic, log_idx)
+      select lower(topics.topic), inserted_logs.log_idx
+      from unnest(
+              cast(:topics as text[]), cast(:topic_log_numbers as bigint[]))
+          as topics(topic, n)
+      join new_logs on new_logs.n = topics.n
+      join inserted_logs on inserted_logs.log_idx = new_logs.log_idx)";
+
+  std::string toLower(std::string_view hex) {
+    return boost::algorithm::to_lower_copy(std::string{hex});
+  }
+}  // namespace
+
+/**
+ * Prepared statement which reads a single storage slot
+ */
+class PostgresBurrowStorage::SlotStatement {
+ public:
+  explicit SlotStatement(soci::session &sql)
+      : statement((sql.prepare << kSlotQuery,
+                   soci::use(address, "address"),
+                   soci::use(key, "key"),
+                   soci::into(value))) {}
+
+  std::string address;
+  std::string key;
+  std::string value;
+  soci::statement statement;
+};
+
 PostgresBurrowStorage::PostgresBurrowStorage(
     soci::session &sql,
     std::string const &tx_hash,
     shared_model::interface::types::CommandIndexType cmd_index)
     : sql_(sql), tx_hash_(tx_hash), cmd_index_(cmd_index) {}
 
+PostgresBurrowStorage::~PostgresBurrowStorage() = default;
+
 Result<std::optional<std::string>, std::string>
 PostgresBurrowStorage::getAccount(std::string_view address) {
   try {
     std::optional<std::string> data;
     sql_ << "select data from burrow_account_data "
-            "where address = lower(:address)",
+            "where address = decode(:address, 'hex')",
         soci::use(address, "address"), soci::into(data);
     return data;
   } catch (std::exception const &e) {
@@ -40,7 +119,7 @@ Result<void, std::string> PostgresBurrowStorage::updateAccount(
   try {
     int check = 0;
     sql_ << "insert into burrow_account_data (address, data) "
-            "values (lower(:address), :data) "
+            "values (decode(:address, 'hex'), :data) "
             "on conflict (address) do update set data = excluded.data "
             "returning 1",
         soci::use(address, "address"), soci::use(account, "data"),
@@ -59,14 +138,20 @@ Result<void, std::string> PostgresBurrowStorage::removeAccount(
   try {
     int check = 0;
     sql_ << "delete from burrow_account_key_value "
-            "where address = lower(:address); "
+            "where address = decode(:address, 'hex'); "
             "delete from burrow_account_data "
-            "where address = lower(:address) "
+            "where address = decode(:address, 'hex') "
             "returning 1",
         soci::use(address, "address"), soci::into(check);
     if (check == 0) {
       return makeError("account deletion failed");
     }
+    // slots of the account are removed together with the buffered changes
+    auto lower_address = toLower(address);
+    auto it = slots_.lower_bound(SlotKey{lower_address, ""});
+    while (it != slots_.end() and it->first.first == lower_address) {
+      it = slots_.erase(it);
+    }
     return Value<void>{};
   } catch (std::exception const &e) {
     return makeError(e.what());
@@ -77,11 +162,23 @@ Result<std::optional<std::string>, std::string>
 PostgresBurrowStorage::getStorage(std::string_view address,
                                   std::string_view key) {
   try {
-    std::optional<std::string> value;
-    sql_ << "select value from burrow_account_key_value "
-            "where address = lower(:address) and key = lower(:key) ",
-        soci::use(address, "address"), soci::use(key, "key"), soci::into(value);
-    return value;
+    SlotKey slot_key{toLower(address), toLower(key)};
+    auto it = slots_.find(slot_key);
+    if (it == slots_.end()) {
+      if (not slot_statement_) {
+        slot_statement_ = std::make_unique<SlotStatement>(sql_);
+      }
+      auto &st = *slot_statement_;
+      st.address = slot_key.first;
+      st.key = slot_key.second;
+      std::optional<std::string> value;
+      if (st.statement.execute(true)) {
+        value = st.value;
+      }
+      it = slots_.emplace(std::move(slot_key), Slot{std::move(value), false})
+               .first;
+    }
+    return it->second.value;
   } catch (std::exception const &e) {
     return makeError(e.what());
   }
@@ -89,71 +186,68 @@ PostgresBurrowStorage::getStorage(std::string_view address,
 
 Result<void, std::string> PostgresBurrowStorage::setStorage(
     std::string_view address, std::string_view key, std::string_view value) {
-  try {
-    int check = 0;
-    sql_ << "insert into burrow_account_key_value (address, key, value) "
-            "values (lower(:address), lower(:key), :value) "
-            "on conflict (address, key) do update set value = excluded.value "
-            "returning 1",
-        soci::use(address, "address"), soci::use(key, "key"),
-        soci::use(value, "value"), soci::into(check);
-    if (check == 0) {
-      return makeError("account key-value storage update failed");
-    }
-    return Value<void>{};
-  } catch (std::exception const &e) {
-    return makeError(e.what());
-  }
+  slots_[SlotKey{toLower(address), toLower(key)}] =
+      Slot{std::string{value}, true};
+  return Value<void>{};
 }
 
 Result<void, std::string> PostgresBurrowStorage::storeLog(
     std::string_view address,
     std::string_view data,
     std::vector<std::string_view> topics) {
+  logs_.push_back(Log{std::string{address},
+                      std::string{data},
+                      {topics.begin(), topics.end()}});
+  return Value<void>{};
+}
+
+Result<void, std::string> PostgresBurrowStorage::flush() {
   try {
-    std::optional<size_t> log_idx;
-
-    if (call_id_cache_) {
-      sql_ << "insert into burrow_tx_logs (call_id, address, data) "
-              "values (:call_id, lower(:address), :data) "
-              "returning log_idx",
-          soci::use(call_id_cache_.value(), "call_id"),
-          soci::use(address, "address"), soci::use(data, "data"),
-          soci::into(log_idx);
-    } else {
-      sql_ << "with inserted_call_id as "
-              "("
-              "  insert into engine_calls (tx_hash, cmd_index)"
-              "  values (:tx_hash, :cmd_index)"
-              "  on conflict (tx_hash, cmd_index) do nothing"
-              "  returning call_id"
-              ")"
-              "insert into burrow_tx_logs (call_id, address, data) "
-              "select call_id, :address, :data from "
-              "("
-              "  ("
-              "    select * from inserted_call_id"
-              "  ) union ("
-              "    select call_id from engine_calls"
-              "    where tx_hash = :tx_hash and cmd_index = :cmd_index"
-              "  )"
-              ") t0 "
-              "returning call_id, log_idx",
-          soci::use(tx_hash_, "tx_hash"), soci::use(cmd_index_, "cmd_index"),
-          soci::use(address, "address"), soci::use(data, "data"),
-          soci::into(call_id_cache_), soci::into(log_idx);
+    std::vector<std::string> addresses;
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    for (auto &[slot_key, slot] : slots_) {
+      if (slot.dirty) {
+        addresses.push_back(slot_key.first);
+        keys.push_back(slot_key.second);
+        values.push_back(slot.value.value_or(""));
+      }
     }
-
-    assert(call_id_cache_);
-    assert(log_idx);
-    if (not call_id_cache_ or not log_idx) {
-      return makeError("could not insert log data");
+    if (not addresses.empty()) {
+      auto addresses_literal = makeArrayLiteral(addresses);
+      auto keys_literal = makeArrayLiteral(keys);
+      auto values_literal = makeArrayLiteral(values);
+      sql_ << kFlushSlotsQuery, soci::use(addresses_literal, "addresses"),
+          soci::use(keys_literal, "keys"), soci::use(values_literal, "values");
+      for (auto &slot : slots_) {
+        slot.second.dirty = false;
+      }
     }
-    if (not topics.empty()) {
-      std::vector<size_t> log_idxs(topics.size(), log_idx.value());
-      sql_ << "insert into burrow_tx_logs_topics (topic, log_idx) "
-              "values (lower(:topic), :log_idx)",
-          soci::use(topics, "topic"), soci::use(log_idxs, "log_idx");
+
+    if (not logs_.empty()) {
+      std::vector<std::string> log_addresses;
+      std::vector<std::string> log_data;
+      std::vector<std::string> topics;
+      std::vector<std::string> topic_log_numbers;
+      for (size_t i = 0; i < logs_.size(); ++i) {
+        log_addresses.push_back(logs_[i].address);
+        log_data.push_back(logs_[i].data);
+        for (auto const &topic : logs_[i].topics) {
+          topics.push_back(topic);
+          topic_log_numbers.push_back(std::to_string(i + 1));
+        }
+      }
+      auto addresses_literal = makeArrayLiteral(log_addresses);
+      auto data_literal = makeArrayLiteral(log_data);
+      auto topics_literal = makeArrayLiteral(topics);
+      auto topic_log_numbers_literal = makeArrayLiteral(topic_log_numbers);
+      sql_ << kFlushLogsQuery, soci::use(tx_hash_, "tx_hash"),
+          soci::use(cmd_index_, "cmd_index"),
+          soci::use(addresses_literal, "addresses"),
+          soci::use(data_literal, "data"),
+          soci::use(topics_literal, "topics"),
+          soci::use(topic_log_numbers_literal, "topic_log_numbers");
+      logs_.clear();
     }
     return Value<void>{};
   } catch (std::exception const &e) {
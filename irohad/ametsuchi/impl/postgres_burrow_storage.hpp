@@ -8,6 +8,9 @@
 
 #include "ametsuchi/burrow_storage.hpp"
 
+#include <map>
+#include <memory>
+
 #include "interfaces/common_objects/types.hpp"
 
 namespace soci {
@@ -15,6 +18,12 @@ namespace soci {
 }
 
 namespace iroha::ametsuchi {
+  /**
+   * EVM state storage in the WSV database, which lives for a single engine
+   * call. Storage slots are cached once read, and the modified slots and the
+   * logs are kept in memory until flush(), which writes them with bulk
+   * statements. Accounts are read and written directly.
+   */
   class PostgresBurrowStorage : public BurrowStorage {
    public:
     PostgresBurrowStorage(
@@ -22,6 +31,8 @@ namespace iroha::ametsuchi {
         std::string const &tx_hash,
         shared_model::interface::types::CommandIndexType cmd_index);
 
+    ~PostgresBurrowStorage() override;
+
     expected::Result<std::optional<std::string>, std::string> getAccount(
         std::string_view address) override;
 
@@ -44,11 +55,33 @@ namespace iroha::ametsuchi {
         std::string_view data,
         std::vector<std::string_view> topics) override;
 
+    expected::Result<void, std::string> flush() override;
+
    private:
+    /// address and key in lowercase hex
+    using SlotKey = std::pair<std::string, std::string>;
+
+    struct Slot {
+      /// value in hex, none if the slot is not set
+      std::optional<std::string> value;
+      /// whether the value has to be written to the database
+      bool dirty;
+    };
+
+    struct Log {
+      std::string address;
+      std::string data;
+      std::vector<std::string> topics;
+    };
+
+    class SlotStatement;
+
     soci::session &sql_;
     std::string const &tx_hash_;
     shared_model::interface::types::CommandIndexType cmd_index_;
-    std::optional<size_t> call_id_cache_;
+    std::map<SlotKey, Slot> slots_;
+    std::vector<Log> logs_;
+    std::unique_ptr<SlotStatement> slot_statement_;
   };
 
 }  // namespace iroha::ametsuchi
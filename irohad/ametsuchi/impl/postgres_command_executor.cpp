@@ -7,6 +7,7 @@
 
 #include <exception>
 #include <forward_list>
+#include <limits>
 #include <memory>
 
 #include <fmt/core.h>
@@ -20,6 +21,7 @@
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/vm_caller.hpp"
 #include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/add_peer.hpp"
@@ -317,6 +319,30 @@ namespace {
     return query;
   }
 
+  /// In-memory counterpart of checkAccountRolePermission
+  bool hasRolePermission(
+      const shared_model::interface::RolePermissionSet &account_permissions,
+      Role permission) {
+    return account_permissions.isSet(permission)
+        or account_permissions.isSet(Role::kRoot);
+  }
+
+  /// In-memory counterpart of checkAccountDomainRoleOrGlobalRolePermission
+  bool hasDomainOrGlobalRolePermission(
+      const shared_model::interface::RolePermissionSet &creator_permissions,
+      Role global_permission,
+      Role domain_permission,
+      const shared_model::interface::types::AccountIdType &creator_id,
+      const shared_model::interface::types::AssetIdType &asset_id) {
+    if (hasRolePermission(creator_permissions, global_permission)) {
+      return true;
+    }
+    auto creator_domain = creator_id.substr(creator_id.find('@') + 1);
+    auto asset_domain = asset_id.substr(asset_id.find('#') + 1);
+    return creator_domain == asset_domain
+        and hasRolePermission(creator_permissions, domain_permission);
+  }
+
   std::string checkAccountHasRoleOrGrantablePerm(
       Role role,
       Grantable grantable,
@@ -681,6 +707,15 @@ namespace iroha {
           sql_,
           R"(
           WITH %s
+            old_detail AS
+            (
+                SELECT value
+                FROM account_has_detail
+                WHERE
+                  account_id = :target
+                  AND writer = :creator
+                  AND key = :key
+            ),
             old_value AS
             (
                 SELECT *
@@ -688,10 +723,11 @@ namespace iroha {
                 WHERE
                   account_id = :target
                   AND CASE
-                    WHEN data ? :creator AND data->:creator ?:key
+                    WHEN EXISTS (SELECT * FROM old_detail)
                       THEN CASE
                         WHEN :have_expected_value::boolean
-                            THEN data->:creator->:key = :expected_value::jsonb
+                            THEN (SELECT value FROM old_detail)
+                                = :expected_value::jsonb
                         ELSE FALSE
                         END
                     ELSE not (:check_empty::boolean and :have_expected_value::boolean)
@@ -699,18 +735,15 @@ namespace iroha {
             ),
             inserted AS
             (
-                UPDATE account
-                SET data = jsonb_set(
-                  CASE
-                    WHEN data ? :creator THEN data
-                    ELSE jsonb_set(data, array[:creator], '{}')
-                  END,
-                  array[:creator, :key], :new_value::jsonb
+                INSERT INTO account_has_detail(account_id, writer, key, value)
+                (
+                    SELECT :target, :creator, :key, :new_value::jsonb
+                    WHERE
+                      EXISTS (SELECT * FROM old_value)
+                      %s
                 )
-                WHERE
-                  EXISTS (SELECT * FROM old_value)
-                  AND account_id = :target
-                  %s
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
                 RETURNING (1)
             )
           SELECT CASE
@@ -774,9 +807,9 @@ namespace iroha {
             ),
             insert_account AS
             (
-                INSERT INTO account(account_id, domain_id, quorum, data)
+                INSERT INTO account(account_id, domain_id, quorum)
                 (
-                    SELECT :account_id, :domain, 1, '{}'
+                    SELECT :account_id, :domain, 1
                     WHERE EXISTS (SELECT * FROM insert_signatory)
                       AND EXISTS (SELECT * FROM get_domain_default_role)
                 ) RETURNING (1)
@@ -1123,10 +1156,15 @@ namespace iroha {
           WITH %s
             inserted AS
             (
-                UPDATE account SET data = jsonb_set(
-                CASE WHEN data ? :creator THEN data ELSE
-                jsonb_set(data, array[:creator], '{}') END,
-                array[:creator, :key], :value::jsonb) WHERE account_id=:target %s
+                INSERT INTO account_has_detail(account_id, writer, key, value)
+                (
+                    SELECT :target, :creator, :key, :value::jsonb
+                    WHERE EXISTS
+                        (SELECT * FROM account WHERE account_id = :target)
+                    %s
+                )
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
                 RETURNING (1)
             )
           SELECT CASE
@@ -1407,11 +1445,14 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
         std::shared_ptr<PostgresSpecificQueryExecutor> specific_query_executor,
-        std::optional<std::reference_wrapper<const VmCaller>> vm_caller)
+        std::optional<std::reference_wrapper<const VmCaller>> vm_caller,
+        std::shared_ptr<WsvCache> wsv_cache)
         : sql_(std::move(sql)),
           perm_converter_{std::move(perm_converter)},
           specific_query_executor_{std::move(specific_query_executor)},
-          vm_caller_{std::move(vm_caller)} {
+          vm_caller_{std::move(vm_caller)},
+          wsv_cache_{std::move(wsv_cache)},
+          uncached_depth_{0} {
       initStatements();
     }
 
@@ -1425,9 +1466,39 @@ namespace iroha {
         bool do_validation) {
       return boost::apply_visitor(
           [this, &creator_account_id, &tx_hash, cmd_index, do_validation](
-              const auto &command) {
-            return (*this)(
-                command, creator_account_id, tx_hash, cmd_index, do_validation);
+              const auto &command) -> CommandResult {
+            if (not wsv_cache_.enabled()) {
+              return (*this)(command,
+                             creator_account_id,
+                             tx_hash,
+                             cmd_index,
+                             do_validation);
+            }
+
+            if (uncached_depth_ == 0) {
+              if (auto result =
+                      this->executeCached(command,
+                                          creator_account_id,
+                                          do_validation)) {
+                return *std::move(result);
+              }
+            }
+
+            // the database must see the balances changed in memory
+            if (auto error =
+                    expected::resultToOptionalError(this->flushWsvCache())) {
+              return makeCommandError(
+                  "FlushWsvCache", 1, std::move(error).value());
+            }
+            ++uncached_depth_;
+            auto result = (*this)(command,
+                                  creator_account_id,
+                                  tx_hash,
+                                  cmd_index,
+                                  do_validation);
+            --uncached_depth_;
+            this->invalidateWsvCache(command, creator_account_id);
+            return result;
           },
           cmd.get());
     }
@@ -1436,6 +1507,380 @@ namespace iroha {
       return *sql_;
     }
 
+    WsvCacheOverlay &PostgresCommandExecutor::getWsvCache() {
+      return wsv_cache_;
+    }
+
+    expected::Result<void, std::string>
+    PostgresCommandExecutor::flushWsvCache() {
+      if (not wsv_cache_.hasDirtyBalances()) {
+        return {};
+      }
+      try {
+        std::vector<std::string> account_ids, asset_ids, amounts;
+        for (auto &balance : wsv_cache_.takeDirtyBalances()) {
+          const auto precision = loadAsset(balance.first.asset_id).precision;
+          account_ids.push_back(std::move(balance.first.account_id));
+          asset_ids.push_back(std::move(balance.first.asset_id));
+          amounts.push_back(formatWsvCacheBalance(balance.second, precision));
+        }
+        *sql_ << "INSERT INTO account_has_asset(account_id, asset_id, amount) "
+                 "VALUES (:account_id, :asset_id, :amount::decimal) "
+                 "ON CONFLICT (account_id, asset_id) "
+                 "DO UPDATE SET amount = EXCLUDED.amount",
+            soci::use(account_ids), soci::use(asset_ids), soci::use(amounts);
+      } catch (const std::exception &e) {
+        return e.what();
+      }
+      return {};
+    }
+
+    WsvCacheAccount PostgresCommandExecutor::loadAccount(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      if (auto account = wsv_cache_.getAccount(account_id)) {
+        return *account;
+      }
+      int exists = 0;
+      std::string permissions;
+      *sql_ << (boost::format(R"(
+          SELECT
+              (SELECT count(1) FROM account WHERE account_id = :account_id),
+              (SELECT COALESCE(bit_or(rp.permission), '0'::bit(%1%))::text
+               FROM role_has_permissions AS rp
+                   JOIN account_has_roles AS ar ON ar.role_id = rp.role_id
+               WHERE ar.account_id = :account_id))")
+                % kRolePermissionSetSize)
+                   .str(),
+          soci::use(account_id, "account_id"), soci::into(exists),
+          soci::into(permissions);
+      WsvCacheAccount account{
+          exists != 0, shared_model::interface::RolePermissionSet{permissions}};
+      wsv_cache_.putAccount(account_id, account);
+      return account;
+    }
+
+    WsvCacheAsset PostgresCommandExecutor::loadAsset(
+        const shared_model::interface::types::AssetIdType &asset_id) {
+      if (auto asset = wsv_cache_.getAsset(asset_id)) {
+        return *asset;
+      }
+      std::optional<int> precision;
+      *sql_ << "SELECT precision FROM asset WHERE asset_id = :asset_id",
+          soci::use(asset_id, "asset_id"), soci::into(precision);
+      WsvCacheAsset asset{
+          static_cast<bool>(precision),
+          static_cast<shared_model::interface::types::PrecisionType>(
+              precision.value_or(0))};
+      wsv_cache_.putAsset(asset_id, asset);
+      return asset;
+    }
+
+    shared_model::interface::GrantablePermissionSet
+    PostgresCommandExecutor::loadGrantable(const WsvCacheGrantKey &key) {
+      if (auto permissions = wsv_cache_.getGrantable(key)) {
+        return *permissions;
+      }
+      std::string permissions;
+      *sql_ << (boost::format(R"(
+          SELECT COALESCE(bit_or(permission), '0'::bit(%1%))::text
+          FROM account_has_grantable_permissions
+          WHERE account_id = :account_id
+              AND permittee_account_id = :permittee_account_id)")
+                % kGrantablePermissionSetSize)
+                   .str(),
+          soci::use(key.account_id, "account_id"),
+          soci::use(key.permittee_account_id, "permittee_account_id"),
+          soci::into(permissions);
+      shared_model::interface::GrantablePermissionSet result{permissions};
+      wsv_cache_.putGrantable(key, result);
+      return result;
+    }
+
+    std::optional<WsvCacheBalance> PostgresCommandExecutor::loadBalance(
+        const WsvCacheBalanceKey &key,
+        shared_model::interface::types::PrecisionType precision) {
+      if (auto balance = wsv_cache_.getBalance(key)) {
+        return balance;
+      }
+      std::optional<std::string> amount;
+      *sql_ << "SELECT amount::text FROM account_has_asset "
+               "WHERE account_id = :account_id AND asset_id = :asset_id",
+          soci::use(key.account_id, "account_id"),
+          soci::use(key.asset_id, "asset_id"), soci::into(amount);
+      auto balance = amount ? parseWsvCacheBalance(*amount, precision)
+                            : std::make_optional<WsvCacheBalance>(0);
+      if (balance) {
+        wsv_cache_.putBalance(key, *balance);
+      }
+      return balance;
+    }
+
+    template <typename CommandType>
+    std::optional<CommandResult> PostgresCommandExecutor::executeCached(
+        const CommandType &,
+        const shared_model::interface::types::AccountIdType &,
+        bool) {
+      return std::nullopt;
+    }
+
+    std::optional<CommandResult> PostgresCommandExecutor::executeCached(
+        const shared_model::interface::AddAssetQuantity &command,
+        const shared_model::interface::types::AccountIdType &creator_account_id,
+        bool do_validation) {
+      auto &asset_id = command.assetId();
+      auto quantity = command.amount().toStringRepr();
+      int precision = command.amount().precision();
+      auto args = [&] {
+        return shared_model::detail::PrettyStringBuilder()
+            .init("AddAssetQuantity")
+            .appendNamed("Validation", do_validation)
+            .appendNamed("creator", creator_account_id)
+            .appendNamed("asset_id", asset_id)
+            .appendNamed("precision", std::to_string(precision))
+            .appendNamed("quantity", quantity)
+            .finalize();
+      };
+
+      try {
+        const auto creator = loadAccount(creator_account_id);
+        const auto asset = loadAsset(asset_id);
+
+        if (do_validation
+            and not hasDomainOrGlobalRolePermission(creator.permissions,
+                                                    Role::kAddAssetQty,
+                                                    Role::kAddDomainAssetQty,
+                                                    creator_account_id,
+                                                    asset_id)) {
+          return makeCommandError("AddAssetQuantity", 2, args());
+        }
+        if (not creator.exists) {
+          return makeCommandError("AddAssetQuantity", 1, args());
+        }
+        if (not asset.exists or asset.precision < precision) {
+          return makeCommandError("AddAssetQuantity", 3, args());
+        }
+
+        WsvCacheBalanceKey key{creator_account_id, asset_id};
+        auto amount = parseWsvCacheBalance(quantity, asset.precision);
+        auto balance = loadBalance(key, asset.precision);
+        if (not amount or not balance) {
+          return std::nullopt;
+        }
+        if (*amount > std::numeric_limits<WsvCacheBalance>::max() - *balance) {
+          return makeCommandError("AddAssetQuantity", 4, args());
+        }
+        wsv_cache_.setBalance(key, *balance + *amount);
+        return CommandResult{};
+      } catch (const std::exception &e) {
+        return getCommandError("AddAssetQuantity", e.what(), args());
+      }
+    }
+
+    std::optional<CommandResult> PostgresCommandExecutor::executeCached(
+        const shared_model::interface::SubtractAssetQuantity &command,
+        const shared_model::interface::types::AccountIdType &creator_account_id,
+        bool do_validation) {
+      auto &asset_id = command.assetId();
+      auto quantity = command.amount().toStringRepr();
+      uint32_t precision = command.amount().precision();
+      auto args = [&] {
+        return shared_model::detail::PrettyStringBuilder()
+            .init("SubtractAssetQuantity")
+            .appendNamed("Validation", do_validation)
+            .appendNamed("creator", creator_account_id)
+            .appendNamed("asset_id", asset_id)
+            .appendNamed("quantity", quantity)
+            .appendNamed("precision", std::to_string(precision))
+            .finalize();
+      };
+
+      try {
+        const auto creator = loadAccount(creator_account_id);
+        const auto asset = loadAsset(asset_id);
+
+        if (do_validation
+            and not hasDomainOrGlobalRolePermission(
+                    creator.permissions,
+                    Role::kSubtractAssetQty,
+                    Role::kSubtractDomainAssetQty,
+                    creator_account_id,
+                    asset_id)) {
+          return makeCommandError("SubtractAssetQuantity", 2, args());
+        }
+        if (not asset.exists or asset.precision < precision) {
+          return makeCommandError("SubtractAssetQuantity", 3, args());
+        }
+
+        WsvCacheBalanceKey key{creator_account_id, asset_id};
+        auto amount = parseWsvCacheBalance(quantity, asset.precision);
+        auto balance = loadBalance(key, asset.precision);
+        if (not amount or not balance) {
+          return std::nullopt;
+        }
+        if (*balance < *amount) {
+          return makeCommandError("SubtractAssetQuantity", 4, args());
+        }
+        if (not creator.exists) {
+          return makeCommandError("SubtractAssetQuantity", 1, args());
+        }
+        wsv_cache_.setBalance(key, *balance - *amount);
+        return CommandResult{};
+      } catch (const std::exception &e) {
+        return getCommandError("SubtractAssetQuantity", e.what(), args());
+      }
+    }
+
+    std::optional<CommandResult> PostgresCommandExecutor::executeCached(
+        const shared_model::interface::TransferAsset &command,
+        const shared_model::interface::types::AccountIdType &creator_account_id,
+        bool do_validation) {
+      auto &src_account_id = command.srcAccountId();
+      auto &dest_account_id = command.destAccountId();
+      auto &asset_id = command.assetId();
+      auto quantity = command.amount().toStringRepr();
+      uint32_t precision = command.amount().precision();
+      auto args = [&] {
+        return shared_model::detail::PrettyStringBuilder()
+            .init("TransferAsset")
+            .appendNamed("Validation", do_validation)
+            .appendNamed("creator", creator_account_id)
+            .appendNamed("source_account_id", src_account_id)
+            .appendNamed("dest_account_id", dest_account_id)
+            .appendNamed("asset_id", asset_id)
+            .appendNamed("quantity", quantity)
+            .appendNamed("precision", std::to_string(precision))
+            .finalize();
+      };
+
+      // both balances are read before any of them is written by the
+      // database, so a self-transfer is left to it
+      if (src_account_id == dest_account_id) {
+        return std::nullopt;
+      }
+
+      try {
+        const auto src = loadAccount(src_account_id);
+        const auto dest = loadAccount(dest_account_id);
+        const auto asset = loadAsset(asset_id);
+
+        if (do_validation) {
+          auto has_perm = [&] {
+            if (not hasRolePermission(dest.permissions, Role::kReceive)) {
+              return false;
+            }
+            const auto creator = loadAccount(creator_account_id);
+            if (creator_account_id == src_account_id) {
+              return hasRolePermission(creator.permissions, Role::kTransfer);
+            }
+            return loadGrantable({creator_account_id, src_account_id})
+                       .isSet(Grantable::kTransferMyAssets)
+                or hasRolePermission(creator.permissions, Role::kRoot);
+          };
+          if (not has_perm()) {
+            return makeCommandError("TransferAsset", 2, args());
+          }
+        }
+        if (not src.exists) {
+          return makeCommandError("TransferAsset", 3, args());
+        }
+        if (not dest.exists) {
+          return makeCommandError("TransferAsset", 4, args());
+        }
+        if (not asset.exists or asset.precision < precision) {
+          return makeCommandError("TransferAsset", 5, args());
+        }
+
+        WsvCacheBalanceKey src_key{src_account_id, asset_id};
+        WsvCacheBalanceKey dest_key{dest_account_id, asset_id};
+        auto amount = parseWsvCacheBalance(quantity, asset.precision);
+        auto src_balance = loadBalance(src_key, asset.precision);
+        auto dest_balance = loadBalance(dest_key, asset.precision);
+        if (not amount or not src_balance or not dest_balance) {
+          return std::nullopt;
+        }
+        if (*src_balance < *amount) {
+          return makeCommandError("TransferAsset", 6, args());
+        }
+        if (*amount
+            > std::numeric_limits<WsvCacheBalance>::max() - *dest_balance) {
+          return makeCommandError("TransferAsset", 7, args());
+        }
+        wsv_cache_.setBalance(src_key, *src_balance - *amount);
+        wsv_cache_.setBalance(dest_key, *dest_balance + *amount);
+        return CommandResult{};
+      } catch (const std::exception &e) {
+        return getCommandError("TransferAsset", e.what(), args());
+      }
+    }
+
+    template <typename CommandType>
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const CommandType &,
+        const shared_model::interface::types::AccountIdType &) {}
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::AddAssetQuantity &command,
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      wsv_cache_.invalidateBalance({creator_account_id, command.assetId()});
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::AppendRole &command,
+        const shared_model::interface::types::AccountIdType &) {
+      wsv_cache_.invalidateAccount(command.accountId());
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::CreateAccount &command,
+        const shared_model::interface::types::AccountIdType &) {
+      wsv_cache_.invalidateAccount(command.accountName() + "@"
+                                   + command.domainId());
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::CreateAsset &command,
+        const shared_model::interface::types::AccountIdType &) {
+      wsv_cache_.invalidateAsset(command.assetName() + "#"
+                                 + command.domainId());
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::DetachRole &command,
+        const shared_model::interface::types::AccountIdType &) {
+      wsv_cache_.invalidateAccount(command.accountId());
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::GrantPermission &command,
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      wsv_cache_.invalidateGrantable({command.accountId(), creator_account_id});
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::RevokePermission &command,
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      wsv_cache_.invalidateGrantable({command.accountId(), creator_account_id});
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::SubtractAssetQuantity &command,
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id) {
+      wsv_cache_.invalidateBalance({creator_account_id, command.assetId()});
+    }
+
+    void PostgresCommandExecutor::invalidateWsvCache(
+        const shared_model::interface::TransferAsset &command,
+        const shared_model::interface::types::AccountIdType &) {
+      wsv_cache_.invalidateBalance(
+          {command.srcAccountId(), command.assetId()});
+      wsv_cache_.invalidateBalance(
+          {command.destAccountId(), command.assetId()});
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command,
         const shared_model::interface::types::AccountIdType &creator_account_id,
@@ -1558,6 +2003,12 @@ namespace iroha {
                   *specific_query_executor_)
               .match(
                   [&](const auto &value) -> CommandResult {
+                    if (auto flushed = burrow_storage.flush();
+                        expected::hasError(flushed)) {
+                      return makeCommandError(
+                          "CallEngine", 3, std::move(flushed.assumeError()));
+                    }
+
                     StatementExecutor executor(
                         store_engine_response_statements_,
                         false,
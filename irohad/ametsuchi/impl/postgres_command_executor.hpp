@@ -10,6 +10,7 @@
 #include "ametsuchi/command_executor.hpp"
 
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 
 namespace soci {
   class session;
@@ -56,7 +57,8 @@ namespace iroha {
               perm_converter,
           std::shared_ptr<PostgresSpecificQueryExecutor>
               specific_query_executor,
-          std::optional<std::reference_wrapper<const VmCaller>> vm_caller);
+          std::optional<std::reference_wrapper<const VmCaller>> vm_caller,
+          std::shared_ptr<WsvCache> wsv_cache = nullptr);
 
       ~PostgresCommandExecutor();
 
@@ -70,6 +72,16 @@ namespace iroha {
 
       soci::session &getSession();
 
+      /// @return WSV cache view of the current database transaction
+      WsvCacheOverlay &getWsvCache();
+
+      /**
+       * Write the balances changed in WSV cache to the database. Must be
+       * called before the current database transaction is committed or
+       * prepared.
+       */
+      expected::Result<void, std::string> flushWsvCache();
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command,
           const shared_model::interface::types::AccountIdType
@@ -249,12 +261,113 @@ namespace iroha {
           const std::string &base_statement,
           const std::vector<std::string> &permission_checks);
 
+      /**
+       * Execute a command using WSV cache instead of the database.
+       * @return command result or nullopt if the command can not be executed
+       * with the cache and must be executed by the database
+       */
+      template <typename CommandType>
+      std::optional<CommandResult> executeCached(
+          const CommandType &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id,
+          bool do_validation);
+
+      std::optional<CommandResult> executeCached(
+          const shared_model::interface::AddAssetQuantity &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id,
+          bool do_validation);
+
+      std::optional<CommandResult> executeCached(
+          const shared_model::interface::SubtractAssetQuantity &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id,
+          bool do_validation);
+
+      std::optional<CommandResult> executeCached(
+          const shared_model::interface::TransferAsset &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id,
+          bool do_validation);
+
+      /// Drop the cached rows which were changed by the database
+      template <typename CommandType>
+      void invalidateWsvCache(const CommandType &command,
+                              const shared_model::interface::types::AccountIdType
+                                  &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::AddAssetQuantity &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::AppendRole &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::CreateAccount &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::CreateAsset &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::DetachRole &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::GrantPermission &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::RevokePermission &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::SubtractAssetQuantity &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      void invalidateWsvCache(
+          const shared_model::interface::TransferAsset &command,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id);
+
+      /// Read-through accessors of WSV cache
+      WsvCacheAccount loadAccount(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      WsvCacheAsset loadAsset(
+          const shared_model::interface::types::AssetIdType &asset_id);
+
+      shared_model::interface::GrantablePermissionSet loadGrantable(
+          const WsvCacheGrantKey &key);
+
+      /// @return nullopt if the stored amount can not be represented with
+      /// the given precision
+      std::optional<WsvCacheBalance> loadBalance(
+          const WsvCacheBalanceKey &key,
+          shared_model::interface::types::PrecisionType precision);
+
       std::unique_ptr<soci::session> sql_;
 
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
       std::shared_ptr<PostgresSpecificQueryExecutor> specific_query_executor_;
       std::optional<std::reference_wrapper<const VmCaller>> vm_caller_;
+      WsvCacheOverlay wsv_cache_;
+      /// depth of commands executed by the database, e.g. nested into
+      /// CallEngine, which must not be served from WSV cache
+      size_t uncached_depth_;
 
       std::unique_ptr<CommandStatements> add_asset_quantity_statements_;
       std::unique_ptr<CommandStatements> add_peer_statements_;
@@ -5,18 +5,75 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <soci/postgresql/soci-postgresql.h>
 #include <soci/soci.h>
-#include <boost/format.hpp>
 #include "cryptography/hash.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace shared_model::interface::types;
 
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  /// Signature, flags and header extension length of binary COPY data
+  const char kCopyHeader[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+  /// Field count of -1 marks the end of binary COPY data
+  const char kCopyTrailer[] = "\377\377";
+
+  template <typename T>
+  void appendBigEndian(std::string &buffer, T value) {
+    for (int shift = (sizeof(T) - 1) * 8; shift >= 0; shift -= 8) {
+      buffer.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+  }
+
+  void appendTupleHeader(std::string &buffer, int16_t fields) {
+    appendBigEndian<uint16_t>(buffer, static_cast<uint16_t>(fields));
+  }
+
+  void appendField(std::string &buffer, const void *data, size_t size) {
+    appendBigEndian<uint32_t>(buffer, static_cast<uint32_t>(size));
+    buffer.append(static_cast<const char *>(data), size);
+  }
+
+  void appendField(std::string &buffer, const std::string &value) {
+    appendField(buffer, value.data(), value.size());
+  }
+
+  void appendField(std::string &buffer, const HashType &hash) {
+    appendField(buffer, hash.blob().data(), hash.blob().size());
+  }
+
+  void appendField(std::string &buffer, bool value) {
+    char byte = value ? 1 : 0;
+    appendField(buffer, &byte, 1);
+  }
+
+  /// Append bigint field
+  void appendField(std::string &buffer, uint64_t value) {
+    appendBigEndian<uint32_t>(buffer, sizeof(value));
+    appendBigEndian(buffer, value);
+  }
+
+  /// Append integer field
+  void appendField(std::string &buffer, uint32_t value) {
+    appendBigEndian<uint32_t>(buffer, sizeof(value));
+    appendBigEndian(buffer, value);
+  }
+
+  void appendNull(std::string &buffer) {
+    appendBigEndian<uint32_t>(buffer, 0xFFFFFFFF);
+  }
+}  // namespace
+
 PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
 
 void PostgresIndexer::txHashStatus(const HashType &tx_hash, bool is_committed) {
-  tx_hash_status_.hash.emplace_back(tx_hash.hex());
-  tx_hash_status_.status.emplace_back(is_committed ? "TRUE" : "FALSE");
+  auto &tuples = tx_hash_status_.tuples;
+  appendTupleHeader(tuples, 2);
+  appendField(tuples, tx_hash);
+  appendField(tuples, is_committed);
+  ++tx_hash_status_.count;
 }
 
 void PostgresIndexer::committedTxHash(const HashType &committed_tx_hash) {
@@ -33,51 +90,79 @@ void PostgresIndexer::txPositions(
     boost::optional<AssetIdType> &&asset_id,
     TimestampType const ts,
     TxPosition const &position) {
-  tx_positions_.account.emplace_back(account);
-  tx_positions_.hash.emplace_back(hash.hex());
-  tx_positions_.asset_id.emplace_back(std::move(asset_id));
-  tx_positions_.ts.emplace_back(ts);
-  tx_positions_.height.emplace_back(position.height);
-  tx_positions_.index.emplace_back(position.index);
+  auto &tuples = tx_positions_.tuples;
+  appendTupleHeader(tuples, 8);
+  appendField(tuples, account);
+  appendField(tuples, hash);
+  if (asset_id) {
+    appendField(tuples, *asset_id);
+  } else {
+    appendNull(tuples);
+  }
+  appendField(tuples, static_cast<uint64_t>(ts));
+  appendField(tuples, static_cast<uint64_t>(position.height));
+  appendField(tuples, static_cast<uint64_t>(position.index));
+  if (position.size > 0) {
+    appendField(tuples, position.offset);
+    appendField(tuples, position.size);
+  } else {
+    appendNull(tuples);
+    appendNull(tuples);
+  }
+  ++tx_positions_.count;
 }
 
-iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
-  try {
-    assert(tx_hash_status_.hash.size() == tx_hash_status_.status.size());
-    if (not tx_hash_status_.hash.empty()) {
-      sql_ << "INSERT INTO tx_status_by_hash"
-              "(hash, status) VALUES "
-              "(:hash, :status);",
-          soci::use(tx_hash_status_.hash), soci::use(tx_hash_status_.status);
-
-      tx_hash_status_.hash.clear();
-      tx_hash_status_.status.clear();
-    }
+iroha::expected::Result<void, std::string> PostgresIndexer::copy(
+    const std::string &table, CopyData &data) {
+  if (data.count == 0) {
+    return {};
+  }
 
-    assert(tx_positions_.account.size() == tx_positions_.hash.size());
-    assert(tx_positions_.account.size() == tx_positions_.asset_id.size());
-    assert(tx_positions_.account.size() == tx_positions_.ts.size());
-    assert(tx_positions_.account.size() == tx_positions_.height.size());
-    assert(tx_positions_.account.size() == tx_positions_.index.size());
-    if (!tx_positions_.account.empty()) {
-      sql_ << "INSERT INTO tx_positions"
-              "(creator_id, hash, asset_id, ts, height, index) VALUES "
-              "(:creator_id, :hash, :asset_id, :ts, :height, :index) ON "
-              "CONFLICT DO NOTHING;",
-          soci::use(tx_positions_.account), soci::use(tx_positions_.hash),
-          soci::use(tx_positions_.asset_id), soci::use(tx_positions_.ts),
-          soci::use(tx_positions_.height), soci::use(tx_positions_.index);
-
-      tx_positions_.account.clear();
-      tx_positions_.hash.clear();
-      tx_positions_.asset_id.clear();
-      tx_positions_.ts.clear();
-      tx_positions_.height.clear();
-      tx_positions_.index.clear();
-    }
+  auto *conn =
+      static_cast<soci::postgresql_session_backend *>(sql_.get_backend())
+          ->conn_;
+  PgResultPtr start{
+      PQexec(conn,
+             ("COPY " + table + " FROM STDIN WITH (FORMAT binary)").c_str()),
+      &PQclear};
+  if (PQresultStatus(start.get()) != PGRES_COPY_IN) {
+    return PQresultErrorMessage(start.get());
+  }
+
+  std::string error;
+  if (PQputCopyData(conn, kCopyHeader, sizeof(kCopyHeader) - 1) != 1
+      or PQputCopyData(conn,
+                       data.tuples.data(),
+                       static_cast<int>(data.tuples.size()))
+          != 1
+      or PQputCopyData(conn, kCopyTrailer, sizeof(kCopyTrailer) - 1) != 1) {
+    error = PQerrorMessage(conn);
+    PQputCopyEnd(conn, error.c_str());
+  } else if (PQputCopyEnd(conn, nullptr) != 1) {
+    error = PQerrorMessage(conn);
+  }
 
-  } catch (const std::exception &e) {
-    return e.what();
+  // the result of COPY is available only after all data has been sent
+  while (auto *result = PQgetResult(conn)) {
+    PgResultPtr result_ptr{result, &PQclear};
+    if (PQresultStatus(result) != PGRES_COMMAND_OK and error.empty()) {
+      error = PQresultErrorMessage(result);
+    }
+  }
+  if (not error.empty()) {
+    return error;
   }
+
+  data.tuples.clear();
+  data.count = 0;
   return {};
 }
+
+iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
+  return copy("tx_status_by_hash (hash, status)", tx_hash_status_) | [this] {
+    return copy(
+        "tx_positions "
+        "(creator_id, hash, asset_id, ts, height, index, tx_offset, tx_size)",
+        tx_positions_);
+  };
+}
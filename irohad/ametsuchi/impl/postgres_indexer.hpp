@@ -9,7 +9,6 @@
 #include "ametsuchi/indexer.hpp"
 
 #include <string>
-#include <vector>
 
 namespace soci {
   class session;
@@ -39,21 +38,23 @@ namespace iroha {
       iroha::expected::Result<void, std::string> flush() override;
 
      private:
-      struct {
-        std::vector<std::string> hash;
-        std::vector<std::string> status;
-      } tx_hash_status_;
-
-      struct {
-        std::vector<shared_model::interface::types::AccountIdType> account;
-        std::vector<std::string> hash;
-        std::vector<
-            boost::optional<shared_model::interface::types::AssetIdType>>
-            asset_id;
-        std::vector<shared_model::interface::types::TimestampType> ts;
-        std::vector<size_t> height;
-        std::vector<size_t> index;
-      } tx_positions_;
+      /// Tuples of a table in postgres binary COPY format
+      struct CopyData {
+        std::string tuples;
+        size_t count = 0;
+      };
+
+      CopyData tx_hash_status_;
+      CopyData tx_positions_;
+
+      /**
+       * Write the collected tuples with COPY FROM STDIN
+       * @param table - table name followed by the list of columns
+       * @param data - tuples to write, cleared on success
+       * @return error message in case of failure
+       */
+      iroha::expected::Result<void, std::string> copy(const std::string &table,
+                                                      CopyData &data);
 
       /// Index tx status by its hash.
       void txHashStatus(const shared_model::interface::types::HashType &tx_hash,
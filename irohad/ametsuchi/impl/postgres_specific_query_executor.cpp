@@ -440,6 +440,8 @@ namespace iroha {
         Permissions... perms) {
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
                                    uint64_t,
+                                   uint64_t,
+                                   uint32_t,
                                    uint64_t>;
       using PermissionTuple = boost::tuple<int>;
       const auto &pagination_info = q.paginationMeta();
@@ -450,14 +452,17 @@ namespace iroha {
       char const *base = R"(WITH
                {0},
                my_txs AS (
-                 SELECT DISTINCT ROW_NUMBER() OVER({1}) AS row, hash, ts, height, index
+                 SELECT DISTINCT ROW_NUMBER() OVER({1}) AS row, hash, ts, height, index,
+                   coalesce(tx_offset, 0) AS tx_offset,
+                   coalesce(tx_size, 0) AS tx_size
                  FROM tx_positions
                  WHERE
                  {2} -- related_txs
                  {1} -- ordering
                  ),
                total_size AS (SELECT COUNT(*) FROM my_txs) {3}
-               SELECT my_txs.height, my_txs.index, count, perm FROM my_txs
+               SELECT my_txs.height, my_txs.index, my_txs.tx_offset,
+                 my_txs.tx_size, count, perm FROM my_txs
                {4}
                RIGHT OUTER JOIN has_perms ON TRUE
                JOIN total_size ON TRUE
@@ -479,7 +484,7 @@ namespace iroha {
           (ordering_str_.empty() ? "" : ordering_str_.c_str()),
           related_txs,
           (first_hash
-               ? R"(, base_row AS(SELECT row FROM my_txs WHERE hash = :hash LIMIT 1))"
+               ? R"(, base_row AS(SELECT row FROM my_txs WHERE hash = decode(:hash, 'hex') LIMIT 1))"
                : ""),
           (first_hash ? R"(JOIN base_row ON my_txs.row >= base_row.row)" : ""));
 
@@ -490,31 +495,41 @@ namespace iroha {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             uint64_t total_size = 0;
             if (not boost::empty(range_without_nulls)) {
-              total_size = boost::get<2>(*range_without_nulls.begin());
+              total_size = boost::get<4>(*range_without_nulls.begin());
             }
-            std::map<uint64_t, std::vector<uint64_t>> index;
-            // unpack results to get map from block height to index of tx in
-            // a block
+            std::map<uint64_t, std::vector<BlockStorage::TxLocation>> index;
+            // unpack results to get map from block height to locations of
+            // txs in a block
             for (const auto &t : range_without_nulls) {
               iroha::ametsuchi::apply(
-                  t, [&index](auto &height, auto &idx, auto &) {
-                    index[height].push_back(idx);
+                  t,
+                  [&index](auto &height,
+                           auto &idx,
+                           auto &offset,
+                           auto &size,
+                           auto &) {
+                    index[height].push_back(
+                        BlockStorage::TxLocation{idx, offset, size});
                   });
             }
 
             std::vector<std::unique_ptr<shared_model::interface::Transaction>>
                 response_txs;
-            // get transactions corresponding to indexes
+            // get transactions by their locations, so that only the bytes of
+            // the requested transactions are read if the storage supports it
             for (auto &block : index) {
-              auto txs_result = this->getTransactionsFromBlock(
-                  block.first,
-                  [&block](auto) { return block.second; },
-                  [](auto &) { return true; },
-                  std::back_inserter(response_txs));
-              if (auto e = iroha::expected::resultToOptionalError(txs_result)) {
+              auto txs = block_store_.fetchTransactions(block.first,
+                                                        block.second);
+              if (not txs) {
+                auto error = fmt::format(
+                    "Failed to retrieve transactions from block height {}.",
+                    block.first);
                 return this->logAndReturnErrorResponse(
-                    QueryErrorType::kStatefulFailed, e.value(), 1, query_hash);
+                    QueryErrorType::kStatefulFailed, error, 1, query_hash);
               }
+              std::move(txs->begin(),
+                        txs->end(),
+                        std::back_inserter(response_txs));
             }
 
             if (response_txs.empty()) {
@@ -573,7 +588,17 @@ namespace iroha {
       auto cmd =
           fmt::format(R"(WITH {},
       t AS (
-          SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
+          SELECT a.account_id, a.domain_id, a.quorum,
+              COALESCE((
+                  SELECT jsonb_object_agg(writer, details)
+                  FROM (
+                      SELECT writer, jsonb_object_agg(key, value) details
+                      FROM account_has_detail
+                      WHERE account_id = a.account_id
+                      GROUP BY writer
+                  ) d
+              ), '{{}}'::jsonb) AS data,
+              ARRAY_AGG(ar.role_id) AS roles
           FROM account AS a, account_has_roles AS ar
           WHERE a.account_id = :target_account_id
           AND ar.account_id = a.account_id
@@ -767,7 +792,9 @@ namespace iroha {
       std::string hash_str = boost::algorithm::join(
           q.transactionHashes()
               | boost::adaptors::transformed(
-                    [](const auto &h) { return "'" + h.hex() + "'"; }),
+                    [](const auto &h) {
+                      return "decode('" + h.hex() + "', 'hex')";
+                    }),
           ", ");
 
       using QueryTuple =
@@ -778,7 +805,8 @@ namespace iroha {
           R"(WITH has_my_perm AS ({}),
       has_all_perm AS ({}),
       t AS (
-          SELECT DISTINCT height, hash FROM tx_positions WHERE hash IN ({})
+          SELECT DISTINCT height, encode(hash, 'hex') AS hash
+          FROM tx_positions WHERE hash IN ({})
       )
       SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
@@ -1040,55 +1068,60 @@ namespace iroha {
           fmt::format(R"(
       with {},
       detail AS (
-          with filtered_plain_data as (
-              select row_number() over () rn, *
+          -- the page and the record following it, read in the order of the
+          -- primary key from the first record, which must exist
+          page_plain_data as (
+              select
+                  row_number() over (order by t.writer asc, t.key asc) rn,
+                  t.*
               from (
-                  select
-                      data_by_writer.key writer,
-                      plain_data.key as key,
-                      plain_data.value as value
-                  from
-                      jsonb_each((
-                          select data
-                          from account
-                          where account_id = :account_id
-                      )) data_by_writer,
-                  jsonb_each(data_by_writer.value) plain_data
+                  select writer, key, value
+                  from account_has_detail
                   where
-                      coalesce(data_by_writer.key = :writer, true) and
-                      coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
+                      account_id = :account_id and
+                      coalesce(writer = :writer, true) and
+                      coalesce(key = :key, true) and
+                      (writer, key) >= (
+                          coalesce(:first_record_writer, ''),
+                          coalesce(:first_record_key, '')) and
+                      exists (
+                          select 1
+                          from account_has_detail
+                          where
+                              account_id = :account_id and
+                              coalesce(writer = :writer, true) and
+                              coalesce(key = :key, true) and
+                              coalesce(writer = :first_record_writer, true) and
+                              coalesce(key = :first_record_key, true)
+                      )
+                  order by writer asc, key asc
+                  limit :page_size + 1
               ) t
           ),
-          page_limits as (
-              select start.rn as start, start.rn + :page_size as end
-                  from (
-                      select rn
-                      from filtered_plain_data
-                      where
-                          coalesce(writer = :first_record_writer, true) and
-                          coalesce(key = :first_record_key, true)
-                      limit 1
-                  ) start
+          -- counted separately from the page, so it still scans all the
+          -- matching details of the account
+          total_number as (
+              select count(1) total_number
+              from account_has_detail
+              where
+                  account_id = :account_id and
+                  coalesce(writer = :writer, true) and
+                  coalesce(key = :key, true)
           ),
-          total_number as (select count(1) total_number from filtered_plain_data),
           next_record as (
               select writer, key
-              from
-                  filtered_plain_data,
-                  page_limits
-              where rn = page_limits.end
+              from page_plain_data
+              where rn = :page_size + 1
           ),
           page as (
-              select json_object_agg(writer, data_by_writer) json
+              select
+                  json_object_agg(writer, data_by_writer order by writer) json
               from (
-                  select writer, json_object_agg(key, value) data_by_writer
-                  from
-                      filtered_plain_data,
-                      page_limits
-                  where
-                      rn >= page_limits.start and
-                      coalesce(rn < page_limits.end, true)
+                  select
+                      writer,
+                      json_object_agg(key, value order by key) data_by_writer
+                  from page_plain_data
+                  where coalesce(rn <= :page_size, true)
                   group by writer
               ) t
           ),
@@ -1363,6 +1396,15 @@ namespace iroha {
         const shared_model::interface::GetPendingTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
+      // query replicas do not take part in MST and keep no pending storage
+      if (not pending_txs_storage_) {
+        return query_response_factory_->createErrorQueryResponse(
+            shared_model::interface::QueryResponseFactory::ErrorQueryType::
+                kStatefulFailed,
+            "Pending transactions are not available on this peer",
+            1,
+            query_hash);
+      }
       std::vector<std::unique_ptr<shared_model::interface::Transaction>>
           response_txs;
       if (q.paginationMeta()) {
@@ -1485,7 +1527,7 @@ namespace iroha {
               target as (
                 select distinct creator_id as t
                 from tx_positions
-                where hash=:tx_hash
+                where hash=decode(:tx_hash, 'hex')
               ),
               {}
             select
@@ -0,0 +1,343 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+
+#include <algorithm>
+
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/pool_wrapper.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "common/bind.hpp"
+#include "cryptography/hash_providers/sha3_256.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  /// Serial columns, which sequences are moved past the imported rows
+  const std::vector<std::pair<std::string, std::string>> kSerialColumns{
+      {"engine_calls", "call_id"}, {"burrow_tx_logs", "log_idx"}};
+
+  PGconn *getConnection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  /**
+   * Chain the hash of the chunks with the next chunk
+   * @param hash - raw bytes of the hash of the previous chunks
+   */
+  std::string chainHash(const std::string &hash,
+                        const std::string &table,
+                        const std::string &rows) {
+    std::string data;
+    data.reserve(hash.size() + table.size() + 1 + rows.size());
+    data.append(hash).append(table).push_back('\0');
+    data.append(rows);
+    return iroha::sha3_256(data).to_string();
+  }
+
+  /**
+   * Wait for the result of COPY, which has been completed on the client side
+   */
+  iroha::expected::Result<void, std::string> finishCopy(PGconn *conn) {
+    iroha::expected::Result<void, std::string> result =
+        iroha::expected::Value<void>{};
+    while (auto res = PgResultPtr{PQgetResult(conn), &PQclear}) {
+      if (PQresultStatus(res.get()) != PGRES_COMMAND_OK
+          and iroha::expected::hasValue(result)) {
+        result = iroha::expected::makeError(PQresultErrorMessage(res.get()));
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Read the rows of the table and pass them to the consumer by chunks
+   * @param hash - hash of the previous chunks, updated with the chunks of the
+   * table
+   * @return true if all the rows have been consumed, false if the consumer
+   * has stopped the export, or error
+   */
+  iroha::expected::Result<bool, std::string> exportTable(
+      soci::session &sql,
+      const std::string &table,
+      const WsvSnapshotExporter::ChunkConsumer &consumer,
+      std::string &hash) {
+    auto *conn = getConnection(sql);
+    PgResultPtr copy{
+        PQexec(conn,
+               ("COPY (SELECT * FROM " + table + " t ORDER BY t) TO STDOUT")
+                   .c_str()),
+        &PQclear};
+    if (PQresultStatus(copy.get()) != PGRES_COPY_OUT) {
+      return iroha::expected::makeError(
+          fmt::format("Failed to export table {}: {}",
+                      table,
+                      PQresultErrorMessage(copy.get())));
+    }
+
+    bool consumed = true;
+    std::string rows;
+    auto flush = [&] {
+      hash = chainHash(hash, table, rows);
+      consumed = consumer(table, std::move(rows));
+      rows.clear();
+    };
+    char *buffer = nullptr;
+    int length;
+    // the rest of the rows is skipped after the consumer has stopped, since
+    // COPY cannot be interrupted without the loss of the connection
+    while ((length = PQgetCopyData(conn, &buffer, 0)) > 0) {
+      if (consumed) {
+        rows.append(buffer, length);
+      }
+      PQfreemem(buffer);
+      if (consumed
+          and rows.size() >= PostgresWsvSnapshotExporter::kChunkSize) {
+        flush();
+      }
+    }
+    if (length == -2) {
+      return iroha::expected::makeError(fmt::format(
+          "Failed to export table {}: {}", table, PQerrorMessage(conn)));
+    }
+    if (consumed and not rows.empty()) {
+      flush();
+    }
+    return finishCopy(conn) | [&]() -> iroha::expected::Result<bool,
+                                                               std::string> {
+      return consumed;
+    };
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    const std::vector<std::string> &wsvSnapshotTables() {
+      static const std::vector<std::string> tables{
+          "top_block_info",
+          "role",
+          "domain",
+          "signatory",
+          "account",
+          "account_has_detail",
+          "account_has_signatory",
+          "peer",
+          "asset",
+          "account_has_asset",
+          "role_has_permissions",
+          "account_has_roles",
+          "account_has_grantable_permissions",
+          "setting",
+          "tx_positions",
+          "tx_status_by_hash",
+          "engine_calls",
+          "burrow_account_data",
+          "burrow_account_key_value",
+          "burrow_tx_logs",
+          "burrow_tx_logs_topics"};
+      return tables;
+    }
+
+    PostgresWsvSnapshotExporter::PostgresWsvSnapshotExporter(
+        std::shared_ptr<PoolWrapper> pool_wrapper, logger::LoggerPtr log)
+        : pool_wrapper_(std::move(pool_wrapper)), log_(std::move(log)) {}
+
+    expected::Result<WsvSnapshotInfo, std::string>
+    PostgresWsvSnapshotExporter::exportSnapshot(const ChunkConsumer &consumer) {
+      try {
+        soci::session sql(*pool_wrapper_->connection_pool_);
+        // rolled back on destruction
+        soci::transaction transaction(sql);
+        sql << "SET TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY";
+        auto result = PostgresWsvQuery(sql, log_).getTopBlockInfo() |
+                [&](auto &&top_block_info)
+            -> expected::Result<WsvSnapshotInfo, std::string> {
+          log_->info("Exporting WSV snapshot at height {}",
+                     top_block_info.height);
+          std::string hash;
+          for (const auto &table : wsvSnapshotTables()) {
+            auto exported = exportTable(sql, table, consumer, hash);
+            if (auto e = expected::resultToOptionalError(exported)) {
+              return std::move(e).value();
+            }
+            if (not exported.assumeValue()) {
+              return "WSV snapshot export has been stopped.";
+            }
+          }
+          return WsvSnapshotInfo{std::move(top_block_info),
+                                 shared_model::crypto::Hash(hash)};
+        };
+        return result;
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            fmt::format("Failed to export WSV snapshot: {}", e.what()));
+      }
+    }
+
+    PostgresWsvSnapshotImporter::PostgresWsvSnapshotImporter(
+        soci::session &sql, logger::LoggerPtr log)
+        : sql_(sql),
+          log_(std::move(log)),
+          table_index_(0),
+          started_(false),
+          copying_(false),
+          finished_(false),
+          committed_(false) {}
+
+    PostgresWsvSnapshotImporter::~PostgresWsvSnapshotImporter() {
+      if (started_ and not committed_) {
+        try {
+          if (copying_) {
+            PQputCopyEnd(getConnection(sql_), "WSV snapshot is discarded");
+            finishCopy(getConnection(sql_));
+          }
+          sql_ << "ROLLBACK";
+        } catch (const std::exception &e) {
+          log_->error("Failed to discard WSV snapshot: {}", e.what());
+        }
+      }
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshotImporter::begin() {
+      std::string tables;
+      for (const auto &table : wsvSnapshotTables()) {
+        tables.append(tables.empty() ? "" : ", ").append(table);
+      }
+      try {
+        sql_ << "BEGIN";
+        started_ = true;
+        sql_ << "TRUNCATE TABLE " + tables + " RESTART IDENTITY";
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            fmt::format("Failed to prepare WSV for snapshot: {}", e.what()));
+      }
+      return expected::Value<void>{};
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshotImporter::endCopy() {
+      if (not copying_) {
+        return expected::Value<void>{};
+      }
+      copying_ = false;
+      auto *conn = getConnection(sql_);
+      if (PQputCopyEnd(conn, nullptr) != 1) {
+        return expected::makeError(PQerrorMessage(conn));
+      }
+      return finishCopy(conn);
+    }
+
+    expected::Result<void, std::string>
+    PostgresWsvSnapshotImporter::importRows(const std::string &table,
+                                            const std::string &rows) {
+      if (finished_) {
+        return expected::makeError("WSV snapshot is already finished.");
+      }
+      const auto &tables = wsvSnapshotTables();
+      auto it = std::find(tables.begin() + table_index_, tables.end(), table);
+      if (it == tables.end()) {
+        return expected::makeError(fmt::format(
+            "Unexpected table {} in WSV snapshot after {}.",
+            table,
+            tables[table_index_]));
+      }
+      if (not started_) {
+        if (auto e = expected::resultToOptionalError(begin())) {
+          return expected::makeError(std::move(e).value());
+        }
+      }
+
+      auto *conn = getConnection(sql_);
+      const size_t index = it - tables.begin();
+      if (not copying_ or index != table_index_) {
+        if (auto e = expected::resultToOptionalError(endCopy())) {
+          return expected::makeError(std::move(e).value());
+        }
+        table_index_ = index;
+        PgResultPtr copy{
+            PQexec(conn, ("COPY " + table + " FROM STDIN").c_str()),
+            &PQclear};
+        if (PQresultStatus(copy.get()) != PGRES_COPY_IN) {
+          return expected::makeError(
+              fmt::format("Failed to import table {}: {}",
+                          table,
+                          PQresultErrorMessage(copy.get())));
+        }
+        copying_ = true;
+      }
+
+      hash_ = chainHash(hash_, table, rows);
+      if (PQputCopyData(conn, rows.data(), static_cast<int>(rows.size()))
+          != 1) {
+        return expected::makeError(fmt::format(
+            "Failed to import table {}: {}", table, PQerrorMessage(conn)));
+      }
+      return expected::Value<void>{};
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshotImporter::finish(
+        const WsvSnapshotInfo &info) {
+      if (not started_) {
+        return expected::makeError("WSV snapshot is empty.");
+      }
+      if (shared_model::crypto::Hash(hash_) != info.snapshot_hash) {
+        return expected::makeError(
+            fmt::format("WSV snapshot hash {} does not match the expected {}.",
+                        shared_model::crypto::Hash(hash_),
+                        info.snapshot_hash));
+      }
+      return endCopy() | [&] {
+        return PostgresWsvQuery(sql_, log_).getTopBlockInfo();
+      } | [&](const auto &top_block_info)
+                 -> expected::Result<void, std::string> {
+        if (top_block_info.height != info.top_block_info.height
+            or top_block_info.top_hash != info.top_block_info.top_hash) {
+          return fmt::format(
+              "WSV snapshot top block {} {} does not match the expected {} "
+              "{}.",
+              top_block_info.height,
+              top_block_info.top_hash,
+              info.top_block_info.height,
+              info.top_block_info.top_hash);
+        }
+        try {
+          for (const auto &column : kSerialColumns) {
+            sql_ << fmt::format(
+                "SELECT setval(pg_get_serial_sequence('{0}', '{1}'), "
+                "coalesce(max({1}), 0) + 1, false) FROM {0}",
+                column.first,
+                column.second);
+          }
+        } catch (const std::exception &e) {
+          return fmt::format("Failed to update sequences: {}", e.what());
+        }
+        finished_ = true;
+        return {};
+      };
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshotImporter::commit() {
+      if (not finished_) {
+        return expected::makeError("WSV snapshot is not finished.");
+      }
+      try {
+        sql_ << "COMMIT";
+        committed_ = true;
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            fmt::format("Failed to commit WSV snapshot: {}", e.what()));
+      }
+      log_->info("WSV snapshot is imported");
+      return expected::Value<void>{};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+#define IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    struct PoolWrapper;
+
+    /// Tables of WSV in the snapshot, in the order of their import
+    const std::vector<std::string> &wsvSnapshotTables();
+
+    /**
+     * Exports WSV with COPY of each table inside a single read only
+     * repeatable read transaction, so the rows of all the tables are from the
+     * same top block. The rows of a table are sorted, so the snapshots of the
+     * same WSV have the same hash on every peer
+     */
+    class PostgresWsvSnapshotExporter : public WsvSnapshotExporter {
+     public:
+      /// Maximal size of a chunk of rows, unless a single row is larger
+      static constexpr size_t kChunkSize = 1024 * 1024;
+
+      PostgresWsvSnapshotExporter(std::shared_ptr<PoolWrapper> pool_wrapper,
+                                  logger::LoggerPtr log);
+
+      expected::Result<WsvSnapshotInfo, std::string> exportSnapshot(
+          const ChunkConsumer &consumer) override;
+
+     private:
+      std::shared_ptr<PoolWrapper> pool_wrapper_;
+      logger::LoggerPtr log_;
+    };
+
+    /**
+     * Imports WSV with COPY of each table into the emptied WSV tables, in a
+     * single transaction
+     */
+    class PostgresWsvSnapshotImporter : public WsvSnapshotImporter {
+     public:
+      /**
+       * @param sql - session without an open transaction, which is used for
+       * the import exclusively until the importer is destroyed
+       */
+      PostgresWsvSnapshotImporter(soci::session &sql, logger::LoggerPtr log);
+
+      ~PostgresWsvSnapshotImporter() override;
+
+      expected::Result<void, std::string> importRows(
+          const std::string &table, const std::string &rows) override;
+
+      expected::Result<void, std::string> finish(
+          const WsvSnapshotInfo &info) override;
+
+      expected::Result<void, std::string> commit() override;
+
+     private:
+      /// Open the transaction and empty the WSV tables
+      expected::Result<void, std::string> begin();
+
+      /// Complete COPY of the current table, if any
+      expected::Result<void, std::string> endCopy();
+
+      soci::session &sql_;
+      logger::LoggerPtr log_;
+
+      /// Hash of the chunks loaded so far
+      std::string hash_;
+
+      /// Index of the table being loaded in wsvSnapshotTables()
+      size_t table_index_;
+
+      bool started_;
+      bool copying_;
+      bool finished_;
+      bool committed_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_SNAPSHOT_HPP
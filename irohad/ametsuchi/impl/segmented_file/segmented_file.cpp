@@ -0,0 +1,575 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_file/segmented_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <ciso646>
+#include <cstring>
+#include <limits>
+#include <set>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "common/files.hpp"
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using Identifier = SegmentedFile::Identifier;
+
+namespace {
+  const std::string kSegmentExtension = ".seg";
+  const std::string kIndexExtension = ".idx";
+
+  /// Record header: identifier, payload size and payload CRC-32
+  constexpr size_t kRecordHeaderSize = 12;
+
+  /// Index entry: record offset, identifier and payload size
+  constexpr size_t kIndexEntrySize = 16;
+
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  template <typename T>
+  void put(uint8_t *&dest, T value) {
+    std::memcpy(dest, &value, sizeof(value));
+    dest += sizeof(value);
+  }
+
+  template <typename T>
+  T take(const uint8_t *&src) {
+    T value;
+    std::memcpy(&value, src, sizeof(value));
+    src += sizeof(value);
+    return value;
+  }
+
+  bool writeAll(int fd, const uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto written = ::pwrite(fd, data, size, offset);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      data += written;
+      size -= written;
+      offset += written;
+    }
+    return true;
+  }
+
+  bool readAll(int fd, uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto read = ::pread(fd, data, size, offset);
+      if (read < 0 and errno == EINTR) {
+        continue;
+      }
+      if (read <= 0) {
+        return false;
+      }
+      data += read;
+      size -= read;
+      offset += read;
+    }
+    return true;
+  }
+
+  boost::filesystem::path segmentPath(const std::string &dir,
+                                      Identifier first_id,
+                                      const std::string &extension) {
+    return boost::filesystem::path{dir}
+        / (FlatFile::id_to_name(first_id) + extension);
+  }
+
+  /// Make creation and removal of files in the directory durable
+  void syncDirectory(const std::string &dir) {
+    auto fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd >= 0) {
+      ::fsync(fd);
+      ::close(fd);
+    }
+  }
+}  // namespace
+
+struct SegmentedFile::Segment {
+  Segment(const std::string &dir, Identifier first_id)
+      : data_path(segmentPath(dir, first_id, kSegmentExtension)),
+        index_path(segmentPath(dir, first_id, kIndexExtension)) {}
+
+  ~Segment() {
+    closeFiles();
+    if (mapping != nullptr) {
+      ::munmap(mapping, mapping_size);
+    }
+  }
+
+  void closeFiles() {
+    for (auto fd : {&data_fd, &index_fd}) {
+      if (*fd >= 0) {
+        ::close(*fd);
+        *fd = -1;
+      }
+    }
+  }
+
+  const boost::filesystem::path data_path;
+  const boost::filesystem::path index_path;
+
+  /// Number of records in the segment
+  uint32_t records = 0;
+  /// Size of the segment file
+  uint64_t size = 0;
+
+  /// Files are open only for the last segment, after the first append
+  int data_fd = -1;
+  int index_fd = -1;
+
+  uint8_t *mapping = nullptr;
+  size_t mapping_size = 0;
+};
+
+// ----------| public API |----------
+
+boost::optional<std::unique_ptr<SegmentedFile>> SegmentedFile::create(
+    const std::string &path,
+    logger::LoggerPtr log,
+    size_t segment_size,
+    size_t sync_interval) {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directory(path, err)) {
+    log->error("Cannot create storage dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+
+  std::set<Identifier> segments_found;
+  for (auto it = boost::filesystem::directory_iterator{path};
+       it != boost::filesystem::directory_iterator{};
+       ++it) {
+    const auto &file = it->path();
+    if (file.extension() != kSegmentExtension) {
+      continue;
+    }
+    if (auto id = FlatFile::name_to_id(file.stem().string())) {
+      segments_found.insert(*id);
+    }
+  }
+
+  auto storage =
+      std::make_unique<SegmentedFile>(path,
+                                      segment_size,
+                                      std::max<size_t>(sync_interval, 1),
+                                      private_tag{},
+                                      std::move(log));
+  for (auto first_id : segments_found) {
+    if (not storage->loadSegment(first_id)) {
+      return boost::none;
+    }
+  }
+  storage->log_->info("Loaded {} records from {} segments",
+                      storage->locations_.size(),
+                      storage->segments_.size());
+
+  return boost::optional<std::unique_ptr<SegmentedFile>>(std::move(storage));
+}
+
+bool SegmentedFile::add(Identifier id, const Bytes &blob) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  if (not locations_.empty() and id != first_id_ + locations_.size()) {
+    log_->warn("insertion for {} failed, because the next id is {}",
+               id,
+               first_id_ + locations_.size());
+    return false;
+  }
+  if (blob.size() > std::numeric_limits<uint32_t>::max()) {
+    log_->warn("insertion for {} failed, because it is too large", id);
+    return false;
+  }
+
+  if (segments_.empty() or segments_.back()->size >= segment_size_) {
+    if (not startSegment(id)) {
+      return false;
+    }
+  }
+  auto &segment = *segments_.back();
+  if (not openForAppend(segment)) {
+    return false;
+  }
+
+  const auto size = static_cast<uint32_t>(blob.size());
+  const auto offset = segment.size;
+  const uint64_t index_offset = segment.records * kIndexEntrySize;
+
+  uint8_t header[kRecordHeaderSize];
+  auto header_pos = header;
+  put(header_pos, id);
+  put(header_pos, size);
+  put(header_pos, checksum(blob.data(), blob.size()));
+
+  uint8_t entry[kIndexEntrySize];
+  auto entry_pos = entry;
+  put(entry_pos, offset);
+  put(entry_pos, id);
+  put(entry_pos, size);
+
+  if (not writeAll(segment.data_fd, header, kRecordHeaderSize, offset)
+      or not writeAll(
+             segment.data_fd, blob.data(), size, offset + kRecordHeaderSize)
+      or not writeAll(
+             segment.index_fd, entry, kIndexEntrySize, index_offset)) {
+    log_->warn("Cannot write record {}: {}", id, std::strerror(errno));
+    // incomplete records are dropped on load anyway, so just try to keep
+    // the files clean
+    if (::ftruncate(segment.data_fd, offset) != 0
+        or ::ftruncate(segment.index_fd, index_offset) != 0) {
+      log_->warn("Cannot drop incomplete record {}", id);
+    }
+    return false;
+  }
+
+  if (locations_.empty()) {
+    first_id_ = id;
+  }
+  locations_.push_back({static_cast<uint32_t>(segments_.size() - 1),
+                        size,
+                        offset + kRecordHeaderSize});
+  segment.size += kRecordHeaderSize + size;
+  ++segment.records;
+
+  if (++unsynced_ >= sync_interval_) {
+    syncAppended();
+  }
+  return true;
+}
+
+boost::optional<SegmentedFile::Bytes> SegmentedFile::get(Identifier id) const {
+  return readPart(id, 0, boost::none);
+}
+
+boost::optional<SegmentedFile::Bytes> SegmentedFile::get(Identifier id,
+                                                         uint64_t offset,
+                                                         uint32_t size) const {
+  return readPart(id, offset, size);
+}
+
+std::string SegmentedFile::directory() const {
+  return dump_dir_;
+}
+
+Identifier SegmentedFile::last_id() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return locations_.empty() ? 0 : first_id_ + locations_.size() - 1;
+}
+
+void SegmentedFile::dropAll() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  segments_.clear();
+  locations_.clear();
+  unsynced_ = 0;
+  iroha::remove_dir_contents(dump_dir_, log_);
+}
+
+Identifier SegmentedFile::first_id() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return locations_.empty() ? 0 : first_id_;
+}
+
+size_t SegmentedFile::size() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return locations_.size();
+}
+
+void SegmentedFile::sync() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  syncAppended();
+}
+
+// ----------| private API |----------
+
+SegmentedFile::SegmentedFile(std::string path,
+                             size_t segment_size,
+                             size_t sync_interval,
+                             SegmentedFile::private_tag,
+                             logger::LoggerPtr log)
+    : dump_dir_(std::move(path)),
+      segment_size_(segment_size),
+      sync_interval_(sync_interval),
+      first_id_(0),
+      unsynced_(0),
+      log_{std::move(log)} {}
+
+SegmentedFile::~SegmentedFile() {
+  syncAppended();
+}
+
+bool SegmentedFile::loadSegment(Identifier first_id) {
+  const auto expected_first_id = first_id_ + locations_.size();
+  if (not locations_.empty() and first_id != expected_first_id) {
+    log_->error("Segment {} does not follow record {}",
+                first_id,
+                expected_first_id - 1);
+    return false;
+  }
+
+  auto segment = std::make_unique<Segment>(dump_dir_, first_id);
+  const auto &path = segment->data_path.string();
+  segment->data_fd = ::open(path.c_str(), O_RDWR);
+  struct stat file_stat {};
+  if (segment->data_fd < 0 or ::fstat(segment->data_fd, &file_stat) != 0) {
+    log_->error("Cannot open segment {}: {}", path, std::strerror(errno));
+    return false;
+  }
+  const uint64_t file_size = file_stat.st_size;
+
+  const auto segment_index = static_cast<uint32_t>(segments_.size());
+  std::vector<Location> locations;
+  auto next_id = first_id;
+  uint64_t offset = 0;
+
+  // take records from the index while it matches the segment
+  auto index = iroha::expected::resultToOptionalValue(
+                   iroha::readBinaryFile(segment->index_path))
+                   .value_or(Bytes{});
+  const uint8_t *entry = index.data();
+  for (size_t i = 0; i < index.size() / kIndexEntrySize; ++i) {
+    const auto entry_offset = take<uint64_t>(entry);
+    const auto id = take<uint32_t>(entry);
+    const auto size = take<uint32_t>(entry);
+    if (entry_offset != offset or id != next_id
+        or offset + kRecordHeaderSize + size > file_size) {
+      break;
+    }
+    locations.push_back({segment_index, size, offset + kRecordHeaderSize});
+    offset += kRecordHeaderSize + size;
+    ++next_id;
+  }
+  const bool index_valid = index.size() == locations.size() * kIndexEntrySize;
+
+  // recover records written after the last index update
+  Bytes payload;
+  uint8_t header[kRecordHeaderSize];
+  while (offset + kRecordHeaderSize <= file_size
+         and readAll(segment->data_fd, header, kRecordHeaderSize, offset)) {
+    const uint8_t *header_pos = header;
+    const auto id = take<uint32_t>(header_pos);
+    const auto size = take<uint32_t>(header_pos);
+    const auto crc = take<uint32_t>(header_pos);
+    if (id != next_id or offset + kRecordHeaderSize + size > file_size) {
+      break;
+    }
+    payload.resize(size);
+    if (not readAll(segment->data_fd,
+                    payload.data(),
+                    size,
+                    offset + kRecordHeaderSize)
+        or checksum(payload.data(), size) != crc) {
+      break;
+    }
+    locations.push_back({segment_index, size, offset + kRecordHeaderSize});
+    offset += kRecordHeaderSize + size;
+    ++next_id;
+  }
+
+  if (offset < file_size) {
+    log_->warn("Dropping {} bytes of incomplete records from segment {}",
+               file_size - offset,
+               path);
+    if (::ftruncate(segment->data_fd, offset) != 0) {
+      log_->error("Cannot truncate segment {}: {}", path, std::strerror(errno));
+      return false;
+    }
+  }
+  segment->closeFiles();
+
+  if (locations.empty()) {
+    // the segment was created right before a crash
+    boost::system::error_code err;
+    boost::filesystem::remove(segment->data_path, err);
+    boost::filesystem::remove(segment->index_path, err);
+    return true;
+  }
+
+  if (not index_valid) {
+    log_->info("Rebuilding index of segment {}", path);
+    index.resize(locations.size() * kIndexEntrySize);
+    auto index_pos = index.data();
+    for (size_t i = 0; i < locations.size(); ++i) {
+      put(index_pos, locations[i].offset - kRecordHeaderSize);
+      put(index_pos, static_cast<uint32_t>(first_id + i));
+      put(index_pos, locations[i].size);
+    }
+    const auto &index_path = segment->index_path.string();
+    auto fd = ::open(index_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    const bool written = fd >= 0
+        and writeAll(fd, index.data(), index.size(), 0) and ::fsync(fd) == 0;
+    if (fd >= 0) {
+      ::close(fd);
+    }
+    if (not written) {
+      log_->error(
+          "Cannot write index {}: {}", index_path, std::strerror(errno));
+      return false;
+    }
+  }
+
+  segment->records = locations.size();
+  segment->size = offset;
+  if (locations_.empty()) {
+    first_id_ = first_id;
+  }
+  locations_.insert(locations_.end(), locations.begin(), locations.end());
+  segments_.push_back(std::move(segment));
+  return true;
+}
+
+bool SegmentedFile::startSegment(Identifier first_id) {
+  if (not segments_.empty()) {
+    syncAppended();
+    segments_.back()->closeFiles();
+  }
+
+  auto segment = std::make_unique<Segment>(dump_dir_, first_id);
+  const auto &path = segment->data_path.string();
+  const auto &index_path = segment->index_path.string();
+  segment->data_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+  segment->index_fd =
+      ::open(index_path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+  if (segment->data_fd < 0 or segment->index_fd < 0) {
+    log_->warn("Cannot create segment {}: {}", path, std::strerror(errno));
+    segment->closeFiles();
+    boost::system::error_code err;
+    boost::filesystem::remove(segment->data_path, err);
+    boost::filesystem::remove(segment->index_path, err);
+    return false;
+  }
+  syncDirectory(dump_dir_);
+
+  segments_.push_back(std::move(segment));
+  return true;
+}
+
+bool SegmentedFile::openForAppend(Segment &segment) {
+  if (segment.data_fd >= 0) {
+    return true;
+  }
+  const auto &path = segment.data_path.string();
+  const auto &index_path = segment.index_path.string();
+  segment.data_fd = ::open(path.c_str(), O_RDWR);
+  segment.index_fd = ::open(index_path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (segment.data_fd < 0 or segment.index_fd < 0) {
+    log_->warn("Cannot open segment {}: {}", path, std::strerror(errno));
+    segment.closeFiles();
+    return false;
+  }
+  return true;
+}
+
+bool SegmentedFile::map(Segment &segment, uint64_t end) const {
+  if (segment.mapping != nullptr) {
+    ::munmap(segment.mapping, segment.mapping_size);
+    segment.mapping = nullptr;
+    segment.mapping_size = 0;
+  }
+
+  // the last segment is mapped up to the segment size, so that it is not
+  // remapped after every append. Pages past the end of file are never read
+  size_t size = std::max(end, segment.size);
+  if (&segment == segments_.back().get()) {
+    size = std::max(size, segment_size_);
+  }
+
+  const auto &path = segment.data_path.string();
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    log_->error("Cannot open segment {}: {}", path, std::strerror(errno));
+    return false;
+  }
+  auto mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    log_->error("Cannot map segment {}: {}", path, std::strerror(errno));
+    return false;
+  }
+
+  segment.mapping = static_cast<uint8_t *>(mapping);
+  segment.mapping_size = size;
+  return true;
+}
+
+boost::optional<SegmentedFile::Bytes> SegmentedFile::readPart(
+    Identifier id, uint64_t offset, boost::optional<uint32_t> size) const {
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto location = locate(id, offset, size);
+    if (not location) {
+      log_->info("get({}) record not found", id);
+      return boost::none;
+    }
+    if (location->offset + location->size
+        <= segments_[location->segment]->mapping_size) {
+      return read(*location);
+    }
+  }
+
+  // the segment has to be (re)mapped first
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  auto location = locate(id, offset, size);
+  if (not location) {
+    return boost::none;
+  }
+  auto &segment = *segments_[location->segment];
+  const auto end = location->offset + location->size;
+  if (segment.mapping_size < end and not map(segment, end)) {
+    return boost::none;
+  }
+  return read(*location);
+}
+
+boost::optional<SegmentedFile::Location> SegmentedFile::locate(
+    Identifier id, uint64_t offset, boost::optional<uint32_t> size) const {
+  if (locations_.empty() or id < first_id_
+      or id - first_id_ >= locations_.size()) {
+    return boost::none;
+  }
+  auto location = locations_[id - first_id_];
+  if (offset > location.size
+      or (size and *size > location.size - offset)) {
+    return boost::none;
+  }
+  location.offset += offset;
+  location.size = size.value_or(location.size - offset);
+  return location;
+}
+
+SegmentedFile::Bytes SegmentedFile::read(const Location &location) const {
+  const auto data = segments_[location.segment]->mapping + location.offset;
+  return Bytes(data, data + location.size);
+}
+
+void SegmentedFile::syncAppended() {
+  if (unsynced_ == 0 or segments_.empty()) {
+    return;
+  }
+  auto &segment = *segments_.back();
+  if ((segment.data_fd >= 0 and ::fsync(segment.data_fd) != 0)
+      or (segment.index_fd >= 0 and ::fsync(segment.index_fd) != 0)) {
+    log_->error("Cannot sync segment {}: {}",
+                segment.data_path.string(),
+                std::strerror(errno));
+  }
+  unsynced_ = 0;
+}
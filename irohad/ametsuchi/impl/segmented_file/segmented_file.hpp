@@ -0,0 +1,197 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_FILE_HPP
+#define IROHA_SEGMENTED_FILE_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Append-only storage which keeps records in large segment files instead
+     * of a file per record. Every segment has an index file with offsets of
+     * its records, so opening the storage does not read the records
+     * themselves. Records are read through memory mappings of the segments.
+     *
+     * Identifiers must be added sequentially, the first one may be arbitrary.
+     */
+    class SegmentedFile : public KeyValueStorage {
+      /**
+       * Private tag used to construct unique and shared pointers
+       * without new operator
+       */
+      struct private_tag {};
+
+     public:
+      // ----------| public API |----------
+
+      /// Size of a segment in bytes after which a new segment is started
+      static constexpr size_t kDefaultSegmentSize = 64 * 1024 * 1024;
+
+      /// Number of added records after which the files are synced to disk
+      static constexpr size_t kDefaultSyncInterval = 16;
+
+      /**
+       * Create storage in path. Records which were not completely written,
+       * e.g. because of a crash, are dropped.
+       * @param path - target path for creating
+       * @param log - logger
+       * @param segment_size - size of a segment in bytes after which a new
+       * segment is started
+       * @param sync_interval - number of added records after which the files
+       * are synced to disk. Records which are not synced yet can be lost on a
+       * power failure
+       * @return created storage
+       */
+      static boost::optional<std::unique_ptr<SegmentedFile>> create(
+          const std::string &path,
+          logger::LoggerPtr log,
+          size_t segment_size = kDefaultSegmentSize,
+          size_t sync_interval = kDefaultSyncInterval);
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      /**
+       * Read a part of the record without copying the rest of it
+       * @param id - identifier of the record
+       * @param offset - offset of the part in the record
+       * @param size - size of the part
+       * @return bytes of the part, boost::none if the record is not stored or
+       * it is shorter than offset + size
+       */
+      boost::optional<Bytes> get(Identifier id,
+                                 uint64_t offset,
+                                 uint32_t size) const;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      void dropAll() override;
+
+      /**
+       * @return first stored identifier, 0 if the storage is empty
+       */
+      Identifier first_id() const;
+
+      /**
+       * @return number of stored records
+       */
+      size_t size() const;
+
+      /**
+       * Sync all added records to disk
+       */
+      void sync();
+
+      // ----------| modify operations |----------
+
+      SegmentedFile(const SegmentedFile &rhs) = delete;
+
+      SegmentedFile(SegmentedFile &&rhs) = delete;
+
+      SegmentedFile &operator=(const SegmentedFile &rhs) = delete;
+
+      SegmentedFile &operator=(SegmentedFile &&rhs) = delete;
+
+      // ----------| private API |----------
+
+      /**
+       * Create storage in path
+       * @param path - folder of storage
+       * @param segment_size - @see create
+       * @param sync_interval - @see create
+       * @param log to print progress
+       */
+      SegmentedFile(std::string path,
+                    size_t segment_size,
+                    size_t sync_interval,
+                    SegmentedFile::private_tag,
+                    logger::LoggerPtr log);
+
+      ~SegmentedFile();
+
+     private:
+      struct Segment;
+
+      /// Position of a record payload
+      struct Location {
+        uint32_t segment;
+        uint32_t size;
+        uint64_t offset;
+      };
+
+      /**
+       * Load the segment starting with the given id, recovering the records
+       * missing in its index and dropping incomplete ones
+       * @return false if the segment could not be loaded
+       */
+      bool loadSegment(Identifier first_id);
+
+      /// Start a new segment for the record with the given id
+      bool startSegment(Identifier first_id);
+
+      /// Open files of the last segment for appending
+      bool openForAppend(Segment &segment);
+
+      /// Map the segment so that at least `end` bytes are accessible
+      bool map(Segment &segment, uint64_t end) const;
+
+      /**
+       * @return location of the part of the record starting at offset, the
+       * rest of the record if size is not given, if it is stored
+       */
+      boost::optional<Location> locate(
+          Identifier id,
+          uint64_t offset = 0,
+          boost::optional<uint32_t> size = boost::none) const;
+
+      /// Read the part of the record, @see locate
+      boost::optional<Bytes> readPart(Identifier id,
+                                      uint64_t offset,
+                                      boost::optional<uint32_t> size) const;
+
+      /// Copy the record from a mapped segment
+      Bytes read(const Location &location) const;
+
+      /// Sync the records added to the last segment
+      void syncAppended();
+
+      /**
+       * Folder of storage
+       */
+      const std::string dump_dir_;
+
+      const size_t segment_size_;
+
+      const size_t sync_interval_;
+
+      std::vector<std::unique_ptr<Segment>> segments_;
+
+      Identifier first_id_;
+
+      /// Locations of records, starting with first_id_
+      std::vector<Location> locations_;
+
+      /// Number of added records which are not synced yet
+      size_t unsynced_;
+
+      mutable std::shared_timed_mutex mutex_;
+
+      logger::LoggerPtr log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_SEGMENTED_FILE_HPP
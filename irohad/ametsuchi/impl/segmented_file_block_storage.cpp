@@ -0,0 +1,116 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_file_block_storage.hpp"
+
+#include "ametsuchi/impl/block_transactions.hpp"
+#include "backend/protobuf/block.hpp"
+#include "common/bind.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+SegmentedFileBlockStorage::SegmentedFileBlockStorage(
+    std::unique_ptr<SegmentedFile> segmented_file,
+    std::shared_ptr<BlockTransportFactory> block_factory,
+    logger::LoggerPtr log)
+    : segmented_file_(std::move(segmented_file)),
+      block_factory_(std::move(block_factory)),
+      log_(std::move(log)) {}
+
+bool SegmentedFileBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  return segmented_file_->add(block->height(), block->blob().blob());
+}
+
+boost::optional<std::unique_ptr<shared_model::interface::Block>>
+SegmentedFileBlockStorage::fetch(
+    shared_model::interface::types::HeightType height) const {
+  auto storage_block = segmented_file_->get(height);
+  if (not storage_block) {
+    return boost::none;
+  }
+
+  iroha::protocol::Block block;
+  if (not block.mutable_block_v1()->ParseFromArray(storage_block->data(),
+                                                   storage_block->size())) {
+    log_->warn("Could not parse block at height {}", height);
+    return boost::none;
+  }
+
+  return block_factory_->createBlock(std::move(block))
+      .match(
+          [&](auto &&block) {
+            return boost::make_optional<
+                std::unique_ptr<shared_model::interface::Block>>(
+                std::move(block.value));
+          },
+          [&](const auto &error)
+              -> boost::optional<
+                  std::unique_ptr<shared_model::interface::Block>> {
+            log_->warn("Could not build block at height {}: {}",
+                       height,
+                       error.error);
+            return boost::none;
+          });
+}
+
+boost::optional<std::string> SegmentedFileBlockStorage::fetchSerialized(
+    shared_model::interface::types::HeightType height) const {
+  return segmented_file_->get(height) | [](const auto &bytes) {
+    return boost::make_optional(std::string(bytes.begin(), bytes.end()));
+  };
+}
+
+boost::optional<TransactionsType> SegmentedFileBlockStorage::fetchTransactions(
+    shared_model::interface::types::HeightType height,
+    const std::vector<TxLocation> &locations) const {
+  if (not allSizesKnown(locations)) {
+    return fetch(height) |
+        [&](const auto &block) { return pickTransactions(*block, locations); };
+  }
+
+  TransactionsType result;
+  result.reserve(locations.size());
+  for (const auto &location : locations) {
+    auto bytes = segmented_file_->get(height, location.offset, location.size);
+    if (not bytes) {
+      return boost::none;
+    }
+    const auto *data = reinterpret_cast<const std::byte *>(bytes->data());
+    auto transaction = parseTransaction({data, bytes->size()});
+    if (not transaction) {
+      log_->warn("Could not parse transaction {} of block at height {}",
+                 location.index,
+                 height);
+      return boost::none;
+    }
+    result.push_back(std::move(transaction));
+  }
+  return result;
+}
+
+size_t SegmentedFileBlockStorage::size() const {
+  return segmented_file_->size();
+}
+
+void SegmentedFileBlockStorage::clear() {
+  segmented_file_->dropAll();
+}
+
+void SegmentedFileBlockStorage::forEach(
+    iroha::ametsuchi::BlockStorage::FunctionType function) const {
+  if (segmented_file_->size() == 0) {
+    return;
+  }
+  for (auto height = segmented_file_->first_id(),
+            last_height = segmented_file_->last_id();
+       height <= last_height;
+       ++height) {
+    auto block = fetch(height);
+    BOOST_ASSERT(block);
+    function(std::move(*block));
+  }
+}
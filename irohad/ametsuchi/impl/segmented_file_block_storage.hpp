@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_FILE_BLOCK_STORAGE_HPP
+#define IROHA_SEGMENTED_FILE_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include "ametsuchi/impl/segmented_file/segmented_file.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    /**
+     * Block storage which keeps serialized protobuf blocks in a segmented
+     * append-only log
+     */
+    class SegmentedFileBlockStorage : public BlockStorage {
+     public:
+      using BlockTransportFactory = shared_model::proto::ProtoBlockFactory;
+
+      SegmentedFileBlockStorage(
+          std::unique_ptr<SegmentedFile> segmented_file,
+          std::shared_ptr<BlockTransportFactory> block_factory,
+          logger::LoggerPtr log);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::unique_ptr<shared_model::interface::Block>> fetch(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::string> fetchSerialized(
+          shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<
+          std::vector<std::unique_ptr<shared_model::interface::Transaction>>>
+      fetchTransactions(
+          shared_model::interface::types::HeightType height,
+          const std::vector<TxLocation> &locations) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+     private:
+      std::unique_ptr<SegmentedFile> segmented_file_;
+      std::shared_ptr<BlockTransportFactory> block_factory_;
+      logger::LoggerPtr log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_FILE_BLOCK_STORAGE_HPP
@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_file_block_storage_factory.hpp"
+
+#include "ametsuchi/impl/segmented_file_block_storage.hpp"
+
+using namespace iroha::ametsuchi;
+
+SegmentedFileBlockStorageFactory::SegmentedFileBlockStorageFactory(
+    std::function<std::string()> path_provider,
+    std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
+    logger::LoggerManagerTreePtr log_manager,
+    size_t segment_size,
+    size_t sync_interval)
+    : path_provider_(std::move(path_provider)),
+      block_factory_(std::move(block_factory)),
+      log_manager_(std::move(log_manager)),
+      segment_size_(segment_size),
+      sync_interval_(sync_interval) {}
+
+std::unique_ptr<BlockStorage> SegmentedFileBlockStorageFactory::create() {
+  auto segmented_file = SegmentedFile::create(
+      path_provider_(),
+      log_manager_->getChild("SegmentedFile")->getLogger(),
+      segment_size_,
+      sync_interval_);
+  if (not segmented_file) {
+    return nullptr;
+  }
+  return std::make_unique<SegmentedFileBlockStorage>(
+      std::move(segmented_file.get()),
+      block_factory_,
+      log_manager_->getChild("SegmentedFileBlockStorage")->getLogger());
+}
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_FILE_BLOCK_STORAGE_FACTORY_HPP
+#define IROHA_SEGMENTED_FILE_BLOCK_STORAGE_FACTORY_HPP
+
+#include "ametsuchi/block_storage_factory.hpp"
+
+#include "ametsuchi/impl/segmented_file/segmented_file.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "logger/logger_manager.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    class SegmentedFileBlockStorageFactory : public BlockStorageFactory {
+     public:
+      /**
+       * @param path_provider - provides the folder of the storage
+       * @param block_factory - factory to build fetched blocks
+       * @param log_manager - logger manager
+       * @param segment_size - @see SegmentedFile::create
+       * @param sync_interval - @see SegmentedFile::create
+       */
+      SegmentedFileBlockStorageFactory(
+          std::function<std::string()> path_provider,
+          std::shared_ptr<shared_model::proto::ProtoBlockFactory>
+              block_factory,
+          logger::LoggerManagerTreePtr log_manager,
+          size_t segment_size = SegmentedFile::kDefaultSegmentSize,
+          size_t sync_interval = SegmentedFile::kDefaultSyncInterval);
+      std::unique_ptr<BlockStorage> create() override;
+
+     private:
+      std::function<std::string()> path_provider_;
+      std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
+      logger::LoggerManagerTreePtr log_manager_;
+      size_t segment_size_;
+      size_t sync_interval_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_FILE_BLOCK_STORAGE_FACTORY_HPP
@@ -6,6 +6,8 @@
 #ifndef IROHA_POSTGRES_WSV_COMMON_HPP
 #define IROHA_POSTGRES_WSV_COMMON_HPP
 
+#include <string>
+
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
@@ -17,6 +19,32 @@
 namespace iroha {
   namespace ametsuchi {
 
+    /**
+     * Make postgres array literal of the given strings, so that an array is
+     * passed as a single statement parameter
+     * @param values - range of strings
+     * @return literal to be cast to an array in the statement
+     */
+    template <typename Range>
+    std::string makeArrayLiteral(const Range &values) {
+      std::string literal = "{";
+      for (const auto &value : values) {
+        if (literal.size() > 1) {
+          literal += ',';
+        }
+        literal += '"';
+        for (auto c : value) {
+          if (c == '"' or c == '\\') {
+            literal += '\\';
+          }
+          literal += c;
+        }
+        literal += '"';
+      }
+      literal += '}';
+      return literal;
+    }
+
     template <typename ParamType, typename Function>
     inline void processSoci(soci::statement &st,
                             soci::indicator &ind,
@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -14,6 +15,7 @@
 #include <boost/range/algorithm/replace_if.hpp>
 #include <boost/tuple/tuple.hpp>
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
+#include "ametsuchi/impl/pool_lane.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
@@ -27,6 +29,7 @@
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "backend/protobuf/permissions.hpp"
@@ -57,7 +60,8 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
         size_t pool_size,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        std::shared_ptr<WsvCache> wsv_cache)
         : block_store_(std::move(block_store)),
           pool_wrapper_(std::move(pool_wrapper)),
           connection_(pool_wrapper_->connection_pool_),
@@ -68,6 +72,7 @@ namespace iroha {
           temporary_block_storage_factory_(
               std::move(temporary_block_storage_factory)),
           vm_caller_ref_(std::move(vm_caller_ref)),
+          wsv_cache_(std::move(wsv_cache)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()),
           pool_size_(pool_size),
@@ -88,9 +93,14 @@ namespace iroha {
       // proposal. this means that any state prepared before that moment is
       // not needed and must be removed to prevent locking
       tryRollback(postgres_command_executor->getSession());
+      boost::optional<shared_model::interface::types::HashType> top_block_hash;
+      if (ledger_state_) {
+        top_block_hash = ledger_state_.value()->top_block_info.top_hash;
+      }
       return std::make_unique<TemporaryWsvImpl>(
           std::move(postgres_command_executor),
-          log_manager_->getChild("TemporaryWorldStateView"));
+          log_manager_->getChild("TemporaryWorldStateView"),
+          std::move(top_block_hash));
     }
 
     std::unique_ptr<MutableStorage> StorageImpl::createMutableStorage(
@@ -127,19 +137,24 @@ namespace iroha {
       if (not connection_) {
         return "createQueryExecutor: connection to database is not initialised";
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
-      auto log_manager = log_manager_->getChild("QueryExecutor");
-      return std::make_unique<PostgresQueryExecutor>(
-          std::move(sql),
-          response_factory,
-          std::make_shared<PostgresSpecificQueryExecutor>(
-              *sql,
-              *block_store_,
-              std::move(pending_txs_storage),
-              response_factory,
-              perm_converter_,
-              log_manager->getChild("SpecificQueryExecutor")->getLogger()),
-          log_manager->getLogger());
+      return leaseSession(pool_wrapper_->query_lane_) |
+          [&](auto &&sql) -> iroha::expected::
+                              Result<std::unique_ptr<QueryExecutor>,
+                                     std::string> {
+        auto log_manager = log_manager_->getChild("QueryExecutor");
+        auto &session = *sql;
+        return std::make_unique<PostgresQueryExecutor>(
+            std::move(sql),
+            response_factory,
+            std::make_shared<PostgresSpecificQueryExecutor>(
+                session,
+                *block_store_,
+                std::move(pending_txs_storage),
+                response_factory,
+                perm_converter_,
+                log_manager->getChild("SpecificQueryExecutor")->getLogger()),
+            log_manager->getLogger());
+      };
     }
 
     bool StorageImpl::insertBlock(
@@ -174,18 +189,23 @@ namespace iroha {
       if (connection_ == nullptr) {
         return expected::makeError("Connection was closed");
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
-      return std::make_unique<PostgresCommandExecutor>(
-          std::move(sql),
-          perm_converter_,
-          std::make_shared<PostgresSpecificQueryExecutor>(
-              *sql,
-              *block_store_,
-              pending_txs_storage_,
-              query_response_factory_,
-              perm_converter_,
-              log_manager_->getChild("SpecificQueryExecutor")->getLogger()),
-          vm_caller_ref_);
+      return leaseSession(pool_wrapper_->commit_lane_) |
+          [&](auto &&sql) -> expected::Result<std::unique_ptr<CommandExecutor>,
+                                              std::string> {
+        auto &session = *sql;
+        return std::make_unique<PostgresCommandExecutor>(
+            std::move(sql),
+            perm_converter_,
+            std::make_shared<PostgresSpecificQueryExecutor>(
+                session,
+                *block_store_,
+                pending_txs_storage_,
+                query_response_factory_,
+                perm_converter_,
+                log_manager_->getChild("SpecificQueryExecutor")->getLogger()),
+            vm_caller_ref_,
+            wsv_cache_);
+      };
     }
 
     std::unique_ptr<MutableStorage> StorageImpl::createMutableStorage(
@@ -243,9 +263,27 @@ namespace iroha {
         log_->debug("Closed connection {}", i);
       }
       sessions.clear();
+      for (const auto &lane :
+           {pool_wrapper_->validation_lane_, pool_wrapper_->query_lane_}) {
+        if (lane) {
+          lane->close();
+          log_->debug("Closed {} connections", lane->name());
+        }
+      }
       connection_.reset();
     }
 
+    expected::Result<std::unique_ptr<soci::session>, std::string>
+    StorageImpl::leaseSession(const std::shared_ptr<PoolLane> &lane) const {
+      if (lane) {
+        return lane->lease();
+      }
+      if (pool_wrapper_->commit_lane_) {
+        return pool_wrapper_->commit_lane_->lease();
+      }
+      return std::make_unique<soci::session>(*connection_);
+    }
+
     expected::Result<std::shared_ptr<StorageImpl>, std::string>
     StorageImpl::create(
         const ametsuchi::PostgresOptions &postgres_options,
@@ -259,7 +297,8 @@ namespace iroha {
         std::shared_ptr<BlockStorage> persistent_block_storage,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
         logger::LoggerManagerTreePtr log_manager,
-        size_t pool_size) {
+        size_t pool_size,
+        std::shared_ptr<WsvCache> wsv_cache) {
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state;
       {
         soci::session sql{*pool_wrapper->connection_pool_};
@@ -291,7 +330,8 @@ namespace iroha {
                           std::move(temporary_block_storage_factory),
                           pool_size,
                           std::move(vm_caller_ref),
-                          std::move(log_manager))));
+                          std::move(log_manager),
+                          std::move(wsv_cache))));
     }
 
     CommitResult StorageImpl::commit(
@@ -307,11 +347,32 @@ namespace iroha {
     }
 
     bool StorageImpl::preparedCommitEnabled() const {
-      return prepared_blocks_enabled_ and block_is_prepared_;
+      std::lock_guard<std::mutex> lock(prepared_mutex_);
+      return (prepared_blocks_enabled_ and block_is_prepared_)
+          or executed_wsv_ != nullptr;
+    }
+
+    bool StorageImpl::preparedStateMatches(
+        const shared_model::interface::Block &block) const {
+      const auto &txs = block.transactions();
+      return prepared_top_hash_ and *prepared_top_hash_ == block.prevHash()
+          and std::equal(prepared_txs_.begin(),
+                         prepared_txs_.end(),
+                         txs.begin(),
+                         txs.end(),
+                         [](const auto &hash, const auto &tx) {
+                           return hash == tx.hash();
+                         });
     }
 
     CommitResult StorageImpl::commitPrepared(
         std::shared_ptr<const shared_model::interface::Block> block) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      std::lock_guard<std::mutex> prepared_lock(prepared_mutex_);
+      if (executed_wsv_) {
+        return commitExecuted(std::move(block));
+      }
+
       if (not prepared_blocks_enabled_) {
         return expected::makeError(
             std::string{"prepared blocks are not enabled"});
@@ -321,17 +382,31 @@ namespace iroha {
         return expected::makeError("there are no prepared blocks");
       }
 
+      if (not preparedStateMatches(*block)) {
+        return expected::makeError(
+            (boost::format("prepared state does not match block %s")
+             % block->hash().hex())
+                .str());
+      }
+
       log_->info("applying prepared block");
 
       try {
-        std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
         if (not connection_) {
           std::string msg(
               "commitPrepared: connection to database is not initialised");
           return expected::makeError(std::move(msg));
         }
-        soci::session sql(*connection_);
+        auto session = leaseSession(pool_wrapper_->commit_lane_);
+        if (auto e = expected::resultToOptionalError(session)) {
+          return expected::makeError(std::move(e).value());
+        }
+        auto &sql = *session.assumeValue();
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
+        if (prepared_wsv_cache_) {
+          prepared_wsv_cache_->publish();
+          prepared_wsv_cache_.reset();
+        }
         PostgresBlockIndex block_index(
             std::make_unique<PostgresIndexer>(sql),
             log_manager_->getChild("BlockIndex")->getLogger());
@@ -344,23 +419,7 @@ namespace iroha {
           throw std::runtime_error(e.value());
         }
 
-        return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
-          decltype(
-              std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
-          {
-            auto peer_query = PostgresWsvQuery(
-                sql, this->log_manager_->getChild("WsvQuery")->getLogger());
-            if (not(opt_ledger_peers = peer_query.getPeers())) {
-              return expected::makeError(
-                  std::string{"Failed to get ledger peers! Will retry."});
-            }
-          }
-          assert(opt_ledger_peers);
-
-          ledger_state_ = std::make_shared<const LedgerState>(
-              std::move(*opt_ledger_peers), block->height(), block->hash());
-          return expected::makeValue(ledger_state_.value());
-        };
+        return finishPreparedCommit(sql, block);
       } catch (const std::exception &e) {
         std::string msg((boost::format("failed to apply prepared block %s: %s")
                          % block->hash().hex() % e.what())
@@ -369,15 +428,87 @@ namespace iroha {
       }
     }
 
+    CommitResult StorageImpl::commitExecuted(
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      // the executed state is dropped in any case: either it is committed, or
+      // the block has to be applied from scratch
+      auto wsv = std::move(executed_wsv_);
+      if (not preparedStateMatches(*block)) {
+        return expected::makeError(
+            (boost::format("executed state does not match block %s")
+             % block->hash().hex())
+                .str());
+      }
+
+      log_->info("committing executed state of block {}", block->hash().hex());
+
+      try {
+        soci::session &sql = wsv->sql_;
+        if (auto e = expected::resultToOptionalError(
+                wsv->command_executor_->flushWsvCache())) {
+          throw std::runtime_error(e.value());
+        }
+        PostgresBlockIndex block_index(
+            std::make_unique<PostgresIndexer>(sql),
+            log_manager_->getChild("BlockIndex")->getLogger());
+        block_index.index(*block);
+        if (auto e = expected::resultToOptionalError(
+                PostgresWsvCommand{sql}.setTopBlockInfo(
+                    TopBlockInfo{block->height(), block->hash()}))) {
+          throw std::runtime_error(e.value());
+        }
+
+        sql << "COMMIT";
+        wsv->committed_ = true;
+        wsv->wsv_cache_.publish();
+
+        return finishPreparedCommit(sql, block);
+      } catch (const std::exception &e) {
+        std::string msg((boost::format("failed to apply executed block %s: %s")
+                         % block->hash().hex() % e.what())
+                            .str());
+        return expected::makeError(msg);
+      }
+    }
+
+    CommitResult StorageImpl::finishPreparedCommit(
+        soci::session &sql,
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
+        decltype(std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
+        {
+          auto peer_query = PostgresWsvQuery(
+              sql, this->log_manager_->getChild("WsvQuery")->getLogger());
+          if (not(opt_ledger_peers = peer_query.getPeers())) {
+            return expected::makeError(
+                std::string{"Failed to get ledger peers! Will retry."});
+          }
+        }
+        assert(opt_ledger_peers);
+
+        ledger_state_ = std::make_shared<const LedgerState>(
+            std::move(*opt_ledger_peers), block->height(), block->hash());
+        return expected::makeValue(ledger_state_.value());
+      };
+    }
+
     std::shared_ptr<WsvQuery> StorageImpl::getWsvQuery() const {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
       if (not connection_) {
         log_->info("getWsvQuery: connection to database is not initialised");
         return nullptr;
       }
-      return std::make_shared<PostgresWsvQuery>(
-          std::make_unique<soci::session>(*connection_),
-          log_manager_->getChild("WsvQuery")->getLogger());
+      return leaseSession(pool_wrapper_->validation_lane_)
+          .match(
+              [&](auto &&sql) -> std::shared_ptr<WsvQuery> {
+                return std::make_shared<PostgresWsvQuery>(
+                    std::move(sql).value,
+                    log_manager_->getChild("WsvQuery")->getLogger());
+              },
+              [&](const auto &error) -> std::shared_ptr<WsvQuery> {
+                log_->error("getWsvQuery: {}", error.error);
+                return nullptr;
+              });
     }
 
     std::shared_ptr<BlockQuery> StorageImpl::getBlockQuery() const {
@@ -386,10 +517,18 @@ namespace iroha {
         log_->info("getBlockQuery: connection to database is not initialised");
         return nullptr;
       }
-      return std::make_shared<PostgresBlockQuery>(
-          std::make_unique<soci::session>(*connection_),
-          *block_store_,
-          log_manager_->getChild("PostgresBlockQuery")->getLogger());
+      return leaseSession(pool_wrapper_->validation_lane_)
+          .match(
+              [&](auto &&sql) -> std::shared_ptr<BlockQuery> {
+                return std::make_shared<PostgresBlockQuery>(
+                    std::move(sql).value,
+                    *block_store_,
+                    log_manager_->getChild("PostgresBlockQuery")->getLogger());
+              },
+              [&](const auto &error) -> std::shared_ptr<BlockQuery> {
+                log_->error("getBlockQuery: {}", error.error);
+                return nullptr;
+              });
     }
 
     boost::optional<std::unique_ptr<SettingQuery>>
@@ -400,11 +539,22 @@ namespace iroha {
             "getSettingQuery: connection to database is not initialised");
         return boost::none;
       }
-      std::unique_ptr<SettingQuery> setting_query_ptr =
-          std::make_unique<PostgresSettingQuery>(
-              std::make_unique<soci::session>(*connection_),
-              log_manager_->getChild("PostgresSettingQuery")->getLogger());
-      return boost::make_optional(std::move(setting_query_ptr));
+      return leaseSession(pool_wrapper_->validation_lane_)
+          .match(
+              [&](auto &&sql)
+                  -> boost::optional<std::unique_ptr<SettingQuery>> {
+                std::unique_ptr<SettingQuery> setting_query_ptr =
+                    std::make_unique<PostgresSettingQuery>(
+                        std::move(sql).value,
+                        log_manager_->getChild("PostgresSettingQuery")
+                            ->getLogger());
+                return boost::make_optional(std::move(setting_query_ptr));
+              },
+              [&](const auto &error)
+                  -> boost::optional<std::unique_ptr<SettingQuery>> {
+                log_->error("getSettingQuery: {}", error.error);
+                return boost::none;
+              });
     }
 
     rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
@@ -414,19 +564,35 @@ namespace iroha {
 
     void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
       auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
-      if (not prepared_blocks_enabled_) {
-        log_->warn("prepared blocks are not enabled");
-        return;
-      }
-      if (block_is_prepared_) {
+      std::lock_guard<std::mutex> lock(prepared_mutex_);
+      if (block_is_prepared_ or executed_wsv_) {
         log_->warn(
             "Refusing to add new prepared state, because there already is one. "
             "Multiple prepared states are not yet supported.");
+        return;
+      }
+      if (not wsv_impl.top_block_hash_) {
+        log_->warn("Not preparing state, since there is no top block");
+        return;
+      }
+      prepared_top_hash_ = wsv_impl.top_block_hash_;
+      prepared_txs_ = wsv_impl.applied_txs_;
+      if (not prepared_blocks_enabled_) {
+        // keep the database transaction of the proposal open, so that it is
+        // committed without executing the transactions once again
+        executed_wsv_.reset(static_cast<TemporaryWsvImpl *>(wsv.release()));
+        log_->info("state executed successfully");
       } else {
         soci::session &sql = wsv_impl.sql_;
+        if (auto e = expected::resultToOptionalError(
+                wsv_impl.command_executor_->flushWsvCache())) {
+          log_->warn("failed to flush WSV cache: {}", e.value());
+          return;
+        }
         try {
           sql << "PREPARE TRANSACTION '" + prepared_block_name_ + "';";
           block_is_prepared_ = true;
+          prepared_wsv_cache_ = wsv_impl.wsv_cache_.detachPrepared();
         } catch (const std::exception &e) {
           log_->warn("failed to prepare state: {}", e.what());
         }
@@ -450,15 +616,22 @@ namespace iroha {
     }
 
     void StorageImpl::tryRollback(soci::session &session) {
+      std::lock_guard<std::mutex> lock(prepared_mutex_);
+      // the executed state holds its own session, and rolls it back on
+      // destruction
+      executed_wsv_.reset();
       // TODO 17.06.2019 luckychess IR-568 split connection and schema
       // initialisation
       if (block_is_prepared_) {
         PgConnectionInit::rollbackPrepared(session, prepared_block_name_)
-            .match([this](auto &&v) { block_is_prepared_ = false; },
-                   [this](auto &&e) {
-                     log_->info("Block rollback  error: {}",
-                                std::move(e.error));
-                   });
+            .match(
+                [this](auto &&v) {
+                  block_is_prepared_ = false;
+                  prepared_wsv_cache_.reset();
+                },
+                [this](auto &&e) {
+                  log_->info("Block rollback  error: {}", std::move(e.error));
+                });
       }
     }
 
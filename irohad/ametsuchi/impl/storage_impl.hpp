@@ -9,7 +9,9 @@
 #include "ametsuchi/storage.hpp"
 
 #include <atomic>
+#include <mutex>
 #include <shared_mutex>
+#include <vector>
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
@@ -19,6 +21,7 @@
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -36,7 +39,10 @@ namespace iroha {
 
     class AmetsuchiTest;
     class PostgresOptions;
+    class TemporaryWsvImpl;
     class VmCaller;
+    class WsvCache;
+    class WsvCacheOverlay;
 
     class StorageImpl : public Storage {
      public:
@@ -52,7 +58,8 @@ namespace iroha {
           std::shared_ptr<BlockStorage> persistent_block_storage,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
           logger::LoggerManagerTreePtr log_manager,
-          size_t pool_size = 10);
+          size_t pool_size = 10,
+          std::shared_ptr<WsvCache> wsv_cache = nullptr);
 
       expected::Result<std::unique_ptr<CommandExecutor>, std::string>
       createCommandExecutor() override;
@@ -131,7 +138,8 @@ namespace iroha {
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
           size_t pool_size,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          std::shared_ptr<WsvCache> wsv_cache);
 
      private:
       using StoreBlockResult = iroha::expected::Result<void, std::string>;
@@ -145,10 +153,40 @@ namespace iroha {
           std::shared_ptr<const shared_model::interface::Block> block);
 
       /**
-       * Method tries to perform rollback on passed session
+       * Method tries to perform rollback on passed session, and drops the
+       * executed state if there is one
        */
       void tryRollback(soci::session &session);
 
+      /**
+       * Check that applying the block results in the prepared state, which
+       * is the case when the block is built on the same top block from the
+       * same transactions. Must be called with prepared_mutex_ locked
+       */
+      bool preparedStateMatches(
+          const shared_model::interface::Block &block) const;
+
+      /**
+       * Index the block and commit the executed state of the proposal it was
+       * built from. Must be called with prepared_mutex_ locked
+       */
+      CommitResult commitExecuted(
+          std::shared_ptr<const shared_model::interface::Block> block);
+
+      /**
+       * Take a connection of the lane, or of the commit lane if the lane has
+       * no connections of its own. Must be called with drop_mutex_ locked
+       */
+      expected::Result<std::unique_ptr<soci::session>, std::string>
+      leaseSession(const std::shared_ptr<PoolLane> &lane) const;
+
+      /**
+       * Store the committed block and update the ledger state
+       */
+      CommitResult finishPreparedCommit(
+          soci::session &sql,
+          std::shared_ptr<const shared_model::interface::Block> block);
+
       std::shared_ptr<BlockStorage> block_store_;
 
       std::shared_ptr<PoolWrapper> pool_wrapper_;
@@ -173,6 +211,9 @@ namespace iroha {
 
       std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref_;
 
+      /// committed WSV rows shared by command executors, nullptr if disabled
+      std::shared_ptr<WsvCache> wsv_cache_;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
 
@@ -186,6 +227,25 @@ namespace iroha {
 
       std::string prepared_block_name_;
 
+      /// WSV cache rows of the prepared block, published on its commit
+      std::unique_ptr<WsvCacheOverlay> prepared_wsv_cache_;
+
+      /**
+       * Validated proposal, which is kept uncommitted in its own database
+       * transaction when prepared transactions are disabled
+       */
+      std::unique_ptr<TemporaryWsvImpl> executed_wsv_;
+
+      /// Top block on which the prepared or executed state is built
+      boost::optional<shared_model::interface::types::HashType>
+          prepared_top_hash_;
+
+      /// Transactions applied in the prepared or executed state, in order
+      std::vector<shared_model::interface::types::HashType> prepared_txs_;
+
+      /// Guards the prepared and the executed states
+      mutable std::mutex prepared_mutex_;
+
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
     };
   }  // namespace ametsuchi
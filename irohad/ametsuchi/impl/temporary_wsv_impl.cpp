@@ -5,12 +5,21 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
-#include <boost/algorithm/string/join.hpp>
-#include <boost/format.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <algorithm>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/range/size.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/tx_executor.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
 #include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/common_objects/signature.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
@@ -20,53 +29,170 @@ namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::shared_ptr<PostgresCommandExecutor> command_executor,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        boost::optional<shared_model::interface::types::HashType>
+            top_block_hash)
         : sql_(command_executor->getSession()),
+          command_executor_(command_executor),
+          wsv_cache_(command_executor->getWsvCache()),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
+          top_block_hash_(std::move(top_block_hash)),
+          committed_(false),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()) {
       sql_ << "BEGIN";
+      wsv_cache_.begin();
     }
 
-    expected::Result<void, validation::CommandError>
-    TemporaryWsvImpl::validateSignatures(
-        const shared_model::interface::Transaction &transaction) {
-      auto keys_range = transaction.signatures()
-          | boost::adaptors::transformed(
-                            [](const auto &s) { return s.publicKey(); });
-      auto keys = boost::algorithm::join(keys_range, "'), ('");
-      // not using bool since it is not supported by SOCI
-      boost::optional<uint8_t> signatories_valid;
-
-      boost::format query(R"(SELECT sum(count) = :signatures_count
-                          AND sum(quorum) <= :signatures_count
-                  FROM
-                      (SELECT count(public_key)
-                      FROM ( VALUES ('%s') ) AS CTE1(public_key)
-                      WHERE lower(public_key) IN
-                          (SELECT public_key
-                          FROM account_has_signatory
-                          WHERE account_id = :account_id ) ) AS CTE2(count),
-                          (SELECT quorum
-                          FROM account
-                          WHERE account_id = :account_id) AS CTE3(quorum))");
+    namespace {
+      const std::string kSignatoriesQuery = R"(
+          SELECT account.account_id, account.quorum,
+                 account_has_signatory.public_key
+          FROM account
+          LEFT JOIN account_has_signatory
+              ON account_has_signatory.account_id = account.account_id
+          WHERE account.account_id = ANY(CAST(:account_ids AS text[])))";
+    }  // namespace
+
+    /**
+     * Statement which selects signatories of the accounts from account_ids
+     * row by row
+     */
+    class TemporaryWsvImpl::SignatoriesStatement {
+     public:
+      explicit SignatoriesStatement(soci::session &sql)
+          : statement((sql.prepare << kSignatoriesQuery,
+                       soci::use(account_ids, "account_ids"),
+                       soci::into(account_id),
+                       soci::into(quorum),
+                       soci::into(public_key, public_key_indicator))) {}
+
+      std::string account_ids;
+      std::string account_id;
+      int quorum;
+      std::string public_key;
+      soci::indicator public_key_indicator;
+      soci::statement statement;
+    };
+
+    expected::Result<void, std::string> TemporaryWsvImpl::fetchSignatories(
+        const std::vector<shared_model::interface::types::AccountIdType>
+            &account_ids) {
+      SignatoriesCacheType fetched;
+      for (const auto &account_id : account_ids) {
+        fetched.emplace(account_id, boost::none);
+      }
 
       try {
-        auto keys_range_size = boost::size(keys_range);
-        sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
+        if (not signatories_statement_) {
+          signatories_statement_ =
+              std::make_unique<SignatoriesStatement>(sql_);
+        }
+        auto &st = *signatories_statement_;
+        st.account_ids = makeArrayLiteral(account_ids);
+        st.statement.execute();
+        while (st.statement.fetch()) {
+          auto &signatories = fetched[st.account_id];
+          if (not signatories) {
+            signatories = AccountSignatories{
+                static_cast<shared_model::interface::types::QuorumType>(
+                    st.quorum),
+                {}};
+          }
+          if (st.public_key_indicator == soci::i_ok) {
+            signatories->public_keys.insert(st.public_key);
+          }
+        }
       } catch (const std::exception &e) {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation with db error: " + e.what();
-        // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
-        // with named constant
-        return expected::makeError(validation::CommandError{
-            "signatures validation", 1, error_str, false});
+        return expected::makeError(e.what());
       }
 
-      if (signatories_valid and *signatories_valid) {
+      for (auto &signatories : fetched) {
+        signatories_[signatories.first] = std::move(signatories.second);
+      }
+      return {};
+    }
+
+    void TemporaryWsvImpl::prefetchSignatories(
+        const shared_model::interface::types::TransactionsCollectionType
+            &transactions) {
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          unique_ids;
+      std::vector<shared_model::interface::types::AccountIdType> account_ids;
+      for (const auto &transaction : transactions) {
+        const auto &creator = transaction.creatorAccountId();
+        if (signatories_.count(creator) == 0
+            and unique_ids.insert(creator).second) {
+          account_ids.push_back(creator);
+        }
+      }
+      if (account_ids.empty()) {
+        return;
+      }
+
+      if (auto error =
+              expected::resultToOptionalError(fetchSignatories(account_ids))) {
+        // signatories will be requested for every transaction separately
+        log_->warn("Failed to prefetch signatories: {}", *error);
+      }
+    }
+
+    void TemporaryWsvImpl::invalidateSignatories(
+        const shared_model::interface::Transaction &transaction) {
+      for (const auto &command : transaction.commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [this](const shared_model::interface::AddSignatory &command) {
+              signatories_.erase(command.accountId());
+            },
+            [this](const shared_model::interface::RemoveSignatory &command) {
+              signatories_.erase(command.accountId());
+            },
+            [this](const shared_model::interface::SetQuorum &command) {
+              signatories_.erase(command.accountId());
+            },
+            [this](const shared_model::interface::CreateAccount &command) {
+              signatories_.erase(command.accountName() + "@"
+                                 + command.domainId());
+            },
+            [](const auto &) {});
+      }
+    }
+
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::validateSignatures(
+        const shared_model::interface::Transaction &transaction) {
+      const auto &creator = transaction.creatorAccountId();
+      auto signatories = signatories_.find(creator);
+      if (signatories == signatories_.end()) {
+        if (auto error = expected::resultToOptionalError(
+                fetchSignatories({creator}))) {
+          auto error_str = "Transaction " + transaction.toString()
+              + " failed signatures validation with db error: " + *error;
+          // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic
+          // number with named constant
+          return expected::makeError(validation::CommandError{
+              "signatures validation", 1, error_str, false});
+        }
+        signatories = signatories_.find(creator);
+      }
+
+      auto signatures = transaction.signatures();
+      auto signatures_count = boost::size(signatures);
+      auto signatories_valid = signatories != signatories_.end()
+          and signatories->second
+          and signatories->second->quorum <= signatures_count
+          and std::all_of(signatures.begin(),
+                          signatures.end(),
+                          [&keys = signatories->second->public_keys](
+                              const auto &signature) {
+                            return keys.count(boost::algorithm::to_lower_copy(
+                                       signature.publicKey()))
+                                != 0;
+                          });
+
+      if (signatories_valid) {
         return {};
       } else {
         auto error_str = "Transaction " + transaction.toString()
@@ -98,20 +224,26 @@ namespace iroha {
         }
         // success
         savepoint->release();
+        applied_txs_.push_back(transaction.hash());
+        invalidateSignatories(transaction);
         return {};
       };
     }
 
     std::unique_ptr<TemporaryWsv::SavepointWrapper>
     TemporaryWsvImpl::createSavepoint(const std::string &name) {
+      // constructed in place, since a destroyed temporary would roll back
       return std::make_unique<TemporaryWsvImpl::SavepointWrapperImpl>(
-          SavepointWrapperImpl(
-              *this,
-              name,
-              log_manager_->getChild("SavepointWrapper")->getLogger()));
+          *this,
+          name,
+          log_manager_->getChild("SavepointWrapper")->getLogger());
     }
 
     TemporaryWsvImpl::~TemporaryWsvImpl() {
+      if (committed_) {
+        return;
+      }
+      wsv_cache_.rollback();
       try {
         sql_ << "ROLLBACK";
       } catch (std::exception &e) {
@@ -120,14 +252,19 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::SavepointWrapperImpl(
-        const iroha::ametsuchi::TemporaryWsvImpl &wsv,
+        iroha::ametsuchi::TemporaryWsvImpl &wsv,
         std::string savepoint_name,
         logger::LoggerPtr log)
         : sql_{wsv.sql_},
+          wsv_cache_{wsv.wsv_cache_},
+          applied_txs_{wsv.applied_txs_},
+          applied_txs_size_{applied_txs_.size()},
+          signatories_{wsv.signatories_},
           savepoint_name_{std::move(savepoint_name)},
           is_released_{false},
           log_(std::move(log)) {
       sql_ << "SAVEPOINT " + savepoint_name_ + ";";
+      wsv_cache_.savepoint(savepoint_name_);
     }
 
     void TemporaryWsvImpl::SavepointWrapperImpl::release() {
@@ -137,8 +274,13 @@ namespace iroha {
     TemporaryWsvImpl::SavepointWrapperImpl::~SavepointWrapperImpl() {
       try {
         if (not is_released_) {
+          applied_txs_.resize(applied_txs_size_);
+          // signatories could be fetched from the state being rolled back
+          signatories_.clear();
+          wsv_cache_.rollbackToSavepoint(savepoint_name_);
           sql_ << "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
         } else {
+          wsv_cache_.releaseSavepoint(savepoint_name_);
           sql_ << "RELEASE SAVEPOINT " + savepoint_name_ + ";";
         }
       } catch (std::exception &e) {
@@ -8,8 +8,14 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include <soci/soci.h>
+#include <boost/optional.hpp>
 #include "ametsuchi/command_executor.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -24,13 +30,27 @@ namespace iroha {
   namespace ametsuchi {
     class PostgresCommandExecutor;
     class TransactionExecutor;
+    class WsvCacheOverlay;
 
     class TemporaryWsvImpl : public TemporaryWsv {
       friend class StorageImpl;
 
+      /// Signatories and quorum of an account
+      struct AccountSignatories {
+        shared_model::interface::types::QuorumType quorum;
+        std::unordered_set<std::string> public_keys;
+      };
+
+      /// Signatories of accounts, none for the accounts which do not exist
+      using SignatoriesCacheType =
+          std::unordered_map<shared_model::interface::types::AccountIdType,
+                             boost::optional<AccountSignatories>>;
+
+      class SignatoriesStatement;
+
      public:
       struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
-        SavepointWrapperImpl(const TemporaryWsvImpl &wsv,
+        SavepointWrapperImpl(TemporaryWsvImpl &wsv,
                              std::string savepoint_name,
                              logger::LoggerPtr log);
 
@@ -40,18 +60,34 @@ namespace iroha {
 
        private:
         soci::session &sql_;
+        WsvCacheOverlay &wsv_cache_;
+        std::vector<shared_model::interface::types::HashType> &applied_txs_;
+        size_t applied_txs_size_;
+        SignatoriesCacheType &signatories_;
         std::string savepoint_name_;
         bool is_released_;
         logger::LoggerPtr log_;
       };
 
+      /**
+       * @param command_executor - executor bound to the session of this WSV
+       * @param log_manager - log manager of this WSV
+       * @param top_block_hash - hash of the block on top of which the
+       * transactions are applied, if known
+       */
       TemporaryWsvImpl(
           std::shared_ptr<PostgresCommandExecutor> command_executor,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          boost::optional<shared_model::interface::types::HashType>
+              top_block_hash = boost::none);
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
 
+      void prefetchSignatories(
+          const shared_model::interface::types::TransactionsCollectionType
+              &transactions) override;
+
       std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) override;
 
@@ -65,9 +101,43 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /**
+       * Load signatories and quorums of given accounts into the cache with a
+       * single query
+       * @param account_ids - accounts which are not cached yet
+       * @return error message in case of database failure
+       */
+      expected::Result<void, std::string> fetchSignatories(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids);
+
+      /**
+       * Drop cached signatories of the accounts which could be changed by
+       * the applied transaction
+       */
+      void invalidateSignatories(
+          const shared_model::interface::Transaction &transaction);
+
       soci::session &sql_;
+      std::shared_ptr<PostgresCommandExecutor> command_executor_;
+      WsvCacheOverlay &wsv_cache_;
       std::unique_ptr<TransactionExecutor> transaction_executor_;
 
+      boost::optional<shared_model::interface::types::HashType>
+          top_block_hash_;
+
+      /// Hashes of the transactions applied to the state, in order
+      std::vector<shared_model::interface::types::HashType> applied_txs_;
+
+      /// Signatories of transaction creators, valid for the current state
+      SignatoriesCacheType signatories_;
+
+      /// Prepared once and reused for every fetch of signatories
+      std::unique_ptr<SignatoriesStatement> signatories_statement_;
+
+      /// Set when the changes are committed instead of being rolled back
+      bool committed_;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
     };
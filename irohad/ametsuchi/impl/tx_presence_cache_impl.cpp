@@ -12,8 +12,10 @@
 
 namespace iroha {
   namespace ametsuchi {
-    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage)
-        : storage_(std::move(storage)) {}
+    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage,
+                                             size_t memory_cache_capacity)
+        : storage_(std::move(storage)),
+          memory_cache_(memory_cache_capacity) {}
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::check(
         const shared_model::crypto::Hash &hash) const {
@@ -38,6 +40,18 @@ namespace iroha {
       return batch_statuses;
     }
 
+    uint64_t TxPresenceCacheImpl::getHits() const {
+      return memory_cache_.getHits();
+    }
+
+    uint64_t TxPresenceCacheImpl::getMisses() const {
+      return memory_cache_.getMisses();
+    }
+
+    uint32_t TxPresenceCacheImpl::getCacheItemCount() const {
+      return memory_cache_.getCacheItemCount();
+    }
+
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::checkInStorage(
         const shared_model::crypto::Hash &hash) const {
       auto block_query = storage_->getBlockQuery();
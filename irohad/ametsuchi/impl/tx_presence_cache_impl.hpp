@@ -8,14 +8,25 @@
 
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
     class TxPresenceCacheImpl : public TxPresenceCache {
+      using MemoryCacheType =
+          cache::ShardedCache<shared_model::crypto::Hash,
+                              TxCacheStatusType,
+                              shared_model::crypto::Hash::Hasher>;
+
      public:
-      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage);
+      /**
+       * @param storage - storage to check the transactions missing in memory
+       * @param memory_cache_capacity - number of statuses kept in memory
+       */
+      explicit TxPresenceCacheImpl(
+          std::shared_ptr<Storage> storage,
+          size_t memory_cache_capacity = cache::kDefaultCacheCapacity);
 
       boost::optional<TxCacheStatusType> check(
           const shared_model::crypto::Hash &hash) const override;
@@ -24,6 +35,15 @@ namespace iroha {
           const shared_model::interface::TransactionBatch &batch)
           const override;
 
+      /// @return number of checks answered from memory
+      uint64_t getHits() const;
+
+      /// @return number of checks which went to the storage
+      uint64_t getMisses() const;
+
+      /// @return number of statuses kept in memory
+      uint32_t getCacheItemCount() const;
+
      private:
       /**
        * Performs an actual storage request about hash status
@@ -35,10 +55,7 @@ namespace iroha {
           const shared_model::crypto::Hash &hash) const;
 
       std::shared_ptr<Storage> storage_;
-      mutable cache::Cache<shared_model::crypto::Hash,
-                           TxCacheStatusType,
-                           shared_model::crypto::Hash::Hasher>
-          memory_cache_;
+      mutable MemoryCacheType memory_cache_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,421 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <mutex>
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::GrantablePermissionSet;
+using shared_model::interface::types::AccountIdType;
+using shared_model::interface::types::AssetIdType;
+using shared_model::interface::types::PrecisionType;
+
+namespace {
+  template <typename Map, typename Key>
+  auto findValue(const Map &map, const Key &key)
+      -> std::optional<typename Map::mapped_type> {
+    auto it = map.find(key);
+    if (it == map.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    std::optional<WsvCacheBalance> parseWsvCacheBalance(
+        const std::string &decimal, PrecisionType precision) {
+      static const boost::multiprecision::cpp_int kMax{
+          std::numeric_limits<WsvCacheBalance>::max()};
+
+      auto dot_pos = decimal.find('.');
+      auto int_part_size =
+          dot_pos == std::string::npos ? decimal.size() : dot_pos;
+      auto frac_part_size = dot_pos == std::string::npos
+          ? 0
+          : decimal.size() - dot_pos - 1;
+      if (int_part_size == 0 or frac_part_size > precision
+          or (dot_pos != std::string::npos and frac_part_size == 0)) {
+        return std::nullopt;
+      }
+
+      boost::multiprecision::cpp_int value = 0;
+      for (size_t i = 0; i < decimal.size(); ++i) {
+        if (i == dot_pos) {
+          continue;
+        }
+        const char c = decimal[i];
+        if (c < '0' or c > '9') {
+          return std::nullopt;
+        }
+        value = value * 10 + (c - '0');
+      }
+      for (auto i = frac_part_size; i < precision; ++i) {
+        value *= 10;
+      }
+      if (value > kMax) {
+        return std::nullopt;
+      }
+      return static_cast<WsvCacheBalance>(value);
+    }
+
+    std::string formatWsvCacheBalance(const WsvCacheBalance &balance,
+                                      PrecisionType precision) {
+      auto digits = balance.str();
+      if (precision == 0) {
+        return digits;
+      }
+      if (digits.size() <= precision) {
+        digits.insert(0, precision + 1 - digits.size(), '0');
+      }
+      digits.insert(digits.size() - precision, 1, '.');
+      return digits;
+    }
+
+    size_t WsvCacheTables::size() const {
+      return accounts.size() + assets.size() + grantable.size()
+          + balances.size();
+    }
+
+    void WsvCacheTables::clear() {
+      accounts.clear();
+      assets.clear();
+      grantable.clear();
+      balances.clear();
+    }
+
+    void WsvCacheKeys::clear() {
+      accounts.clear();
+      assets.clear();
+      grantable.clear();
+      balances.clear();
+    }
+
+    WsvCache::WsvCache(size_t max_entries) : max_entries_(max_entries) {}
+
+    std::optional<WsvCacheAccount> WsvCache::getAccount(
+        const AccountIdType &account_id) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return findValue(tables_.accounts, account_id);
+    }
+
+    std::optional<WsvCacheAsset> WsvCache::getAsset(
+        const AssetIdType &asset_id) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return findValue(tables_.assets, asset_id);
+    }
+
+    std::optional<GrantablePermissionSet> WsvCache::getGrantable(
+        const WsvCacheGrantKey &key) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return findValue(tables_.grantable, key);
+    }
+
+    std::optional<WsvCacheBalance> WsvCache::getBalance(
+        const WsvCacheBalanceKey &key) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return findValue(tables_.balances, key);
+    }
+
+    void WsvCache::update(const WsvCacheKeys &invalidated,
+                          WsvCacheTables tables) {
+      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+      for (const auto &key : invalidated.accounts) {
+        tables_.accounts.erase(key);
+      }
+      for (const auto &key : invalidated.assets) {
+        tables_.assets.erase(key);
+      }
+      for (const auto &key : invalidated.grantable) {
+        tables_.grantable.erase(key);
+      }
+      for (const auto &key : invalidated.balances) {
+        tables_.balances.erase(key);
+      }
+
+      auto merge = [](auto &dst, auto &src) {
+        for (auto &item : src) {
+          dst.insert_or_assign(item.first, std::move(item.second));
+        }
+      };
+      merge(tables_.accounts, tables.accounts);
+      merge(tables_.assets, tables.assets);
+      merge(tables_.grantable, tables.grantable);
+      merge(tables_.balances, tables.balances);
+
+      if (tables_.size() > max_entries_) {
+        tables_.clear();
+      }
+    }
+
+    void WsvCache::clear() {
+      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+      tables_.clear();
+    }
+
+    size_t WsvCache::size() const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return tables_.size();
+    }
+
+    WsvCacheOverlay::WsvCacheOverlay(std::shared_ptr<WsvCache> cache)
+        : cache_(std::move(cache)) {}
+
+    bool WsvCacheOverlay::enabled() const {
+      return cache_ != nullptr;
+    }
+
+    void WsvCacheOverlay::begin() {
+      rollback();
+    }
+
+    void WsvCacheOverlay::savepoint(const std::string &name) {
+      if (not enabled()) {
+        return;
+      }
+      savepoints_.emplace_back(name, undo_log_.size());
+    }
+
+    void WsvCacheOverlay::releaseSavepoint(const std::string &name) {
+      auto it = std::find_if(savepoints_.rbegin(),
+                             savepoints_.rend(),
+                             [&name](const auto &s) { return s.first == name; });
+      if (it == savepoints_.rend()) {
+        return;
+      }
+      savepoints_.erase(std::next(it).base(), savepoints_.end());
+      if (savepoints_.empty()) {
+        // nothing can be rolled back partially anymore
+        undo_log_.clear();
+      }
+    }
+
+    void WsvCacheOverlay::rollbackToSavepoint(const std::string &name) {
+      auto it = std::find_if(savepoints_.rbegin(),
+                             savepoints_.rend(),
+                             [&name](const auto &s) { return s.first == name; });
+      if (it == savepoints_.rend()) {
+        return;
+      }
+      const auto position = it->second;
+      while (undo_log_.size() > position) {
+        undo_log_.back()();
+        undo_log_.pop_back();
+      }
+      // the savepoint itself stays defined, just like in Postgres
+      savepoints_.erase(it.base(), savepoints_.end());
+    }
+
+    void WsvCacheOverlay::rollback() {
+      accounts_.clear();
+      assets_.clear();
+      grantable_.clear();
+      balances_.clear();
+      invalidated_.clear();
+      savepoints_.clear();
+      undo_log_.clear();
+    }
+
+    void WsvCacheOverlay::publish() {
+      if (not enabled()) {
+        return;
+      }
+      assert(not hasDirtyBalances());
+
+      WsvCacheTables tables;
+      tables.accounts = std::move(accounts_);
+      tables.assets = std::move(assets_);
+      tables.grantable = std::move(grantable_);
+      for (auto &item : balances_) {
+        tables.balances.emplace(item.first, std::move(item.second.value));
+      }
+      cache_->update(invalidated_, std::move(tables));
+      rollback();
+    }
+
+    std::unique_ptr<WsvCacheOverlay> WsvCacheOverlay::detachPrepared() {
+      assert(not hasDirtyBalances());
+
+      auto prepared = std::make_unique<WsvCacheOverlay>(cache_);
+      prepared->accounts_ = std::move(accounts_);
+      prepared->assets_ = std::move(assets_);
+      prepared->grantable_ = std::move(grantable_);
+      prepared->balances_ = std::move(balances_);
+      prepared->invalidated_ = std::move(invalidated_);
+      rollback();
+      return prepared;
+    }
+
+    std::optional<WsvCacheAccount> WsvCacheOverlay::getAccount(
+        const AccountIdType &account_id) const {
+      if (auto local = findValue(accounts_, account_id)) {
+        return local;
+      }
+      if (not enabled() or invalidated_.accounts.count(account_id) != 0) {
+        return std::nullopt;
+      }
+      return cache_->getAccount(account_id);
+    }
+
+    std::optional<WsvCacheAsset> WsvCacheOverlay::getAsset(
+        const AssetIdType &asset_id) const {
+      if (auto local = findValue(assets_, asset_id)) {
+        return local;
+      }
+      if (not enabled() or invalidated_.assets.count(asset_id) != 0) {
+        return std::nullopt;
+      }
+      return cache_->getAsset(asset_id);
+    }
+
+    std::optional<GrantablePermissionSet> WsvCacheOverlay::getGrantable(
+        const WsvCacheGrantKey &key) const {
+      if (auto local = findValue(grantable_, key)) {
+        return local;
+      }
+      if (not enabled() or invalidated_.grantable.count(key) != 0) {
+        return std::nullopt;
+      }
+      return cache_->getGrantable(key);
+    }
+
+    std::optional<WsvCacheBalance> WsvCacheOverlay::getBalance(
+        const WsvCacheBalanceKey &key) const {
+      auto it = balances_.find(key);
+      if (it != balances_.end()) {
+        return it->second.value;
+      }
+      if (not enabled() or invalidated_.balances.count(key) != 0) {
+        return std::nullopt;
+      }
+      return cache_->getBalance(key);
+    }
+
+    template <typename Map, typename Key, typename Value>
+    void WsvCacheOverlay::assign(Map &map, const Key &key, Value value) {
+      auto it = map.find(key);
+      if (it == map.end()) {
+        if (not savepoints_.empty()) {
+          undo_log_.emplace_back([&map, key] { map.erase(key); });
+        }
+        map.emplace(key, std::move(value));
+      } else {
+        if (not savepoints_.empty()) {
+          undo_log_.emplace_back(
+              [&map, key, old = it->second] { map.at(key) = old; });
+        }
+        it->second = std::move(value);
+      }
+    }
+
+    void WsvCacheOverlay::putAccount(const AccountIdType &account_id,
+                                     WsvCacheAccount account) {
+      assign(accounts_, account_id, std::move(account));
+    }
+
+    void WsvCacheOverlay::putAsset(const AssetIdType &asset_id,
+                                   WsvCacheAsset asset) {
+      assign(assets_, asset_id, std::move(asset));
+    }
+
+    void WsvCacheOverlay::putGrantable(const WsvCacheGrantKey &key,
+                                       GrantablePermissionSet perms) {
+      assign(grantable_, key, std::move(perms));
+    }
+
+    void WsvCacheOverlay::putBalance(const WsvCacheBalanceKey &key,
+                                     WsvCacheBalance balance) {
+      assign(balances_, key, BalanceEntry{std::move(balance), false});
+    }
+
+    void WsvCacheOverlay::setBalance(const WsvCacheBalanceKey &key,
+                                     WsvCacheBalance balance) {
+      assign(balances_, key, BalanceEntry{std::move(balance), true});
+    }
+
+    void WsvCacheOverlay::invalidateAccount(const AccountIdType &account_id) {
+      invalidated_.accounts.insert(account_id);
+      if (accounts_.count(account_id) != 0) {
+        // the row may be loaded again after a rollback to savepoint, so the
+        // removal must be undoable just like an assignment
+        if (not savepoints_.empty()) {
+          undo_log_.emplace_back(
+              [this, account_id, old = accounts_.at(account_id)] {
+                accounts_.insert_or_assign(account_id, old);
+              });
+        }
+        accounts_.erase(account_id);
+      }
+    }
+
+    void WsvCacheOverlay::invalidateAsset(const AssetIdType &asset_id) {
+      invalidated_.assets.insert(asset_id);
+      if (assets_.count(asset_id) != 0) {
+        if (not savepoints_.empty()) {
+          undo_log_.emplace_back([this, asset_id, old = assets_.at(asset_id)] {
+            assets_.insert_or_assign(asset_id, old);
+          });
+        }
+        assets_.erase(asset_id);
+      }
+    }
+
+    void WsvCacheOverlay::invalidateGrantable(const WsvCacheGrantKey &key) {
+      invalidated_.grantable.insert(key);
+      if (grantable_.count(key) != 0) {
+        if (not savepoints_.empty()) {
+          undo_log_.emplace_back([this, key, old = grantable_.at(key)] {
+            grantable_.insert_or_assign(key, old);
+          });
+        }
+        grantable_.erase(key);
+      }
+    }
+
+    void WsvCacheOverlay::invalidateBalance(const WsvCacheBalanceKey &key) {
+      invalidated_.balances.insert(key);
+      auto it = balances_.find(key);
+      if (it != balances_.end()) {
+        assert(not it->second.dirty);
+        if (not savepoints_.empty()) {
+          undo_log_.emplace_back([this, key, old = it->second] {
+            balances_.insert_or_assign(key, old);
+          });
+        }
+        balances_.erase(it);
+      }
+    }
+
+    bool WsvCacheOverlay::hasDirtyBalances() const {
+      return std::any_of(balances_.begin(),
+                         balances_.end(),
+                         [](const auto &item) { return item.second.dirty; });
+    }
+
+    std::vector<std::pair<WsvCacheBalanceKey, WsvCacheBalance>>
+    WsvCacheOverlay::takeDirtyBalances() {
+      std::vector<std::pair<WsvCacheBalanceKey, WsvCacheBalance>> result;
+      for (auto &item : balances_) {
+        if (item.second.dirty) {
+          if (not savepoints_.empty()) {
+            undo_log_.emplace_back([this, key = item.first] {
+              balances_.at(key).dirty = true;
+            });
+          }
+          item.second.dirty = false;
+          result.emplace_back(item.first, item.second.value);
+        }
+      }
+      return result;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
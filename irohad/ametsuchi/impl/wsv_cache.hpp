@@ -0,0 +1,298 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_WSV_CACHE_HPP
+#define IROHA_AMETSUCHI_WSV_CACHE_HPP
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/permissions.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// Asset balance scaled by 10^precision of the asset.
+    using WsvCacheBalance = boost::multiprecision::uint256_t;
+
+    /**
+     * Parse a decimal string into a balance scaled to the given precision.
+     * @return the scaled value or nullopt if the string is not a non-negative
+     * decimal, has more fractional digits than precision or does not fit into
+     * 256 bits after scaling
+     */
+    std::optional<WsvCacheBalance> parseWsvCacheBalance(
+        const std::string &decimal,
+        shared_model::interface::types::PrecisionType precision);
+
+    /// Format a scaled balance as a decimal string with exactly precision
+    /// fractional digits.
+    std::string formatWsvCacheBalance(
+        const WsvCacheBalance &balance,
+        shared_model::interface::types::PrecisionType precision);
+
+    /// Cached state of an account needed to check permissions.
+    struct WsvCacheAccount {
+      bool exists;
+      /// union of permissions of all account roles
+      shared_model::interface::RolePermissionSet permissions;
+    };
+
+    /// Cached state of an asset.
+    struct WsvCacheAsset {
+      bool exists;
+      shared_model::interface::types::PrecisionType precision;
+    };
+
+    /// Identifies grantable permissions given by account to permittee.
+    struct WsvCacheGrantKey {
+      shared_model::interface::types::AccountIdType permittee_account_id;
+      shared_model::interface::types::AccountIdType account_id;
+
+      bool operator==(const WsvCacheGrantKey &other) const {
+        return permittee_account_id == other.permittee_account_id
+            and account_id == other.account_id;
+      }
+    };
+
+    /// Identifies a balance of an asset on an account.
+    struct WsvCacheBalanceKey {
+      shared_model::interface::types::AccountIdType account_id;
+      shared_model::interface::types::AssetIdType asset_id;
+
+      bool operator==(const WsvCacheBalanceKey &other) const {
+        return account_id == other.account_id and asset_id == other.asset_id;
+      }
+    };
+
+    struct WsvCacheKeyHash {
+      size_t operator()(const WsvCacheGrantKey &key) const {
+        size_t seed = 0;
+        boost::hash_combine(seed, key.permittee_account_id);
+        boost::hash_combine(seed, key.account_id);
+        return seed;
+      }
+
+      size_t operator()(const WsvCacheBalanceKey &key) const {
+        size_t seed = 0;
+        boost::hash_combine(seed, key.account_id);
+        boost::hash_combine(seed, key.asset_id);
+        return seed;
+      }
+    };
+
+    /// Set of cached WSV rows.
+    struct WsvCacheTables {
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         WsvCacheAccount>
+          accounts;
+      std::unordered_map<shared_model::interface::types::AssetIdType,
+                         WsvCacheAsset>
+          assets;
+      std::unordered_map<WsvCacheGrantKey,
+                         shared_model::interface::GrantablePermissionSet,
+                         WsvCacheKeyHash>
+          grantable;
+      std::unordered_map<WsvCacheBalanceKey, WsvCacheBalance, WsvCacheKeyHash>
+          balances;
+
+      size_t size() const;
+
+      void clear();
+    };
+
+    /// Set of keys of cached WSV rows.
+    struct WsvCacheKeys {
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          accounts;
+      std::unordered_set<shared_model::interface::types::AssetIdType> assets;
+      std::unordered_set<WsvCacheGrantKey, WsvCacheKeyHash> grantable;
+      std::unordered_set<WsvCacheBalanceKey, WsvCacheKeyHash> balances;
+
+      void clear();
+    };
+
+    /**
+     * In-memory copy of the committed part of WSV which is needed to validate
+     * and execute asset commands without Postgres round-trips. The cache is
+     * shared between sessions and only contains rows which are known to be
+     * committed. It is updated by WsvCacheOverlay::publish after the
+     * corresponding database transaction has been committed.
+     */
+    class WsvCache {
+     public:
+      /// @param max_entries - cached rows limit; the cache is dropped as a
+      /// whole when it is exceeded
+      explicit WsvCache(size_t max_entries);
+
+      std::optional<WsvCacheAccount> getAccount(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      std::optional<WsvCacheAsset> getAsset(
+          const shared_model::interface::types::AssetIdType &asset_id) const;
+
+      std::optional<shared_model::interface::GrantablePermissionSet>
+      getGrantable(const WsvCacheGrantKey &key) const;
+
+      std::optional<WsvCacheBalance> getBalance(
+          const WsvCacheBalanceKey &key) const;
+
+      /**
+       * Apply committed changes of a transaction.
+       * @param invalidated - keys of rows which must be dropped
+       * @param tables - committed rows
+       */
+      void update(const WsvCacheKeys &invalidated, WsvCacheTables tables);
+
+      /// Drop all cached rows
+      void clear();
+
+      /// @return number of cached rows
+      size_t size() const;
+
+     private:
+      const size_t max_entries_;
+      mutable std::shared_timed_mutex mutex_;
+      WsvCacheTables tables_;
+    };
+
+    /**
+     * Transaction-local view of WSV cache bound to a single database session.
+     * Reads go to the rows loaded or changed in the current transaction first
+     * and then to the shared committed cache. Balance changes are kept in
+     * memory until flushed. The overlay mirrors database savepoints, so that
+     * a rollback to a savepoint restores both the rows and their dirtiness.
+     * Not thread-safe, as is the session it is bound to.
+     */
+    class WsvCacheOverlay {
+     public:
+      /// @param cache - shared committed cache, nullptr disables the overlay
+      explicit WsvCacheOverlay(std::shared_ptr<WsvCache> cache);
+
+      /// @return true if WSV cache is enabled
+      bool enabled() const;
+
+      /// Start a new transaction, dropping everything from the previous one
+      void begin();
+
+      void savepoint(const std::string &name);
+
+      void releaseSavepoint(const std::string &name);
+
+      void rollbackToSavepoint(const std::string &name);
+
+      /// Discard transaction changes
+      void rollback();
+
+      /**
+       * Make the rows of committed transaction visible to other sessions.
+       * Must only be called after the transaction was flushed and committed.
+       */
+      void publish();
+
+      /**
+       * Move the rows of a transaction which was flushed and prepared for a
+       * two-phase commit out of this overlay, leaving it empty.
+       * @return overlay to be published after COMMIT PREPARED
+       */
+      std::unique_ptr<WsvCacheOverlay> detachPrepared();
+
+      std::optional<WsvCacheAccount> getAccount(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      std::optional<WsvCacheAsset> getAsset(
+          const shared_model::interface::types::AssetIdType &asset_id) const;
+
+      std::optional<shared_model::interface::GrantablePermissionSet>
+      getGrantable(const WsvCacheGrantKey &key) const;
+
+      std::optional<WsvCacheBalance> getBalance(
+          const WsvCacheBalanceKey &key) const;
+
+      /// Remember a row read from the database in the current transaction
+      void putAccount(
+          const shared_model::interface::types::AccountIdType &account_id,
+          WsvCacheAccount account);
+
+      void putAsset(const shared_model::interface::types::AssetIdType &asset_id,
+                    WsvCacheAsset asset);
+
+      void putGrantable(const WsvCacheGrantKey &key,
+                        shared_model::interface::GrantablePermissionSet perms);
+
+      void putBalance(const WsvCacheBalanceKey &key, WsvCacheBalance balance);
+
+      /// Change a balance in memory. The row is written on the next flush.
+      void setBalance(const WsvCacheBalanceKey &key, WsvCacheBalance balance);
+
+      /// Forget a row which was changed in the database bypassing the cache
+      void invalidateAccount(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      void invalidateAsset(
+          const shared_model::interface::types::AssetIdType &asset_id);
+
+      void invalidateGrantable(const WsvCacheGrantKey &key);
+
+      /// Forget a balance which was changed in the database. Must only be
+      /// called when there are no dirty balances.
+      void invalidateBalance(const WsvCacheBalanceKey &key);
+
+      /// @return true if there are balances which are not written yet
+      bool hasDirtyBalances() const;
+
+      /**
+       * Collect balances changed since the previous flush and mark them as
+       * written. Rollback to a savepoint made before this call marks them as
+       * dirty again.
+       */
+      std::vector<std::pair<WsvCacheBalanceKey, WsvCacheBalance>>
+      takeDirtyBalances();
+
+     private:
+      struct BalanceEntry {
+        WsvCacheBalance value;
+        bool dirty;
+      };
+
+      template <typename Map, typename Key, typename Value>
+      void assign(Map &map, const Key &key, Value value);
+
+      std::shared_ptr<WsvCache> cache_;
+
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         WsvCacheAccount>
+          accounts_;
+      std::unordered_map<shared_model::interface::types::AssetIdType,
+                         WsvCacheAsset>
+          assets_;
+      std::unordered_map<WsvCacheGrantKey,
+                         shared_model::interface::GrantablePermissionSet,
+                         WsvCacheKeyHash>
+          grantable_;
+      std::unordered_map<WsvCacheBalanceKey, BalanceEntry, WsvCacheKeyHash>
+          balances_;
+      /// keys which must not be served from the shared cache
+      WsvCacheKeys invalidated_;
+
+      std::vector<std::pair<std::string, size_t>> savepoints_;
+      std::vector<std::function<void()>> undo_log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_WSV_CACHE_HPP
@@ -5,6 +5,13 @@
 
 #include "wsv_restorer_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/block_storage_factory.hpp"
@@ -42,6 +49,26 @@ namespace {
       return boost::none;
     }
 
+    /**
+     * Returns boost::none - it is not required to fetch individual blocks
+     * during WSV reindexing
+     */
+    boost::optional<std::string> fetchSerialized(
+        HeightType height) const override {
+      return boost::none;
+    }
+
+    /**
+     * Returns boost::none - it is not required to fetch transactions during
+     * WSV reindexing
+     */
+    boost::optional<
+        std::vector<std::unique_ptr<shared_model::interface::Transaction>>>
+    fetchTransactions(HeightType height,
+                      const std::vector<TxLocation> &locations) const override {
+      return boost::none;
+    }
+
     size_t size() const override {
       return 0;
     }
@@ -65,52 +92,179 @@ namespace {
     }
   };
 
+  /// Number of blocks fetched ahead of the one being applied
+  constexpr size_t kPrefetchedBlocks = 64;
+
   /**
-   * Reapply blocks from existing storage to WSV
+   * Fetches and decodes the blocks of the given range in its own thread, so
+   * that it is done while the previous blocks are applied to WSV. Stops after
+   * the first block it has failed to get
+   */
+  class BlockPrefetcher {
+   public:
+    using BlockResult = iroha::expected::
+        Result<std::shared_ptr<const shared_model::interface::Block>,
+               std::string>;
+
+    BlockPrefetcher(std::shared_ptr<iroha::ametsuchi::BlockQuery> block_query,
+                    HeightType starting_height,
+                    HeightType ending_height,
+                    size_t capacity)
+        : block_query_(std::move(block_query)),
+          capacity_(capacity),
+          stop_(false),
+          thread_([this, starting_height, ending_height] {
+            this->run(starting_height, ending_height);
+          }) {}
+
+    ~BlockPrefetcher() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      not_full_.notify_one();
+      thread_.join();
+    }
+
+    /**
+     * Wait for the next block of the range
+     * @return the block or the error of getting it
+     */
+    BlockResult next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_.wait(lock, [this] { return not blocks_.empty(); });
+      auto block = std::move(blocks_.front());
+      blocks_.pop_front();
+      lock.unlock();
+      not_full_.notify_one();
+      return block;
+    }
+
+   private:
+    void run(HeightType starting_height, HeightType ending_height) {
+      for (auto i = starting_height; i <= ending_height; ++i) {
+        auto block = block_query_->getBlock(i).match(
+            [](auto &&block) -> BlockResult {
+              return std::shared_ptr<const shared_model::interface::Block>(
+                  std::move(block).value);
+            },
+            [](auto &&err) -> BlockResult {
+              return std::move(err).error.message;
+            });
+        const bool failed = iroha::expected::hasError(block);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock,
+                       [this] { return stop_ or blocks_.size() < capacity_; });
+        if (stop_) {
+          return;
+        }
+        blocks_.push_back(std::move(block));
+        lock.unlock();
+        not_empty_.notify_one();
+        if (failed) {
+          return;
+        }
+      }
+    }
+
+    std::shared_ptr<iroha::ametsuchi::BlockQuery> block_query_;
+    const size_t capacity_;
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<BlockResult> blocks_;
+    bool stop_;
+
+    std::thread thread_;
+  };
+
+  /**
+   * Reapply blocks from existing storage to WSV, committing them in chunks.
+   * The WSV top block of each commit is the point the restoration resumes
+   * from, if it is interrupted
    * @param storage - current storage
-   * @param mutable_storage - mutable storage without blocks
+   * @param command_executor - command executor for the mutable storages
    * @param block_query - current block storage
    * @param starting_height - the first block to apply
    * @param ending_height - the last block to apply (inclusive)
+   * @param blocks_per_commit - maximal number of blocks in a chunk
+   * @param log - logger of the progress
    * @return commit status after applying the blocks
    */
   iroha::ametsuchi::CommitResult reindexBlocks(
       iroha::ametsuchi::Storage &storage,
-      std::unique_ptr<iroha::ametsuchi::MutableStorage> &mutable_storage,
-      std::shared_ptr<iroha::ametsuchi::BlockQuery> &block_query,
+      std::shared_ptr<iroha::ametsuchi::CommandExecutor> command_executor,
+      std::shared_ptr<iroha::ametsuchi::BlockQuery> block_query,
       HeightType starting_height,
-      HeightType ending_height) {
-    for (auto i = starting_height; i <= ending_height; ++i) {
-      auto result = block_query->getBlock(i).match(
-          [&mutable_storage](
-              auto &&block) -> iroha::expected::Result<void, std::string> {
-            if (not mutable_storage->apply(std::move(block).value)) {
-              return iroha::expected::makeError("Cannot apply block!");
-            }
-            return iroha::expected::Value<void>();
-          },
-          [](auto &&err) -> iroha::expected::Result<void, std::string> {
-            return std::move(err).error.message;
-          });
-
-      if (auto e = iroha::expected::resultToOptionalError(result)) {
-        return std::move(e).value();
-      }
+      HeightType ending_height,
+      size_t blocks_per_commit,
+      const logger::LoggerPtr &log) {
+    BlockStorageStubFactory storage_factory;
+    if (starting_height > ending_height) {
+      return storage.commit(
+          storage.createMutableStorage(command_executor, storage_factory));
     }
 
-    return storage.commit(std::move(mutable_storage));
+    log->info("Restoring WSV from block {} to block {}",
+              starting_height,
+              ending_height);
+    BlockPrefetcher prefetcher(std::move(block_query),
+                               starting_height,
+                               ending_height,
+                               kPrefetchedBlocks);
+    const auto started = std::chrono::steady_clock::now();
+    iroha::ametsuchi::CommitResult result =
+        iroha::expected::makeError("No blocks were committed");
+    auto height = starting_height;
+    while (height <= ending_height) {
+      const auto chunk_end = ending_height - height < blocks_per_commit
+          ? ending_height
+          : height + blocks_per_commit - 1;
+      auto mutable_storage =
+          storage.createMutableStorage(command_executor, storage_factory);
+      for (; height <= chunk_end; ++height) {
+        auto applied = prefetcher.next() |
+                           [&mutable_storage](auto &&block)
+            -> iroha::expected::Result<void, std::string> {
+          if (not mutable_storage->apply(std::move(block))) {
+            return iroha::expected::makeError("Cannot apply block!");
+          }
+          return iroha::expected::Value<void>();
+        };
+        if (auto e = iroha::expected::resultToOptionalError(applied)) {
+          return std::move(e).value();
+        }
+      }
+
+      result = storage.commit(std::move(mutable_storage));
+      if (iroha::expected::hasError(result)) {
+        return result;
+      }
+
+      const auto seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - started)
+                               .count();
+      log->info("WSV is restored up to block {} of {}, {:.1f} blocks/s",
+                chunk_end,
+                ending_height,
+                seconds > 0 ? (chunk_end - starting_height + 1) / seconds : 0.);
+    }
+    return result;
   }
 }  // namespace
 
 namespace iroha {
   namespace ametsuchi {
+    WsvRestorerImpl::WsvRestorerImpl(logger::LoggerPtr log,
+                                     size_t blocks_per_commit)
+        : log_(std::move(log)),
+          blocks_per_commit_(std::max<size_t>(blocks_per_commit, 1)) {}
+
     CommitResult WsvRestorerImpl::restoreWsv(Storage &storage) {
       return storage.createCommandExecutor() |
-                 [&storage](auto &&command_executor) -> CommitResult {
-        BlockStorageStubFactory storage_factory;
-
-        auto mutable_storage = storage.createMutableStorage(
-            std::move(command_executor), storage_factory);
+                 [this, &storage](auto &&command_executor) -> CommitResult {
         auto block_query = storage.getBlockQuery();
         if (not block_query) {
           return expected::makeError("Cannot create BlockQuery");
@@ -167,10 +321,12 @@ namespace iroha {
         }
 
         return reindexBlocks(storage,
-                             mutable_storage,
-                             block_query,
+                             std::move(command_executor),
+                             std::move(block_query),
                              wsv_ledger_height + 1,
-                             last_block_in_storage);
+                             last_block_in_storage,
+                             blocks_per_commit_,
+                             log_);
       };
     }
   }  // namespace ametsuchi
@@ -10,6 +10,7 @@
 
 #include "ametsuchi/ledger_state.hpp"
 #include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -20,15 +21,33 @@ namespace iroha {
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      /// Number of blocks applied to WSV in a single database transaction
+      static constexpr size_t kDefaultBlocksPerCommit = 1000;
+
+      /**
+       * @param log - logger of the restoration progress
+       * @param blocks_per_commit - number of blocks to apply before each
+       * commit, the top block of the committed ones is the point from which
+       * the next restoration resumes
+       */
+      explicit WsvRestorerImpl(
+          logger::LoggerPtr log,
+          size_t blocks_per_commit = kDefaultBlocksPerCommit);
+
       virtual ~WsvRestorerImpl() = default;
       /**
        * Recover WSV (World State View).
-       * Drop storage and apply blocks one by one.
+       * Apply the blocks above the WSV top block in chunks, committing each
+       * of them, while the next blocks are fetched in the background.
        * @param storage of blocks in ledger
        * @return ledger state after restoration on success, otherwise error
        * string
        */
       CommitResult restoreWsv(Storage &storage) override;
+
+     private:
+      logger::LoggerPtr log_;
+      const size_t blocks_per_commit_;
     };
 
   }  // namespace ametsuchi
@@ -27,6 +27,8 @@ namespace iroha {
         shared_model::interface::types::HeightType
             height;    ///< the height of block containing this transaction
         size_t index;  ///< the number of this transaction in the block
+        uint64_t offset = 0;  ///< offset of the transaction in the block blob
+        uint32_t size = 0;    ///< size of the transaction, 0 if not known
       };
 
       /// Store a committed tx hash.
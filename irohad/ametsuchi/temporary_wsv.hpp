@@ -9,6 +9,7 @@
 #include <functional>
 
 #include "common/result.hpp"
+#include "interfaces/common_objects/range_types.hpp"
 #include "validation/stateful_validator_common.hpp"
 
 namespace shared_model {
@@ -47,6 +48,15 @@ namespace iroha {
       virtual expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) = 0;
 
+      /**
+       * Load signatories and quorums of the creators of given transactions
+       * at once, so that following apply calls check signatures locally
+       * @param transactions to be applied afterwards
+       */
+      virtual void prefetchSignatories(
+          const shared_model::interface::types::TransactionsCollectionType
+              &transactions) = 0;
+
       /**
        * Create a savepoint for wsv state
        * @param name of savepoint to be created
@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_WSV_SNAPSHOT_HPP
+#define IROHA_AMETSUCHI_WSV_SNAPSHOT_HPP
+
+#include <functional>
+#include <string>
+
+#include "ametsuchi/ledger_state.hpp"
+#include "common/result.hpp"
+#include "cryptography/hash.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Summary of a WSV snapshot, which follows its rows
+     */
+    struct WsvSnapshotInfo {
+      /// Top block of the WSV in the snapshot
+      TopBlockInfo top_block_info;
+
+      /// Hash of all the chunks of rows in the snapshot, in their order
+      shared_model::crypto::Hash snapshot_hash;
+    };
+
+    /**
+     * Creates consistent snapshots of WSV
+     */
+    class WsvSnapshotExporter {
+     public:
+      /**
+       * Called with the table name and a chunk of its rows in the format of
+       * Postgres COPY. Returns false to stop the export
+       */
+      using ChunkConsumer =
+          std::function<bool(const std::string &table, std::string rows)>;
+
+      /**
+       * Pass the rows of all the WSV tables at the current top block to the
+       * consumer, table by table, in the order of their import
+       * @return summary of the snapshot or error
+       */
+      virtual expected::Result<WsvSnapshotInfo, std::string> exportSnapshot(
+          const ChunkConsumer &consumer) = 0;
+
+      virtual ~WsvSnapshotExporter() = default;
+    };
+
+    /**
+     * Fills WSV with the rows of a snapshot
+     */
+    class WsvSnapshotImporter {
+     public:
+      /**
+       * Load the next chunk of rows, the chunks must come in the order of
+       * their export
+       */
+      virtual expected::Result<void, std::string> importRows(
+          const std::string &table, const std::string &rows) = 0;
+
+      /**
+       * Check that the loaded rows match the summary of the snapshot. The
+       * loaded WSV is not committed yet
+       */
+      virtual expected::Result<void, std::string> finish(
+          const WsvSnapshotInfo &info) = 0;
+
+      /**
+       * Commit the finished snapshot. Not committed snapshot is discarded on
+       * destruction
+       */
+      virtual expected::Result<void, std::string> commit() = 0;
+
+      virtual ~WsvSnapshotImporter() = default;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_WSV_SNAPSHOT_HPP
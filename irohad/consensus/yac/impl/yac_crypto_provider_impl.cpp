@@ -13,6 +13,35 @@
 #include "interfaces/common_objects/string_view_types.hpp"
 #include "logger/logger.hpp"
 
+namespace {
+  using iroha::consensus::yac::VoteMessage;
+
+  /**
+   * Make the key, which identifies both the signed payload and the signature
+   * of the vote. Each part is prefixed with its size, so that different votes
+   * never have the same key
+   */
+  std::string makeVoteKey(const VoteMessage &vote) {
+    std::string key;
+    auto append = [&key](std::string_view part) {
+      key.append(std::to_string(part.size()));
+      key.push_back(':');
+      key.append(part);
+    };
+    append(std::to_string(vote.hash.vote_round.block_round));
+    append(std::to_string(vote.hash.vote_round.reject_round));
+    append(vote.hash.vote_hashes.proposal_hash);
+    append(vote.hash.vote_hashes.block_hash);
+    if (vote.hash.block_signature) {
+      append(vote.hash.block_signature->signedData());
+      append(vote.hash.block_signature->publicKey());
+    }
+    append(vote.signature->signedData());
+    append(vote.signature->publicKey());
+    return key;
+  }
+}  // namespace
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -23,24 +52,50 @@ namespace iroha {
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
         return std::all_of(
             std::begin(msg), std::end(msg), [this](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
-
-              using namespace shared_model::interface::types;
-              return shared_model::crypto::CryptoVerifier::verify(
-                         SignedHexStringView{vote.signature->signedData()},
-                         blob,
-                         PublicKeyHexStringView{vote.signature->publicKey()})
-                  .match([](const auto &) { return true; },
-                         [this](const auto &error) {
-                           log_->debug("Vote signature verification failed: {}",
-                                       error.error);
-                           return false;
-                         });
+              return this->verifyVote(vote);
             });
       }
 
+      bool CryptoProviderImpl::verifyVote(const VoteMessage &vote) {
+        auto key = makeVoteKey(vote);
+        {
+          std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+          if (verified_votes_.count(key) != 0) {
+            return true;
+          }
+        }
+
+        // the payload does not contain the vote signature, so it is not
+        // decoded here
+        auto serialized =
+            PbConverters::serializeVotePayload(vote).hash().SerializeAsString();
+        auto blob = shared_model::crypto::Blob(serialized);
+
+        using namespace shared_model::interface::types;
+        auto verified =
+            shared_model::crypto::CryptoVerifier::verify(
+                SignedHexStringView{vote.signature->signedData()},
+                blob,
+                PublicKeyHexStringView{vote.signature->publicKey()})
+                .match([](const auto &) { return true; },
+                       [this](const auto &error) {
+                         log_->debug("Vote signature verification failed: {}",
+                                     error.error);
+                         return false;
+                       });
+        if (verified) {
+          std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+          if (verified_votes_.insert(key).second) {
+            verified_votes_order_.push_back(std::move(key));
+            if (verified_votes_order_.size() > kVerifiedVotesCacheSize) {
+              verified_votes_.erase(verified_votes_order_.front());
+              verified_votes_order_.pop_front();
+            }
+          }
+        }
+        return verified;
+      }
+
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
         VoteMessage vote;
         vote.hash = hash;
@@ -8,6 +8,11 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
 #include "cryptography/keypair.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -25,8 +30,26 @@ namespace iroha {
         VoteMessage getVote(YacHash hash) override;
 
        private:
+        /// Max number of votes which verification results are kept
+        static constexpr size_t kVerifiedVotesCacheSize = 1024;
+
+        /**
+         * Check the signature of the vote against its payload, unless the
+         * same vote has already been verified. The same votes are received
+         * many times, e.g. in the commits from every peer
+         * @param vote - vote to check
+         * @return true if the signature is valid
+         */
+        bool verifyVote(const VoteMessage &vote);
+
         shared_model::crypto::Keypair keypair_;
         logger::LoggerPtr log_;
+
+        std::mutex verified_votes_mutex_;
+        /// keys of the votes with valid signatures
+        std::unordered_set<std::string> verified_votes_;
+        /// the same keys in the order of insertion, to evict the oldest ones
+        std::deque<std::string> verified_votes_order_;
       };
     }  // namespace yac
   }    // namespace consensus
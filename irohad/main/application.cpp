@@ -5,6 +5,7 @@
 
 #include "main/application.hpp"
 
+#include <limits>
 #include <optional>
 
 #include <boost/filesystem.hpp>
@@ -15,8 +16,11 @@
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_block_storage_factory.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+#include "ametsuchi/impl/segmented_file_block_storage_factory.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/vm_caller.hpp"
 #include "backend/protobuf/proto_block_json_converter.hpp"
@@ -39,6 +43,7 @@
 #include "main/impl/consensus_init.hpp"
 #include "main/impl/pending_transaction_storage_init.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "main/impl/wsv_snapshot_bootstrap.hpp"
 #include "main/server_runner.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 #include "multi_sig_transactions/mst_processor_impl.hpp"
@@ -52,10 +57,12 @@
 #include "network/impl/peer_tls_certificates_provider_root.hpp"
 #include "network/impl/peer_tls_certificates_provider_wsv.hpp"
 #include "network/impl/tls_credentials.hpp"
+#include "network/impl/wsv_snapshot_loader.hpp"
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
 #include "simulator/impl/simulator.hpp"
+#include "synchronizer/impl/chain_follower.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/command_service_transport_grpc.hpp"
@@ -95,8 +102,8 @@ using shared_model::interface::types::PublicKeyHexStringView;
 static constexpr iroha::consensus::yac::ConsistencyModel
     kConsensusConsistencyModel = iroha::consensus::yac::ConsistencyModel::kCft;
 
-/// Database connection pool size. Limits the number of similtaneous accesses.
-static constexpr int kDbPoolSize = 10;
+/// Period of downloading the new blocks by a query replica.
+static constexpr std::chrono::milliseconds kChainFollowerPeriod = 1s;
 
 /**
  * Configuring iroha daemon
@@ -121,7 +128,15 @@ Irohad::Irohad(
     const boost::optional<GossipPropagationStrategyParams>
         &opt_mst_gossip_params,
     const boost::optional<iroha::torii::TlsParams> &torii_tls_params,
-    boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config)
+    boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config,
+    boost::optional<size_t> wsv_cache_size,
+    bool block_store_segmented,
+    PeerMode peer_mode,
+    WsvSnapshotOptions wsv_snapshot_options,
+    ametsuchi::PoolOptions pool_options,
+    TxCacheOptions tx_cache_options,
+    size_t stream_queue_size,
+    size_t verification_threads)
     : block_store_dir_(block_store_dir),
       listen_ip_(listen_ip),
       torii_port_(torii_port),
@@ -137,6 +152,14 @@ Irohad::Irohad(
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
       inter_peer_tls_config_(std::move(inter_peer_tls_config)),
+      wsv_cache_size_(wsv_cache_size),
+      block_store_segmented_(block_store_segmented),
+      peer_mode_(peer_mode),
+      wsv_snapshot_options_(std::move(wsv_snapshot_options)),
+      pool_options_(std::move(pool_options)),
+      tx_cache_options_(std::move(tx_cache_options)),
+      stream_queue_size_(stream_queue_size),
+      verification_threads_(verification_threads),
       pending_txs_storage_init(
           std::make_unique<PendingTransactionStorageInit>()),
       keypair(keypair),
@@ -171,12 +194,33 @@ Irohad::~Irohad() {
   }
   consensus_gate_objects_lifetime.unsubscribe();
   consensus_gate_events_subscription.unsubscribe();
+  pool_stats_subscription_.unsubscribe();
+  cache_stats_subscription_.unsubscribe();
 }
 
 /**
  * Initializing iroha daemon
  */
 Irohad::RunResult Irohad::init() {
+  if (peer_mode_ == PeerMode::kQueryReplica) {
+    // clang-format off
+    return initSettings()
+    | [this]{ return initValidatorsConfigs();}
+    | [this]{ return initWsvRestorer();}
+    | [this]{ return restoreWsv();}
+    | [this]{ return initTlsCredentials();}
+    | [this]{ return initBatchParser();}
+    | [this]{ return initValidators();}
+    | [this]{ return initFactories();}
+    | [this]{ return initConsensusCache();}
+    | [this]{ return initBlockLoader();}
+    | [this]{ return initChainFollower();}
+
+    // Torii
+    | [this]{ return initQueryService();};
+    // clang-format on
+  }
+
   // clang-format off
   return initSettings()
   | [this]{ return initValidatorsConfigs();}
@@ -255,6 +299,50 @@ Irohad::RunResult Irohad::initValidatorsConfigs() {
   return {};
 }
 
+/**
+ * Loading WSV snapshot and blocks from another peer
+ */
+Irohad::RunResult Irohad::loadWsvSnapshot(BlockStorage &block_storage) {
+  if (not wsv_snapshot_options_.genesis_block) {
+    return expected::makeError(
+        "The local genesis block is required to verify WSV snapshot.");
+  }
+  if (not wsv_snapshot_options_.root_certificate_path) {
+    return expected::makeError(
+        "The root certificate is required to verify WSV snapshot server.");
+  }
+  // the channel is created directly, since the inter-peer client factory is
+  // not available yet at the storage initialization
+  return readTextFile(*wsv_snapshot_options_.root_certificate_path) |
+             [this, &block_storage](auto &&root_certificate) -> RunResult {
+    grpc::SslCredentialsOptions credentials_options;
+    credentials_options.pem_root_certs = std::move(root_certificate);
+    grpc::ChannelArguments args;
+    args.SetMaxReceiveMessageSize(std::numeric_limits<int>::max());
+    auto stub = network::proto::Loader::NewStub(
+        grpc::CreateCustomChannel(*wsv_snapshot_options_.peer,
+                                  grpc::SslCredentials(credentials_options),
+                                  args));
+    network::WsvSnapshotLoader loader(
+        std::move(stub),
+        shared_model::proto::ProtoBlockFactory(
+            std::make_unique<shared_model::validation::AlwaysValidValidator<
+                shared_model::interface::Block>>(),
+            std::make_unique<shared_model::validation::ProtoBlockValidator>()),
+        wsv_snapshot_options_.timeout,
+        log_manager_->getChild("WsvSnapshotLoader")->getLogger());
+    soci::session sql(*pool_wrapper_->connection_pool_);
+    return bootstrapFromWsvSnapshot(
+               loader,
+               sql,
+               block_storage,
+               *wsv_snapshot_options_.genesis_block,
+               *getSupermajorityChecker(kConsensusConsistencyModel),
+               log_manager_->getChild("WsvSnapshot")->getLogger())
+        | [](auto &&) -> RunResult { return {}; };
+  };
+}
+
 /**
  * Initializing iroha daemon storage
  */
@@ -267,11 +355,40 @@ Irohad::RunResult Irohad::initStorage(
                return PgConnectionInit::prepareConnectionPool(
                    iroha::ametsuchi::KTimesReconnectionStrategyFactory{10},
                    *pg_opt_,
-                   kDbPoolSize,
+                   pool_options_,
                    log_manager_);
              }
              | [this](auto &&pool_wrapper) -> RunResult {
     pool_wrapper_ = std::move(pool_wrapper);
+    if (pool_options_.stats_period) {
+      rxcpp::observable<>::interval(std::chrono::steady_clock::now(),
+                                    *pool_options_.stats_period,
+                                    rxcpp::observe_on_new_thread())
+          .subscribe(pool_stats_subscription_,
+                     [lanes = pool_wrapper_->lanes(),
+                      log = log_manager_->getChild("DbPool")->getLogger()](
+                         auto) {
+                       for (const auto &lane : lanes) {
+                         auto stats = lane->stats();
+                         log->info(
+                             "{} connections: {} of {} in use, {} waiting, "
+                             "{} leased, {} rejected, {} timed out, "
+                             "average wait {}us, max wait {}us",
+                             lane->name(),
+                             stats.in_use,
+                             stats.size,
+                             stats.waiting,
+                             stats.leased,
+                             stats.rejected,
+                             stats.timed_out,
+                             stats.leased + stats.timed_out > 0
+                                 ? stats.total_wait.count()
+                                     / (stats.leased + stats.timed_out)
+                                 : 0,
+                             stats.max_wait.count());
+                       }
+                     });
+    }
     query_response_factory_ =
         std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
     auto perm_converter =
@@ -293,7 +410,18 @@ Irohad::RunResult Irohad::initStorage(
             log_manager_->getChild("TemporaryBlockStorage")->getLogger());
 
     std::unique_ptr<BlockStorage> persistent_block_storage;
-    if (block_store_dir_) {
+    if (block_store_dir_ and block_store_segmented_) {
+      persistent_block_storage =
+          SegmentedFileBlockStorageFactory(
+              [this] { return *block_store_dir_; },
+              block_transport_factory,
+              log_manager_)
+              .create();
+      if (not persistent_block_storage) {
+        return expected::makeError(
+            "Unable to create SegmentedFile for persistent storage");
+      }
+    } else if (block_store_dir_) {
       auto flat_file = FlatFile::create(
           *block_store_dir_, log_manager_->getChild("FlatFile")->getLogger());
       if (not flat_file) {
@@ -320,6 +448,17 @@ Irohad::RunResult Irohad::initStorage(
       persistent_block_storage = std::make_unique<PostgresBlockStorage>(
           pool_wrapper_, block_transport_factory, persistent_table, log_);
     }
+    if (wsv_snapshot_options_.peer) {
+      if (persistent_block_storage->size() != 0) {
+        log_->warn("Block storage is not empty, WSV snapshot is not loaded.");
+      } else if (auto e = expected::resultToOptionalError(
+                     loadWsvSnapshot(*persistent_block_storage))) {
+        return expected::makeError(
+            fmt::format("Failed to load WSV snapshot from {}: {}",
+                        *wsv_snapshot_options_.peer,
+                        e.value()));
+      }
+    }
     std::optional<std::reference_wrapper<const iroha::ametsuchi::VmCaller>>
         vm_caller_ref;
     if (vm_caller_) {
@@ -333,7 +472,11 @@ Irohad::RunResult Irohad::initStorage(
                                std::move(temporary_block_storage_factory),
                                std::move(persistent_block_storage),
                                vm_caller_ref,
-                               log_manager_->getChild("Storage"))
+                               log_manager_->getChild("Storage"),
+                               pool_options_.commit_connections,
+                               wsv_cache_size_
+                                   ? std::make_shared<WsvCache>(*wsv_cache_size_)
+                                   : nullptr)
                | [&](auto &&v) -> RunResult {
       storage = std::move(v);
       finalized_txs_ =
@@ -407,7 +550,12 @@ Irohad::RunResult Irohad::initTlsCredentials() {
   return load_tls_creds(p2p_path, "inter peer", my_inter_peer_tls_creds_) |
       [&, this] {
         return load_tls_creds(torii_path, "torii", this->torii_tls_creds_);
-      };
+      }
+      | [&, this] {
+          return load_tls_creds(wsv_snapshot_options_.key_pair_path,
+                                "WSV snapshot",
+                                this->wsv_snapshot_tls_creds_);
+        };
 }
 
 /**
@@ -585,11 +733,39 @@ Irohad::RunResult Irohad::initFactories() {
   return {};
 }
 
+template <typename Cache>
+void Irohad::logCacheStats(const std::string &name,
+                           std::shared_ptr<Cache> cache) {
+  if (not tx_cache_options_.stats_period) {
+    return;
+  }
+  rxcpp::composite_subscription lifetime;
+  cache_stats_subscription_.add(lifetime);
+  rxcpp::observable<>::interval(std::chrono::steady_clock::now(),
+                                *tx_cache_options_.stats_period,
+                                rxcpp::observe_on_new_thread())
+      .subscribe(lifetime,
+                 [name,
+                  cache = std::move(cache),
+                  log = log_manager_->getChild("TxCache")->getLogger()](auto) {
+                   log->info("{} cache: {} items, {} hits, {} misses",
+                             name,
+                             cache->getCacheItemCount(),
+                             cache->getHits(),
+                             cache->getMisses());
+                 });
+}
+
 /**
  * Initializing persistent cache
  */
 Irohad::RunResult Irohad::initPersistentCache() {
-  persistent_cache = std::make_shared<TxPresenceCacheImpl>(storage);
+  auto cache = std::make_shared<TxPresenceCacheImpl>(
+      storage,
+      tx_cache_options_.presence_cache_size.value_or(
+          iroha::cache::kDefaultCacheCapacity));
+  logCacheStats("Presence", cache);
+  persistent_cache = std::move(cache);
 
   log_->info("[Init] => persistent cache");
   return {};
@@ -744,6 +920,18 @@ Irohad::RunResult Irohad::initBlockLoader() {
                                   block_validators_config_,
                                   log_manager_->getChild("BlockLoader"));
 
+  // the snapshots are served by a separate TLS server only, since an export
+  // holds a database connection and a long transaction
+  if (wsv_snapshot_options_.export_port) {
+    wsv_snapshot_service = std::make_shared<network::BlockLoaderService>(
+        storage,
+        consensus_result_cache_,
+        log_manager_->getChild("WsvSnapshotService")->getLogger(),
+        std::make_shared<PostgresWsvSnapshotExporter>(
+            pool_wrapper_,
+            log_manager_->getChild("WsvSnapshot")->getLogger()));
+  }
+
   log_->info("[Init] => block loader");
   return {};
 }
@@ -805,6 +993,26 @@ Irohad::RunResult Irohad::initSynchronizer() {
   };
 }
 
+/**
+ * Initializing chain follower of the query replica
+ */
+Irohad::RunResult Irohad::initChainFollower() {
+  return storage->createCommandExecutor() |
+             [this](auto &&command_executor) -> RunResult {
+    chain_follower = std::make_shared<ChainFollower>(
+        std::move(command_executor),
+        chain_validator,
+        storage,
+        storage,
+        storage,
+        block_loader,
+        log_manager_->getChild("ChainFollower")->getLogger());
+
+    log_->info("[Init] => chain follower");
+    return {};
+  };
+}
+
 /**
  * Initializing peer communication service
  */
@@ -893,6 +1101,11 @@ Irohad::RunResult Irohad::initMstProcessor() {
 }
 
 Irohad::RunResult Irohad::initPendingTxsStorage() {
+  // a query replica does not receive transactions, so pending transactions
+  // queries are rejected by the query executor
+  if (peer_mode_ == PeerMode::kQueryReplica) {
+    return {};
+  }
   pending_txs_storage_ =
       pending_txs_storage_init->createPendingTransactionsStorage();
   log_->info("[Init] => pending transactions storage");
@@ -906,7 +1119,10 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
   auto command_service_log_manager = log_manager_->getChild("CommandService");
   auto status_factory =
       std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
-  auto cs_cache = std::make_shared<::torii::CommandServiceImpl::CacheType>();
+  auto cs_cache = std::make_shared<::torii::CommandServiceImpl::CacheType>(
+      tx_cache_options_.status_cache_size.value_or(
+          iroha::cache::kDefaultCacheCapacity));
+  logCacheStats("Status", cs_cache);
   auto tx_processor = std::make_shared<TransactionProcessorImpl>(
       pcs,
       mst_processor,
@@ -934,7 +1150,9 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
             return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
           }),
           stale_stream_max_rounds_,
-          command_service_log_manager->getChild("Transport")->getLogger());
+          command_service_log_manager->getChild("Transport")->getLogger(),
+          verification_threads_,
+          stream_queue_size_);
 
   log_->info("[Init] => command service");
   return {};
@@ -956,14 +1174,16 @@ Irohad::RunResult Irohad::initQueryService() {
       query_processor,
       query_factory,
       blocks_query_factory,
-      query_service_log_manager->getLogger());
+      query_service_log_manager->getLogger(),
+      stream_queue_size_);
 
   log_->info("[Init] => query service");
   return {};
 }
 
 Irohad::RunResult Irohad::initWsvRestorer() {
-  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
+  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>(
+      log_manager_->getChild("WsvRestorer")->getLogger());
   return {};
 }
 
@@ -980,12 +1200,6 @@ Irohad::RunResult Irohad::run() {
       log_manager_->getChild("ToriiServerRunner")->getLogger(),
       false);
 
-  // Initializing internal server
-  internal_server = std::make_unique<ServerRunner>(
-      listen_ip_ + ":" + std::to_string(internal_port_),
-      log_manager_->getChild("InternalServerRunner")->getLogger(),
-      false);
-
   auto make_port_logger = [this](std::string server_name) {
     return [this, server_name](auto port) -> RunResult {
       log_->info("{} server bound on port {}", server_name, port);
@@ -993,27 +1207,57 @@ Irohad::RunResult Irohad::run() {
     };
   };
 
+  // the asynchronous services are registered with one server only, so the
+  // same server serves the TLS port
+  torii_tls_creds_ | [this](const auto &tls_creds) {
+    torii_server->addListeningAddress(
+        listen_ip_ + ":" + std::to_string(torii_tls_params_->port), tls_creds);
+  };
+
+  // query replica does not accept transactions
+  if (command_service_transport) {
+    torii_server->append(command_service_transport);
+  }
+
   // Run torii server
-  auto run_result = torii_server->append(command_service_transport)
-                        .append(query_service)
-                        .run()
-      | make_port_logger("Torii");
-
-  // Run torii TLS server
-  torii_tls_creds_ | [&, this](const auto &tls_creds) {
-    run_result |= [&, this] {
-      torii_tls_server = std::make_unique<ServerRunner>(
-          listen_ip_ + ":" + std::to_string(torii_tls_params_->port),
-          log_manager_->getChild("ToriiTlsServerRunner")->getLogger(),
+  auto run_result = torii_server->append(query_service).run()
+      | make_port_logger("Torii") | [this]() -> RunResult {
+    if (torii_tls_creds_) {
+      log_->info("Torii TLS server bound on port {}", torii_tls_params_->port);
+    }
+    return {};
+  };
+
+  // Run WSV snapshot server
+  if (wsv_snapshot_service) {
+    run_result |= [&, this]() -> RunResult {
+      if (not wsv_snapshot_tls_creds_) {
+        return expected::makeError(
+            "WSV snapshots are served with a TLS key pair only.");
+      }
+      wsv_snapshot_server = std::make_unique<ServerRunner>(
+          listen_ip_ + ":" + std::to_string(*wsv_snapshot_options_.export_port),
+          log_manager_->getChild("WsvSnapshotServerRunner")->getLogger(),
           false,
-          tls_creds);
-      return (*torii_tls_server)
-                 ->append(command_service_transport)
-                 .append(query_service)
-                 .run()
-          | make_port_logger("Torii TLS");
+          wsv_snapshot_tls_creds_);
+      return wsv_snapshot_server->append(wsv_snapshot_service).run()
+          | make_port_logger("WSV snapshot");
     };
-  };
+  }
+
+  if (peer_mode_ == PeerMode::kQueryReplica) {
+    return run_result | [this]() -> RunResult {
+      chain_follower->start(kChainFollowerPeriod);
+      log_->info("===> iroha query replica initialized");
+      return {};
+    };
+  }
+
+  // Initializing internal server
+  internal_server = std::make_unique<ServerRunner>(
+      listen_ip_ + ":" + std::to_string(internal_port_),
+      log_manager_->getChild("InternalServerRunner")->getLogger(),
+      false);
 
   // Run internal server
   run_result |= [&, this] {
@@ -7,7 +7,9 @@
 #define IROHA_APPLICATION_HPP
 
 #include <optional>
+#include <thread>
 
+#include "ametsuchi/impl/pool_lane.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
@@ -22,6 +24,7 @@
 #include "main/server_runner.hpp"
 #include "main/startup_params.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy_params.hpp"
+#include "network/server_stream.hpp"
 #include "torii/tls_params.hpp"
 
 namespace iroha {
@@ -29,6 +32,7 @@ namespace iroha {
   class PendingTransactionStorageInit;
   class MstProcessor;
   namespace ametsuchi {
+    class BlockStorage;
     class WsvRestorer;
     class TxPresenceCache;
     class Storage;
@@ -55,8 +59,9 @@ namespace iroha {
     class Simulator;
   }
   namespace synchronizer {
+    class ChainFollower;
     class Synchronizer;
-  }
+  }  // namespace synchronizer
   namespace torii {
     class QueryProcessor;
     class StatusBus;
@@ -113,6 +118,22 @@ class Irohad {
    * @param torii_tls_params - optional TLS params for torii.
    * @see iroha::torii::TlsParams
    * @param inter_peer_tls_config - set up TLS in peer-to-peer communication
+   * @param wsv_cache_size - maximum number of WSV rows cached in memory for
+   * asset commands execution. If not provided, the cache is disabled
+   * @param block_store_segmented - keep blocks in block_store_dir in segment
+   * files instead of a file per block
+   * @param peer_mode - @see PeerMode. A query replica does not take part in
+   * consensus, it keeps own WSV up to date with the blocks downloaded from the
+   * ledger peers and serves the queries only
+   * @param wsv_snapshot_options - the peer to take the WSV snapshot from when
+   * the block storage is empty, instead of executing all the blocks, and the
+   * server of the own snapshots
+   * @param pool_options - sizes and limits of the database connection lanes
+   * @param tx_cache_options - sizes of the transaction status caches
+   * @param stream_queue_size - maximum number of responses waiting to be sent
+   * to a status stream or blocks query client
+   * @param verification_threads - number of threads which verify the
+   * transactions received by Torii
    * TODO mboldyrev 03.11.2018 IR-1844 Refactor the constructor.
    */
   Irohad(const boost::optional<std::string> &block_store_dir,
@@ -136,7 +157,15 @@ class Irohad {
          const boost::optional<iroha::torii::TlsParams> &torii_tls_params =
              boost::none,
          boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config =
-             boost::none);
+             boost::none,
+         boost::optional<size_t> wsv_cache_size = boost::none,
+         bool block_store_segmented = false,
+         iroha::PeerMode peer_mode = iroha::PeerMode::kValidator,
+         iroha::WsvSnapshotOptions wsv_snapshot_options = {},
+         iroha::ametsuchi::PoolOptions pool_options = {},
+         iroha::TxCacheOptions tx_cache_options = {},
+         size_t stream_queue_size = iroha::network::kDefaultMaxQueuedResponses,
+         size_t verification_threads = std::thread::hardware_concurrency());
 
   /**
    * Initialization of whole objects in system
@@ -174,6 +203,8 @@ class Irohad {
   virtual RunResult initStorage(
       iroha::StartupWsvDataPolicy startup_wsv_data_policy);
 
+  RunResult loadWsvSnapshot(iroha::ametsuchi::BlockStorage &block_storage);
+
   RunResult initTlsCredentials();
 
   RunResult initPeerCertProvider();
@@ -204,6 +235,8 @@ class Irohad {
 
   virtual RunResult initSynchronizer();
 
+  virtual RunResult initChainFollower();
+
   virtual RunResult initPeerCommunicationService();
 
   virtual RunResult initStatusBus();
@@ -225,6 +258,13 @@ class Irohad {
    */
   virtual RunResult initWsvRestorer();
 
+  /**
+   * Log the size, hits and misses of the cache periodically, if the stats
+   * period of tx_cache_options_ is set
+   */
+  template <typename Cache>
+  void logCacheStats(const std::string &name, std::shared_ptr<Cache> cache);
+
   // constructor dependencies
   const boost::optional<std::string> block_store_dir_;
   const std::string listen_ip_;
@@ -243,11 +283,21 @@ class Irohad {
   boost::optional<iroha::GossipPropagationStrategyParams>
       opt_mst_gossip_params_;
   boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config_;
+  boost::optional<size_t> wsv_cache_size_;
+  bool block_store_segmented_;
+  iroha::PeerMode peer_mode_;
+  iroha::WsvSnapshotOptions wsv_snapshot_options_;
+  iroha::ametsuchi::PoolOptions pool_options_;
+  iroha::TxCacheOptions tx_cache_options_;
+  size_t stream_queue_size_;
+  size_t verification_threads_;
 
   boost::optional<std::shared_ptr<const iroha::network::TlsCredentials>>
       my_inter_peer_tls_creds_;
   boost::optional<std::shared_ptr<const iroha::network::TlsCredentials>>
       torii_tls_creds_;
+  boost::optional<std::shared_ptr<const iroha::network::TlsCredentials>>
+      wsv_snapshot_tls_creds_;
   boost::optional<
       std::shared_ptr<const iroha::network::PeerTlsCertificatesProvider>>
       peer_tls_certificates_provider_;
@@ -279,6 +329,8 @@ class Irohad {
   iroha::network::BlockLoaderInit loader_init;
 
   std::shared_ptr<iroha::ametsuchi::PoolWrapper> pool_wrapper_;
+  rxcpp::composite_subscription pool_stats_subscription_;
+  rxcpp::composite_subscription cache_stats_subscription_;
 
   // Settings
   std::shared_ptr<const shared_model::validation::Settings> settings_;
@@ -355,6 +407,9 @@ class Irohad {
   // synchronizer
   std::shared_ptr<iroha::synchronizer::Synchronizer> synchronizer;
 
+  // chain follower of the query replica
+  std::shared_ptr<iroha::synchronizer::ChainFollower> chain_follower;
+
   // pcs
   std::shared_ptr<iroha::network::PeerCommunicationService> pcs;
 
@@ -379,10 +434,11 @@ class Irohad {
   rxcpp::subjects::subject<iroha::consensus::GateObject> consensus_gate_objects;
   rxcpp::composite_subscription consensus_gate_events_subscription;
 
+  /// serves both the plain and the TLS Torii ports
   std::unique_ptr<iroha::network::ServerRunner> torii_server;
-  boost::optional<std::unique_ptr<iroha::network::ServerRunner>>
-      torii_tls_server = boost::none;
   std::unique_ptr<iroha::network::ServerRunner> internal_server;
+  std::shared_ptr<iroha::network::BlockLoaderService> wsv_snapshot_service;
+  std::unique_ptr<iroha::network::ServerRunner> wsv_snapshot_server;
 
   logger::LoggerManagerTreePtr log_manager_;  ///< application root log manager
 
@@ -89,6 +89,116 @@ namespace {
     };
   }
 
+  /// columns which contain binary data, stored as hex text by older versions
+  const std::vector<std::pair<std::string, std::string>> kBinaryColumns{
+      {"tx_positions", "hash"},
+      {"tx_status_by_hash", "hash"},
+      {"burrow_account_data", "address"},
+      {"burrow_account_key_value", "address"},
+      {"burrow_account_key_value", "key"},
+      {"burrow_account_key_value", "value"}};
+
+  /**
+   * Convert binary columns from hex text to bytea, if the database was
+   * created by a version which stored them as text.
+   * @return error message if the conversion failed
+   */
+  iroha::expected::Result<void, std::string> convertBinaryColumns(
+      const PostgresOptions &postgres_options) {
+    return getWorkingDbSession(postgres_options) |
+               [](auto sql) -> iroha::expected::Result<void, std::string> {
+      try {
+        for (auto column : kBinaryColumns) {
+          std::string data_type;
+          *sql << "SELECT data_type FROM information_schema.columns "
+                  "WHERE table_schema = current_schema() "
+                  "AND table_name = :table AND column_name = :column",
+              soci::into(data_type), soci::use(column.first, "table"),
+              soci::use(column.second, "column");
+          if (not data_type.empty() and data_type != "bytea") {
+            *sql << fmt::format(
+                "ALTER TABLE {0} ALTER COLUMN {1} TYPE bytea "
+                "USING decode({1}, 'hex')",
+                column.first,
+                column.second);
+          }
+        }
+      } catch (std::exception &e) {
+        return fmt::format("Could not convert binary columns: {}",
+                           formatPostgresMessage(e.what()));
+      }
+      return iroha::expected::Value<void>{};
+    };
+  }
+
+  /**
+   * Move account details from the JSON column of the account table to the
+   * table with one row per detail
+   */
+  iroha::expected::Result<void, std::string> convertAccountDetails(
+      const PostgresOptions &postgres_options) {
+    return getWorkingDbSession(postgres_options) |
+               [](auto sql) -> iroha::expected::Result<void, std::string> {
+      try {
+        int count = 0;
+        *sql << "SELECT count(*) FROM information_schema.columns "
+                "WHERE table_schema = current_schema() "
+                "AND table_name = 'account' AND column_name = 'data'",
+            soci::into(count);
+        if (count == 0) {
+          return iroha::expected::Value<void>{};
+        }
+        soci::transaction tr(*sql);
+        *sql << R"(
+CREATE TABLE IF NOT EXISTS account_has_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value jsonb NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+))";
+        *sql << R"(
+INSERT INTO account_has_detail (account_id, writer, key, value)
+SELECT account_id, by_writer.key, detail.key, detail.value
+FROM account,
+    jsonb_each(coalesce(data, '{}'::jsonb)) by_writer,
+    jsonb_each(by_writer.value) detail
+ON CONFLICT DO NOTHING)";
+        *sql << "ALTER TABLE account DROP COLUMN data";
+        tr.commit();
+      } catch (std::exception &e) {
+        return fmt::format("Could not convert account details: {}",
+                           formatPostgresMessage(e.what()));
+      }
+      return iroha::expected::Value<void>{};
+    };
+  }
+
+  /**
+   * Add the columns with the locations of the transactions in the block blobs
+   * to tx_positions. The rows of the blocks committed before stay without
+   * them, so these transactions are read together with the whole blocks.
+   * The blocks written from now on are stored uncompressed, so that the
+   * ranges of the transactions are read without decompressing the blocks
+   */
+  iroha::expected::Result<void, std::string> addTxLocationColumns(
+      const PostgresOptions &postgres_options) {
+    return getWorkingDbSession(postgres_options) |
+               [](auto sql) -> iroha::expected::Result<void, std::string> {
+      try {
+        *sql << "ALTER TABLE tx_positions "
+                "ADD COLUMN IF NOT EXISTS tx_offset bigint, "
+                "ADD COLUMN IF NOT EXISTS tx_size integer";
+        *sql << "ALTER TABLE IF EXISTS blocks "
+                "ALTER COLUMN block_data SET STORAGE EXTERNAL";
+      } catch (std::exception &e) {
+        return fmt::format("Could not add transaction location columns: {}",
+                           formatPostgresMessage(e.what()));
+      }
+      return iroha::expected::Value<void>{};
+    };
+  }
+
   void processPqNotice(void *arg, const char *message) {
     auto *log = reinterpret_cast<logger::Logger *>(arg);
     log->debug("{}", formatPostgresMessage(message));
@@ -142,7 +252,9 @@ PgConnectionInit::prepareWorkingDatabase(
                  "Either overwrite the ledger or use a compatible binary "
                  "version.";
         }
-        return iroha::expected::Value<void>{};
+        return convertBinaryColumns(options) |
+            [&] { return convertAccountDetails(options); } |
+            [&] { return addTxLocationColumns(options); };
       };
     }
     return dropWorkingDatabase(options) | [&] { return createSchema(options); };
@@ -155,7 +267,22 @@ PgConnectionInit::prepareConnectionPool(
     const PostgresOptions &options,
     const int pool_size,
     logger::LoggerManagerTreePtr log_manager) {
+  PoolOptions pool_options;
+  pool_options.commit_connections = pool_size;
+  return prepareConnectionPool(reconnection_strategy_factory,
+                               options,
+                               pool_options,
+                               std::move(log_manager));
+}
+
+iroha::expected::Result<std::shared_ptr<PoolWrapper>, std::string>
+PgConnectionInit::prepareConnectionPool(
+    const ReconnectionStrategyFactory &reconnection_strategy_factory,
+    const PostgresOptions &options,
+    const PoolOptions &pool_options,
+    logger::LoggerManagerTreePtr log_manager) {
   auto options_str = options.workingConnectionString();
+  const auto pool_size = pool_options.commit_connections;
 
   auto conn = initPostgresConnection(options_str, pool_size);
   if (auto e = boost::get<expected::Error<std::string>>(&conn)) {
@@ -183,6 +310,32 @@ PgConnectionInit::prepareConnectionPool(
     std::unique_ptr<FailoverCallbackHolder> failover_callback_factory =
         std::make_unique<FailoverCallbackHolder>();
 
+    /// the lane of the given size with its own connections, or null
+    auto make_lane = [&](const std::string &name,
+                         size_t size,
+                         PoolLane::Limits limits)
+        -> iroha::expected::Result<std::shared_ptr<PoolLane>, std::string> {
+      if (size == 0) {
+        return std::shared_ptr<PoolLane>{};
+      }
+      return initPostgresConnection(options_str, size) |
+          [&](auto &&lane_connection) {
+            return initializeConnectionPool(*lane_connection,
+                                            size,
+                                            [](soci::session &) {},
+                                            *failover_callback_factory,
+                                            reconnection_strategy_factory,
+                                            options_str,
+                                            log_manager->getChild(name))
+                       | [&]() -> iroha::expected::
+                                   Result<std::shared_ptr<PoolLane>,
+                                          std::string> {
+              return std::make_shared<PoolLane>(
+                  name, std::move(lane_connection), size, std::move(limits));
+            };
+          };
+    };
+
     return initializeConnectionPool(*connection,
                                     pool_size,
                                     try_rollback,
@@ -190,13 +343,32 @@ PgConnectionInit::prepareConnectionPool(
                                     reconnection_strategy_factory,
                                     options_str,
                                     log_manager)
-               | [&]() -> iroha::expected::Result<std::shared_ptr<PoolWrapper>,
-                                                  std::string> {
-      return std::make_shared<iroha::ametsuchi::PoolWrapper>(
-          std::move(connection),
-          std::move(failover_callback_factory),
-          enable_prepared_transactions);
-    };
+               | [&] {
+                   return make_lane("validation",
+                                    pool_options.validation_connections,
+                                    PoolLane::Limits{});
+                 }
+               | [&](auto &&validation_lane) {
+                   return make_lane(
+                              "query",
+                              pool_options.query_connections,
+                              PoolLane::Limits{pool_options.max_waiting_queries,
+                                               pool_options.query_wait_timeout})
+                       | [&](auto &&query_lane)
+                              -> iroha::expected::
+                                  Result<std::shared_ptr<PoolWrapper>,
+                                         std::string> {
+                     auto commit_lane = std::make_shared<PoolLane>(
+                         "commit", connection, pool_size, PoolLane::Limits{});
+                     return std::make_shared<iroha::ametsuchi::PoolWrapper>(
+                         std::move(connection),
+                         std::move(failover_callback_factory),
+                         enable_prepared_transactions,
+                         std::move(commit_lane),
+                         std::move(validation_lane),
+                         std::move(query_lane));
+                   };
+                 };
 
   } catch (const std::exception &e) {
     return expected::makeError(e.what());
@@ -323,9 +495,15 @@ CREATE TABLE account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE account_has_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value jsonb NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
 CREATE TABLE account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
     public_key varchar NOT NULL REFERENCES signatory,
@@ -371,11 +549,13 @@ CREATE TABLE account_has_grantable_permissions (
 );
 CREATE TABLE IF NOT EXISTS tx_positions (
     creator_id text,
-    hash varchar(64) not null,
+    hash bytea not null,
     asset_id text,
     ts bigint,
     height bigint,
-    index bigint
+    index bigint,
+    tx_offset bigint,
+    tx_size integer
 );
 CREATE INDEX IF NOT EXISTS tx_positions_hash_index
     ON tx_positions
@@ -388,7 +568,7 @@ CREATE INDEX IF NOT EXISTS tx_positions_ts_height_index_index
     ON tx_positions
     (ts);
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
 CREATE INDEX tx_status_by_hash_hash_index
@@ -410,14 +590,14 @@ CREATE TABLE IF NOT EXISTS engine_calls (
     PRIMARY KEY (tx_hash, cmd_index)
 );
 CREATE TABLE IF NOT EXISTS burrow_account_data (
-    address varchar(40),
+    address bytea,
     data text,
     PRIMARY KEY (address)
 );
 CREATE TABLE IF NOT EXISTS burrow_account_key_value (
-    address varchar(40),
-    key varchar(64),
-    value text,
+    address bytea,
+    key bytea,
+    value bytea,
     PRIMARY KEY (address, key)
 );
 CREATE TABLE IF NOT EXISTS burrow_tx_logs (
@@ -14,6 +14,7 @@
 #include <boost/range/algorithm/replace_if.hpp>
 
 #include "ametsuchi/impl/failover_callback_holder.hpp"
+#include "ametsuchi/impl/pool_lane.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
@@ -41,6 +42,17 @@ namespace iroha {
           const int pool_size,
           logger::LoggerManagerTreePtr log_manager);
 
+      /**
+       * Prepare the connection pool with the lanes of the pool options. The
+       * lanes of nonzero size get their own connections
+       */
+      static expected::Result<std::shared_ptr<PoolWrapper>, std::string>
+      prepareConnectionPool(
+          const ReconnectionStrategyFactory &reconnection_strategy_factory,
+          const PostgresOptions &options,
+          const PoolOptions &pool_options,
+          logger::LoggerManagerTreePtr log_manager);
+
       /**
        * Verify whether postgres supports prepared transactions
        */
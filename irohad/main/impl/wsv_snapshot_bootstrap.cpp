@@ -0,0 +1,166 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "main/impl/wsv_snapshot_bootstrap.hpp"
+
+#include <set>
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+#include "common/bind.hpp"
+#include "common/visitor.hpp"
+#include "consensus/yac/supermajority_checker.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+#include "network/impl/wsv_snapshot_loader.hpp"
+
+namespace {
+  /// Public keys of the peers in the form they are kept in WSV
+  using PeerKeys = std::set<std::string>;
+
+  /**
+   * Check that the block is signed by the supermajority of the peers
+   */
+  bool signedBySupermajority(
+      const shared_model::interface::Block &block,
+      const PeerKeys &peer_keys,
+      const iroha::consensus::yac::SupermajorityChecker &checker) {
+    PeerKeys signers;
+    for (const auto &signature : block.signatures()) {
+      auto public_key = boost::algorithm::to_lower_copy(signature.publicKey());
+      if (peer_keys.count(public_key) != 0
+          and iroha::expected::hasValue(
+                  shared_model::crypto::CryptoVerifier::verify(
+                      shared_model::interface::types::SignedHexStringView{
+                          signature.signedData()},
+                      block.payload(),
+                      shared_model::interface::types::PublicKeyHexStringView{
+                          signature.publicKey()}))) {
+        signers.insert(std::move(public_key));
+      }
+    }
+    return checker.hasSupermajority(signers.size(), peer_keys.size());
+  }
+
+  /**
+   * Apply the peer commands of the block to the peers of the ledger, so that
+   * they are the peers which sign the next block
+   */
+  void applyPeerCommands(const shared_model::interface::Block &block,
+                         PeerKeys &peer_keys) {
+    for (const auto &transaction : block.transactions()) {
+      for (const auto &command : transaction.commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [&peer_keys](const shared_model::interface::AddPeer &add_peer) {
+              peer_keys.insert(
+                  boost::algorithm::to_lower_copy(add_peer.peer().pubkey()));
+            },
+            [&peer_keys](
+                const shared_model::interface::RemovePeer &remove_peer) {
+              peer_keys.erase(
+                  boost::algorithm::to_lower_copy(remove_peer.pubkey()));
+            },
+            [](const auto &) {});
+      }
+    }
+  }
+}  // namespace
+
+namespace iroha {
+
+  expected::Result<TopBlockInfo, std::string> bootstrapFromWsvSnapshot(
+      network::WsvSnapshotLoader &loader,
+      soci::session &sql,
+      ametsuchi::BlockStorage &block_storage,
+      const shared_model::interface::Block &genesis_block,
+      const consensus::yac::SupermajorityChecker &supermajority_checker,
+      logger::LoggerPtr log) {
+    ametsuchi::PostgresWsvSnapshotImporter importer(sql, log);
+    boost::optional<ametsuchi::WsvSnapshotInfo> snapshot_info;
+    std::shared_ptr<const shared_model::interface::Block> top_block;
+    PeerKeys peer_keys;
+
+    auto result = loader.retrieveSnapshot(importer) |
+                      [&](auto &&info) {
+                        snapshot_info = std::move(info);
+                        return importer.finish(*snapshot_info);
+                      }
+                  | [&]() -> expected::Result<void, std::string> {
+      const auto &top_block_info = snapshot_info->top_block_info;
+      log->info("Loading {} blocks below WSV snapshot",
+                top_block_info.height);
+      return loader.retrieveBlocks(
+                 top_block_info.height,
+                 [&](std::shared_ptr<shared_model::interface::Block> block)
+                     -> expected::Result<void, std::string> {
+                   // the peers which sign each block are known from the
+                   // local genesis block and the blocks before it
+                   if (not top_block) {
+                     if (block->hash() != genesis_block.hash()) {
+                       return "Genesis block does not match the local one.";
+                     }
+                   } else if (block->prevHash() != top_block->hash()) {
+                     return fmt::format(
+                         "Block {} is not linked to the previous one.",
+                         block->height());
+                   } else if (not signedBySupermajority(
+                                  *block, peer_keys, supermajority_checker)) {
+                     return fmt::format(
+                         "Block {} is not signed by the supermajority of the "
+                         "ledger peers.",
+                         block->height());
+                   }
+                   applyPeerCommands(*block, peer_keys);
+                   if (not block_storage.insert(block)) {
+                     return fmt::format("Failed to store block {}.",
+                                        block->height());
+                   }
+                   top_block = std::move(block);
+                   return {};
+                 })
+          | [&]() -> expected::Result<void, std::string> {
+        if (not top_block) {
+          return "WSV snapshot has no blocks.";
+        }
+        if (top_block->hash() != top_block_info.top_hash) {
+          return fmt::format(
+              "Top block hash {} does not match WSV snapshot top block {}.",
+              top_block->hash(),
+              top_block_info.top_hash);
+        }
+        auto peers = ametsuchi::PostgresWsvQuery(sql, log).getPeers();
+        if (not peers) {
+          return "Failed to get the peers of WSV snapshot.";
+        }
+        PeerKeys snapshot_peer_keys;
+        for (const auto &peer : *peers) {
+          snapshot_peer_keys.insert(peer->pubkey());
+        }
+        if (snapshot_peer_keys != peer_keys) {
+          return "Peers of WSV snapshot do not match the peers of the blocks.";
+        }
+        return importer.commit();
+      };
+    };
+
+    if (auto e = expected::resultToOptionalError(result)) {
+      block_storage.clear();
+      return expected::makeError(std::move(e).value());
+    }
+    log->info("Started from WSV snapshot at height {}",
+              snapshot_info->top_block_info.height);
+    return snapshot_info->top_block_info;
+  }
+
+}  // namespace iroha
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_BOOTSTRAP_HPP
+#define IROHA_WSV_SNAPSHOT_BOOTSTRAP_HPP
+
+#include <string>
+
+#include "ametsuchi/ledger_state.hpp"
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+    class BlockStorage;
+  }
+  namespace consensus {
+    namespace yac {
+      class SupermajorityChecker;
+    }
+  }  // namespace consensus
+  namespace network {
+    class WsvSnapshotLoader;
+  }
+
+  /**
+   * Fill the empty WSV and block storage from the WSV snapshot of a peer and
+   * the blocks below it, without executing the blocks. The serving peer is
+   * not trusted: the first block must be the local genesis block, each next
+   * one must be linked to the previous one and signed by the supermajority of
+   * the peers added and removed by the blocks before it, the last one must be
+   * the top block of the snapshot, and the peers of the snapshot must be the
+   * peers after the last block
+   * @param loader - loader of the snapshot and the blocks from the peer
+   * @param sql - session without an open transaction, to import the WSV
+   * @param block_storage - empty block storage
+   * @param genesis_block - the local genesis block, which the trust is
+   * anchored in
+   * @param supermajority_checker - checker of the block signatures
+   * @return the top block of the imported WSV or error, in which case
+   * neither the WSV nor the block storage is changed
+   */
+  expected::Result<TopBlockInfo, std::string> bootstrapFromWsvSnapshot(
+      network::WsvSnapshotLoader &loader,
+      soci::session &sql,
+      ametsuchi::BlockStorage &block_storage,
+      const shared_model::interface::Block &genesis_block,
+      const consensus::yac::SupermajorityChecker &supermajority_checker,
+      logger::LoggerPtr log);
+
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_BOOTSTRAP_HPP
@@ -33,6 +33,8 @@ namespace config_members {
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *StreamQueueSize = "stream_queue_size";
+  const char *VerificationThreads = "verification_threads";
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
@@ -54,4 +56,20 @@ namespace config_members {
   const char *PythonPaths = "python_paths";
   const char *ModuleName = "module_name";
   const char *InitArgument = "initialization_argument";
+  const char *WsvCacheSize = "wsv_cache_size";
+  const char *TxStatusCacheSize = "tx_status_cache_size";
+  const char *TxPresenceCacheSize = "tx_presence_cache_size";
+  const char *CacheStatsPeriod = "cache_stats_period_ms";
+  const char *BlockStoreSegmented = "block_store_segmented";
+  const char *DbPool = "db_pool";
+  const char *CommitConnections = "commit_connections";
+  const char *ValidationConnections = "validation_connections";
+  const char *QueryConnections = "query_connections";
+  const char *MaxWaitingQueries = "max_waiting_queries";
+  const char *QueryWaitTimeout = "query_wait_timeout_ms";
+  const char *StatsPeriod = "stats_period_ms";
+  const char *WsvSnapshot = "wsv_snapshot";
+  const char *ExportPort = "export_port";
+  const char *RootCertPath = "root_certificate_path";
+  const char *WsvSnapshotTimeout = "timeout_ms";
 }  // namespace config_members
@@ -39,6 +39,8 @@ namespace config_members {
   extern const char *MstExpirationTime;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
+  extern const char *StreamQueueSize;
+  extern const char *VerificationThreads;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
@@ -54,6 +56,22 @@ namespace config_members {
   extern const char *PythonPaths;
   extern const char *ModuleName;
   extern const char *InitArgument;
+  extern const char *WsvCacheSize;
+  extern const char *TxStatusCacheSize;
+  extern const char *TxPresenceCacheSize;
+  extern const char *CacheStatsPeriod;
+  extern const char *BlockStoreSegmented;
+  extern const char *DbPool;
+  extern const char *CommitConnections;
+  extern const char *ValidationConnections;
+  extern const char *QueryConnections;
+  extern const char *MaxWaitingQueries;
+  extern const char *QueryWaitTimeout;
+  extern const char *StatsPeriod;
+  extern const char *WsvSnapshot;
+  extern const char *ExportPort;
+  extern const char *RootCertPath;
+  extern const char *WsvSnapshotTimeout;
 
 }  // namespace config_members
 
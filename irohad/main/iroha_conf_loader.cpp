@@ -470,6 +470,52 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::UtilityService>(
   getValByKey(path, dest.port, obj, config_members::Port);
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::DbPool>(
+    const std::string &path,
+    IrohadConfig::DbPool &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(
+      path, dest.commit_connections, obj, config_members::CommitConnections);
+  getValByKey(path,
+              dest.validation_connections,
+              obj,
+              config_members::ValidationConnections);
+  getValByKey(
+      path, dest.query_connections, obj, config_members::QueryConnections);
+  getValByKey(
+      path, dest.max_waiting_queries, obj, config_members::MaxWaitingQueries);
+  getValByKey(
+      path, dest.query_wait_timeout_ms, obj, config_members::QueryWaitTimeout);
+  getValByKey(path, dest.stats_period_ms, obj, config_members::StatsPeriod);
+  assert_fatal(not dest.commit_connections or *dest.commit_connections > 0,
+               path + " must have at least one commit connection.");
+  const bool has_query_lane =
+      dest.query_connections and *dest.query_connections > 0;
+  assert_fatal(
+      has_query_lane
+          or not(dest.max_waiting_queries or dest.query_wait_timeout_ms),
+      path + " must have query connections to limit the waiting queries.");
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::WsvSnapshot>(
+    const std::string &path,
+    IrohadConfig::WsvSnapshot &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.export_port, obj, config_members::ExportPort);
+  getValByKey(path, dest.key_pair_path, obj, config_members::KeyPairPath);
+  getValByKey(
+      path, dest.root_certificate_path, obj, config_members::RootCertPath);
+  getValByKey(path, dest.timeout_ms, obj, config_members::WsvSnapshotTimeout);
+  assert_fatal(not dest.export_port or dest.key_pair_path,
+               path + " must have a TLS key pair to export WSV snapshots.");
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig::DataModelModule::Python>(
     const std::string &path,
@@ -537,11 +583,34 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
               dest.stale_stream_max_rounds,
               obj,
               config_members::StaleStreamMaxRounds);
+  getValByKey(
+      path, dest.stream_queue_size, obj, config_members::StreamQueueSize);
+  getValByKey(path,
+              dest.verification_threads,
+              obj,
+              config_members::VerificationThreads);
+  assert_fatal(not dest.verification_threads or *dest.verification_threads > 0,
+               path + " must have at least one verification thread.");
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
   getValByKey(path, dest.utility_service, obj, config_members::UtilityService);
   getValByKey(
       path, dest.data_model_modules, obj, config_members::DataModelModules);
+  getValByKey(path, dest.wsv_cache_size, obj, config_members::WsvCacheSize);
+  getValByKey(
+      path, dest.tx_status_cache_size, obj, config_members::TxStatusCacheSize);
+  getValByKey(path,
+              dest.tx_presence_cache_size,
+              obj,
+              config_members::TxPresenceCacheSize);
+  getValByKey(
+      path, dest.cache_stats_period_ms, obj, config_members::CacheStatsPeriod);
+  getValByKey(path,
+              dest.block_store_segmented,
+              obj,
+              config_members::BlockStoreSegmented);
+  getValByKey(path, dest.db_pool, obj, config_members::DbPool);
+  getValByKey(path, dest.wsv_snapshot, obj, config_members::WsvSnapshot);
 }
 
 // ------------ end of getVal(path, dst, src) specializations ------------
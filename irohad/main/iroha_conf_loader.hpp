@@ -44,6 +44,24 @@ struct IrohadConfig {
     uint16_t port;
   };
 
+  /// Sizes and limits of the database connection lanes
+  struct DbPool {
+    boost::optional<uint32_t> commit_connections;
+    boost::optional<uint32_t> validation_connections;
+    boost::optional<uint32_t> query_connections;
+    boost::optional<uint32_t> max_waiting_queries;
+    boost::optional<uint32_t> query_wait_timeout_ms;
+    boost::optional<uint32_t> stats_period_ms;
+  };
+
+  /// Serving of the WSV snapshots to the new peers and loading of them
+  struct WsvSnapshot {
+    boost::optional<uint16_t> export_port;
+    boost::optional<std::string> key_pair_path;
+    boost::optional<std::string> root_certificate_path;
+    boost::optional<uint32_t> timeout_ms;
+  };
+
   struct DataModelModule {
     struct Python {
       std::vector<std::string> python_paths;
@@ -74,10 +92,19 @@ struct IrohadConfig {
   boost::optional<uint32_t> mst_expiration_time;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
+  boost::optional<uint32_t> stream_queue_size;
+  boost::optional<uint32_t> verification_threads;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
   boost::optional<UtilityService> utility_service;
   boost::optional<std::vector<DataModelModule>> data_model_modules;
+  boost::optional<uint32_t> wsv_cache_size;
+  boost::optional<uint32_t> tx_status_cache_size;
+  boost::optional<uint32_t> tx_presence_cache_size;
+  boost::optional<uint32_t> cache_stats_period_ms;
+  boost::optional<bool> block_store_segmented;
+  boost::optional<DbPool> db_pool;
+  boost::optional<WsvSnapshot> wsv_snapshot;
 };
 
 /**
@@ -94,6 +94,16 @@ DEFINE_bool(overwrite_ledger, false, "Overwrite ledger data if existing");
 
 DEFINE_bool(reuse_state, false, "Try to reuse existing state data at startup.");
 
+DEFINE_bool(query_replica,
+            false,
+            "Follow the ledger without taking part in consensus and serve "
+            "queries only.");
+
+DEFINE_string(wsv_snapshot_peer,
+              "",
+              "Address of the WSV snapshot server of the peer to load the WSV "
+              "snapshot from when the block store is empty.");
+
 static bool validateVerbosity(const char *flagname, const std::string &val) {
   if (val == kLogSettingsFromConfigFile) {
     return true;
@@ -278,6 +288,68 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  iroha::ametsuchi::PoolOptions pool_options;
+  if (config.db_pool) {
+    const auto &db_pool = *config.db_pool;
+    pool_options.commit_connections =
+        db_pool.commit_connections.value_or(pool_options.commit_connections);
+    pool_options.validation_connections =
+        db_pool.validation_connections.value_or(
+            pool_options.validation_connections);
+    pool_options.query_connections =
+        db_pool.query_connections.value_or(pool_options.query_connections);
+    pool_options.max_waiting_queries =
+        db_pool.max_waiting_queries.value_or(pool_options.max_waiting_queries);
+    if (db_pool.query_wait_timeout_ms) {
+      pool_options.query_wait_timeout =
+          std::chrono::milliseconds(*db_pool.query_wait_timeout_ms);
+    }
+    if (db_pool.stats_period_ms) {
+      pool_options.stats_period =
+          std::chrono::milliseconds(*db_pool.stats_period_ms);
+    }
+  }
+
+  iroha::TxCacheOptions tx_cache_options;
+  tx_cache_options.status_cache_size = config.tx_status_cache_size;
+  tx_cache_options.presence_cache_size = config.tx_presence_cache_size;
+  if (config.cache_stats_period_ms) {
+    tx_cache_options.stats_period =
+        std::chrono::milliseconds(*config.cache_stats_period_ms);
+  }
+
+  iroha::WsvSnapshotOptions wsv_snapshot_options;
+  if (config.wsv_snapshot) {
+    wsv_snapshot_options.export_port = config.wsv_snapshot->export_port;
+    wsv_snapshot_options.key_pair_path = config.wsv_snapshot->key_pair_path;
+    wsv_snapshot_options.root_certificate_path =
+        config.wsv_snapshot->root_certificate_path;
+    if (config.wsv_snapshot->timeout_ms) {
+      wsv_snapshot_options.timeout =
+          std::chrono::milliseconds(*config.wsv_snapshot->timeout_ms);
+    }
+  }
+  if (not FLAGS_wsv_snapshot_peer.empty()) {
+    // the blocks of the snapshot peer are verified from the local genesis
+    // block, which is not inserted then
+    if (FLAGS_genesis_block.empty() or FLAGS_overwrite_ledger) {
+      log->error(
+          "WSV snapshot is loaded with --genesis_block to verify it and "
+          "without --overwrite_ledger.");
+      return EXIT_FAILURE;
+    }
+    auto block_result =
+        iroha::readTextFile(FLAGS_genesis_block) | [](const auto &json) {
+          return iroha::main::BlockLoader::parseBlock(json);
+        };
+    if (auto e = iroha::expected::resultToOptionalError(block_result)) {
+      log->error("Failed to parse genesis block: {}", e.value());
+      return EXIT_FAILURE;
+    }
+    wsv_snapshot_options.peer = FLAGS_wsv_snapshot_peer;
+    wsv_snapshot_options.genesis_block = std::move(block_result).assumeValue();
+  }
+
   // Configuring iroha daemon
   auto irohad = std::make_unique<Irohad>(
       config.block_store_path,
@@ -302,7 +374,18 @@ int main(int argc, char *argv[]) {
       boost::make_optional(config.mst_support,
                            iroha::GossipPropagationStrategyParams{}),
       config.torii_tls_params,
-      boost::none);
+      boost::none,
+      boost::optional<size_t>(config.wsv_cache_size),
+      config.block_store_segmented.value_or(false),
+      FLAGS_query_replica ? iroha::PeerMode::kQueryReplica
+                          : iroha::PeerMode::kValidator,
+      std::move(wsv_snapshot_options),
+      std::move(pool_options),
+      std::move(tx_cache_options),
+      config.stream_queue_size.value_or(
+          iroha::network::kDefaultMaxQueuedResponses),
+      config.verification_threads.value_or(
+          std::thread::hardware_concurrency()));
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad->storage) {
@@ -333,8 +416,10 @@ int main(int argc, char *argv[]) {
   /// if there are any blocks in blockstore, then true
   bool blockstore = irohad->storage->getBlockQuery()->getTopBlockHeight() != 0;
 
-  /// genesis block file is specified as launch parameter
-  bool genesis = not FLAGS_genesis_block.empty();
+  /// genesis block file is specified as launch parameter, and it is not the
+  /// trust anchor of WSV snapshot
+  bool genesis =
+      not FLAGS_genesis_block.empty() and FLAGS_wsv_snapshot_peer.empty();
 
   /// overwrite ledger flag was set as launch parameter
   bool overwrite = FLAGS_overwrite_ledger;
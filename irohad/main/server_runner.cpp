@@ -5,11 +5,13 @@
 
 #include "main/server_runner.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 #include <grpc/impl/codegen/grpc_types.h>
 #include <boost/format.hpp>
 #include "logger/logger.hpp"
+#include "network/async_grpc_service.hpp"
 #include "network/impl/tls_credentials.hpp"
 
 using namespace iroha::network;
@@ -40,11 +42,14 @@ ServerRunner::ServerRunner(
     const std::string &address,
     logger::LoggerPtr log,
     bool reuse,
-    const boost::optional<std::shared_ptr<const TlsCredentials>> &my_tls_creds)
+    const boost::optional<std::shared_ptr<const TlsCredentials>> &my_tls_creds,
+    size_t completion_queue_threads)
     : log_(std::move(log)),
       server_address_(address),
       credentials_(createCredentials(my_tls_creds)),
-      reuse_(reuse) {}
+      reuse_(reuse),
+      completion_queue_threads_(
+          std::max<size_t>(completion_queue_threads, 1)) {}
 
 ServerRunner::~ServerRunner() {
   shutdown(std::chrono::system_clock::now());
@@ -55,6 +60,13 @@ ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service) {
   return *this;
 }
 
+ServerRunner &ServerRunner::addListeningAddress(
+    const std::string &address,
+    const boost::optional<std::shared_ptr<const TlsCredentials>> &tls_creds) {
+  additional_addresses_.emplace_back(address, createCredentials(tls_creds));
+  return *this;
+}
+
 iroha::expected::Result<int, std::string> ServerRunner::run() {
   grpc::ServerBuilder builder;
   int selected_port = 0;
@@ -64,9 +76,26 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   }
 
   builder.AddListeningPort(server_address_, credentials_, &selected_port);
+  std::vector<int> additional_ports(additional_addresses_.size(), 0);
+  for (size_t i = 0; i < additional_addresses_.size(); ++i) {
+    builder.AddListeningPort(additional_addresses_[i].first,
+                             additional_addresses_[i].second,
+                             &additional_ports[i]);
+  }
 
+  std::vector<std::shared_ptr<AsyncGrpcService>> async_services;
   for (auto &service : services_) {
     builder.RegisterService(service.get());
+    if (auto async_service =
+            std::dynamic_pointer_cast<AsyncGrpcService>(service)) {
+      async_services.push_back(std::move(async_service));
+    }
+  }
+  if (not async_services.empty()) {
+    for (size_t i = 0; i < completion_queue_threads_; ++i) {
+      completion_queues_.push_back(
+          std::make_shared<AsyncCallQueue>(builder.AddCompletionQueue()));
+    }
   }
 
   // in order to bypass built-it limitation of gRPC message size
@@ -79,10 +108,28 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   server_instance_ = builder.BuildAndStart();
   server_instance_cv_.notify_one();
 
+  // the queues have to be drained even if the server has failed to start
+  for (auto &queue : completion_queues_) {
+    completion_queue_threads_pool_.emplace_back([queue] { queue->run(); });
+  }
+
   if (selected_port == 0) {
     return iroha::expected::makeError(
         (boost::format(kPortBindError) % server_address_).str());
   }
+  for (size_t i = 0; i < additional_addresses_.size(); ++i) {
+    if (additional_ports[i] == 0) {
+      return iroha::expected::makeError(
+          (boost::format(kPortBindError) % additional_addresses_[i].first)
+              .str());
+    }
+  }
+
+  for (auto &queue : completion_queues_) {
+    for (auto &service : async_services) {
+      service->requestCalls(queue);
+    }
+  }
 
   return iroha::expected::makeValue(selected_port);
 }
@@ -100,6 +147,7 @@ void ServerRunner::shutdown() {
   } else {
     log_->warn("Tried to shutdown without a server instance");
   }
+  stopCompletionQueues();
 }
 
 void ServerRunner::shutdown(
@@ -109,4 +157,16 @@ void ServerRunner::shutdown(
   } else {
     log_->warn("Tried to shutdown without a server instance");
   }
+  stopCompletionQueues();
+}
+
+void ServerRunner::stopCompletionQueues() {
+  for (auto &queue : completion_queues_) {
+    queue->shutdown();
+  }
+  for (auto &thread : completion_queue_threads_pool_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
 }
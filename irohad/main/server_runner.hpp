@@ -7,6 +7,7 @@
 #define MAIN_SERVER_RUNNER_HPP
 
 #include <condition_variable>
+#include <thread>
 
 #include <grpc++/grpc++.h>
 #include <grpc++/impl/codegen/service_type.h>
@@ -16,38 +17,60 @@
 namespace iroha {
   namespace network {
     struct TlsCredentials;
+    class AsyncCallQueue;
 
     /**
      * Class runs Torii server for handling queries and commands.
      */
     class ServerRunner {
      public:
+      static constexpr size_t kDefaultCompletionQueueThreads = 2;
+
       /**
        * Constructor. Initialize a new instance of ServerRunner class.
        * @param address - the address the server will be bind to in URI form
        * @param log to print progress to
        * @param reuse - allow multiple sockets to bind to the same port
        * @param my_tls_creds - TLS credentials_ for this server, if required
+       * @param completion_queue_threads - number of threads, which serve the
+       * asynchronous calls of the appended services
        */
       explicit ServerRunner(
           const std::string &address,
           logger::LoggerPtr log,
           bool reuse = true,
           const boost::optional<std::shared_ptr<const TlsCredentials>>
-              &my_tls_creds = boost::none);
+              &my_tls_creds = boost::none,
+          size_t completion_queue_threads = kDefaultCompletionQueueThreads);
 
       ~ServerRunner();
 
       /**
-       * Adds a new grpc service to be run.
+       * Adds a new grpc service to be run. If the service is an
+       * AsyncGrpcService, its asynchronous calls are served by the completion
+       * queue threads of the runner.
        * @param service - service to append.
        * @return reference to this with service appended
        */
       ServerRunner &append(std::shared_ptr<grpc::Service> service);
 
+      /**
+       * Serve the appended services on one more address. An asynchronous
+       * service can be registered with a single server only, so this is the
+       * way to serve it both with and without TLS.
+       * @param address - the address the server will be bind to in URI form
+       * @param tls_creds - TLS credentials for this address, if required
+       * @return reference to this with the address added
+       */
+      ServerRunner &addListeningAddress(
+          const std::string &address,
+          const boost::optional<std::shared_ptr<const TlsCredentials>>
+              &tls_creds);
+
       /**
        * Initialize the server and run main loop.
-       * @return Result with used port number or error message
+       * @return Result with used port number of the main address or error
+       * message, which is also returned if any other address is not bound
        */
       iroha::expected::Result<int, std::string> run();
 
@@ -67,6 +90,12 @@ namespace iroha {
       void shutdown(const std::chrono::system_clock::time_point &deadline);
 
      private:
+      /**
+       * Stop the completion queues and wait for their threads. Must be
+       * called after the server shutdown
+       */
+      void stopCompletionQueues();
+
       logger::LoggerPtr log_;
 
       std::unique_ptr<grpc::Server> server_instance_;
@@ -76,7 +105,14 @@ namespace iroha {
       std::string server_address_;
       std::shared_ptr<grpc::ServerCredentials> credentials_;
       bool reuse_;
+      /// the other addresses with their credentials
+      std::vector<
+          std::pair<std::string, std::shared_ptr<grpc::ServerCredentials>>>
+          additional_addresses_;
       std::vector<std::shared_ptr<grpc::Service>> services_;
+      size_t completion_queue_threads_;
+      std::vector<std::shared_ptr<AsyncCallQueue>> completion_queues_;
+      std::vector<std::thread> completion_queue_threads_pool_;
     };
 
   }  // namespace network
@@ -6,12 +6,64 @@
 #ifndef IROHA_STARTUP_PARAMS_HPP
 #define IROHA_STARTUP_PARAMS_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <memory>
+
+#include <boost/optional.hpp>
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
 namespace iroha {
   /// Policy regarging possible existing WSV data at startup
   enum class StartupWsvDataPolicy {
     kReuse,  //!< try to reuse existing data in the
     kDrop,   //!< drop any existing state data
   };
+
+  /// Role of the peer in the network
+  enum class PeerMode {
+    kValidator,     //!< take part in consensus and serve all the services
+    kQueryReplica,  //!< follow the ledger of the validators and serve queries
+  };
+
+  /// Sizes of the in-memory transaction status caches, the default sizes of
+  /// the caches are used if not set
+  struct TxCacheOptions {
+    /// statuses of the recent transactions served by the command service
+    boost::optional<size_t> status_cache_size;
+    /// statuses of the processed transactions used for replay checks
+    boost::optional<size_t> presence_cache_size;
+    /// period of logging the hits and misses of the caches, if set
+    boost::optional<std::chrono::milliseconds> stats_period;
+  };
+
+  /// Loading and serving of the WSV snapshots, which let a new peer start
+  /// without executing the whole chain
+  struct WsvSnapshotOptions {
+    /// address of the snapshot server of the peer to load the WSV snapshot
+    /// from when the block storage is empty
+    boost::optional<std::string> peer;
+    /// path of the PEM root certificate to verify the snapshot server with
+    boost::optional<std::string> root_certificate_path;
+    /// local genesis block, which the loaded blocks are verified from
+    std::shared_ptr<const shared_model::interface::Block> genesis_block;
+    /// deadline of each call to the snapshot server
+    std::chrono::milliseconds timeout{std::chrono::hours(1)};
+    /// port of the TLS server, which serves the WSV snapshots to the new
+    /// peers. The snapshots are not served if not set
+    boost::optional<uint16_t> export_port;
+    /// path of the TLS key pair of the snapshot server, without the .crt and
+    /// .key extensions
+    boost::optional<std::string> key_pair_path;
+  };
 }  // namespace iroha
 
 #endif
@@ -156,6 +156,11 @@ namespace iroha {
     expiredBatchesNotify(storage_->extractExpiredTransactions(current_time));
   }
 
+  DataType FairMstProcessor::findBatch(
+      const shared_model::interface::types::HashType &hash) const {
+    return storage_->findBatch(hash);
+  }
+
   // -----------------------------| private api |-----------------------------
 
   // TODO [IR-1687] Akvinikym 10.09.18: three methods below should be one
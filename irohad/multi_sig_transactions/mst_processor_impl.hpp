@@ -59,6 +59,9 @@ namespace iroha {
     void onNewState(shared_model::interface::types::PublicKeyHexStringView from,
                     MstState &&new_state) override;
 
+    DataType findBatch(const shared_model::interface::types::HashType &hash)
+        const override;
+
     // ----------------------------| end override |-----------------------------
 
    private:
@@ -220,6 +220,18 @@ namespace iroha {
     return result;
   }
 
+  DataType MstState::findBatch(
+      const shared_model::interface::types::HashType &hash) const {
+    auto it = batches_to_hash_.left.find(hash);
+    // the hashes of the other transactions of a batch erased by transaction
+    // hash may be left in the index
+    if (it == batches_to_hash_.left.end()
+        or batches_.right.find(it->second) == batches_.right.end()) {
+      return nullptr;
+    }
+    return it->second;
+  }
+
   void MstState::extractExpiredImpl(const TimeType &current_time,
                                     boost::optional<MstState &> extracted) {
     for (auto it = batches_.left.begin(); it != batches_.left.end()
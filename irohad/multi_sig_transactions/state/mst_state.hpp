@@ -149,6 +149,14 @@ namespace iroha {
      */
     bool contains(const DataType &element) const;
 
+    /**
+     * Find the batch by transaction hash
+     * @param hash - hash of any transaction of the batch
+     * @return the batch, nullptr if the state does not contain it
+     */
+    DataType findBatch(
+        const shared_model::interface::types::HashType &hash) const;
+
     /// Apply visitor to all batches.
     template <typename Visitor>
     inline void iterateBatches(const Visitor &visitor) const {
@@ -43,4 +43,10 @@ namespace iroha {
   bool MstStorage::batchInStorage(const DataType &batch) const {
     return batchInStorageImpl(batch);
   }
+
+  DataType MstStorage::findBatch(
+      const shared_model::interface::types::HashType &hash) const {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    return findBatchImpl(hash);
+  }
 }  // namespace iroha
@@ -102,4 +102,9 @@ namespace iroha {
     return own_state_.contains(batch);
   }
 
+  DataType MstStorageStateImpl::findBatchImpl(
+      const shared_model::interface::types::HashType &hash) const {
+    return own_state_.findBatch(hash);
+  }
+
 }  // namespace iroha
@@ -75,6 +75,15 @@ namespace iroha {
      */
     bool batchInStorage(const DataType &batch) const;
 
+    /**
+     * Find the batch in own state
+     * @param hash - hash of any transaction of the batch
+     * @return the batch, nullptr if own state does not contain it
+     * General note: implementation of method covered by lock
+     */
+    DataType findBatch(
+        const shared_model::interface::types::HashType &hash) const;
+
     virtual ~MstStorage() = default;
 
    protected:
@@ -107,6 +116,9 @@ namespace iroha {
 
     virtual bool batchInStorageImpl(const DataType &batch) const = 0;
 
+    virtual DataType findBatchImpl(
+        const shared_model::interface::types::HashType &hash) const = 0;
+
     // -------------------------------| fields |--------------------------------
 
     mutable std::mutex mutex_;
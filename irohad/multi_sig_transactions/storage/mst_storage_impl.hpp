@@ -68,6 +68,9 @@ namespace iroha {
 
     bool batchInStorageImpl(const DataType &batch) const override;
 
+    DataType findBatchImpl(const shared_model::interface::types::HashType
+                               &hash) const override;
+
    private:
     // ---------------------------| private fields |----------------------------
 
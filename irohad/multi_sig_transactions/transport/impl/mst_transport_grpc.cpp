@@ -7,6 +7,11 @@
 
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 
+#include <chrono>
+#include <map>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <rxcpp/rx-lite.hpp>
@@ -29,18 +34,192 @@ using namespace iroha::network;
 using shared_model::interface::types::PublicKeyHexStringView;
 
 namespace {
+  /// Time to wait for the peer to tell which parts of the state it misses
+  const std::chrono::seconds kGetMissingTimeout{1};
+
   auto default_sender_factory = [](const shared_model::interface::Peer &to) {
     return createClient<transport::MstTransportGrpc>(to.address());
   };
-}
-void sendStateAsyncImpl(
-    const shared_model::interface::Peer &to,
-    MstState const &state,
-    PublicKeyHexStringView sender_key,
-    AsyncGrpcClient<google::protobuf::Empty> &async_call,
-    std::function<void(grpc::Status &, google::protobuf::Empty &)> on_response =
-        {},
-    MstTransportGrpc::SenderFactory sender_factory = default_sender_factory);
+
+  const iroha::protocol::Transaction &getTransport(
+      const shared_model::interface::Transaction &tx) {
+    // TODO (@l4l) 04/03/18 simplify with IR-1040
+    return static_cast<const shared_model::proto::Transaction &>(tx)
+        .getTransport();
+  }
+
+  bool hasSignature(const shared_model::interface::Transaction &tx,
+                    const std::string &public_key) {
+    const auto signatures = tx.signatures();
+    return std::any_of(
+        signatures.begin(), signatures.end(), [&](const auto &signature) {
+          return boost::iequals(signature.publicKey(), public_key);
+        });
+  }
+
+  transport::MstState makeProtoState(MstState const &state,
+                                     PublicKeyHexStringView sender_key) {
+    transport::MstState proto_state;
+    std::string_view sender_key_sv = sender_key;
+    proto_state.set_source_peer_key(sender_key_sv.data(),
+                                    sender_key_sv.size());
+    state.iterateTransactions([&proto_state](auto const &tx) {
+      *proto_state.add_transactions() = getTransport(*tx);
+    });
+    return proto_state;
+  }
+
+  /**
+   * Make the state of the batches and signatures, which the peer misses
+   * @param batches - batches in the order of the digest sent to the peer
+   * @param missing - response of the peer to the digest
+   */
+  transport::MstState makeMissingState(const std::vector<DataType> &batches,
+                                       const transport::MstMissing &missing,
+                                       PublicKeyHexStringView sender_key) {
+    transport::MstState proto_state;
+    std::string_view sender_key_sv = sender_key;
+    proto_state.set_source_peer_key(sender_key_sv.data(),
+                                    sender_key_sv.size());
+    for (auto index : missing.batches()) {
+      if (index < batches.size()) {
+        for (const auto &tx : batches[index]->transactions()) {
+          *proto_state.add_transactions() = getTransport(*tx);
+        }
+      }
+    }
+
+    std::map<size_t, transport::MstBatchSignatures *> batch_signatures;
+    for (const auto &signatures : missing.signatures()) {
+      if (signatures.batch() >= batches.size()) {
+        continue;
+      }
+      const auto &batch_txs = batches[signatures.batch()]->transactions();
+      if (signatures.transaction() >= batch_txs.size()) {
+        continue;
+      }
+      auto &batch_update = batch_signatures[signatures.batch()];
+      if (not batch_update) {
+        batch_update = proto_state.add_batch_signatures();
+        batch_update->set_hash(
+            shared_model::crypto::toBinaryString(batch_txs.front()->hash()));
+      }
+      auto *tx_update = batch_update->add_transactions();
+      tx_update->set_index(signatures.transaction());
+      const auto &tx_signatures =
+          getTransport(*batch_txs[signatures.transaction()]).signatures();
+      for (auto index : signatures.signatures()) {
+        if (index < static_cast<size_t>(tx_signatures.size())) {
+          *tx_update->add_signatures() = tx_signatures[index];
+        }
+      }
+    }
+    return proto_state;
+  }
+
+  /**
+   * Make the digest of the state, which the peer answers with the batches and
+   * signatures it misses
+   * @param batches - collection to put the batches in the order of the digest
+   */
+  transport::MstStateDigest makeStateDigest(MstState const &state,
+                                            PublicKeyHexStringView sender_key,
+                                            std::vector<DataType> &batches) {
+    transport::MstStateDigest digest;
+    std::string_view sender_key_sv = sender_key;
+    digest.set_source_peer_key(sender_key_sv.data(), sender_key_sv.size());
+    state.iterateBatches([&](const auto &batch) {
+      batches.push_back(batch);
+      auto *batch_digest = digest.add_batches();
+      batch_digest->set_hash(shared_model::crypto::toBinaryString(
+          batch->transactions().front()->hash()));
+      for (const auto &tx : batch->transactions()) {
+        auto *signers = batch_digest->add_transactions();
+        for (const auto &signature : getTransport(*tx).signatures()) {
+          signers->add_public_keys(signature.public_key());
+        }
+      }
+    });
+    return digest;
+  }
+
+  /**
+   * Make the state to send from the answer of the peer to the digest
+   * @param batches - batches in the order of the digest sent to the peer
+   * @return the state with the missing data only, boost::none if the peer
+   * could not be asked
+   */
+  boost::optional<transport::MstState> makeStateToSend(
+      const grpc::Status &status,
+      const transport::MstMissing &missing,
+      MstState const &state,
+      const std::vector<DataType> &batches,
+      PublicKeyHexStringView sender_key,
+      logger::Logger &log) {
+    if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+      // the peer does not support digests, so the state is sent in full
+      return makeProtoState(state, sender_key);
+    }
+    if (not status.ok()) {
+      log.warn("Failed to get missing state: {}", status.error_message());
+      return boost::none;
+    }
+    return makeMissingState(batches, missing, sender_key);
+  }
+
+  void sendProtoStateAsync(
+      std::shared_ptr<transport::MstTransportGrpc::StubInterface> client,
+      transport::MstState proto_state,
+      AsyncGrpcClient<google::protobuf::Empty> &async_call,
+      std::function<void(grpc::Status &, google::protobuf::Empty &)>
+          on_response) {
+    async_call.Call(
+        [client = std::move(client), proto_state = std::move(proto_state)](
+            auto context, auto cq) {
+          return client->AsyncSendState(context, proto_state, cq);
+        },
+        std::move(on_response));
+  }
+
+  /**
+   * Restore the batches from own state, to which the sender added signatures
+   * @param batch_signatures - the signatures added by the sender
+   * @param subscriber - holder of own state
+   * @param transactions - collection to append the signed transactions to
+   */
+  void addSignedBatches(
+      const google::protobuf::RepeatedPtrField<transport::MstBatchSignatures>
+          &batch_signatures,
+      const MstTransportNotification &subscriber,
+      google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+          &transactions) {
+    for (const auto &batch_update : batch_signatures) {
+      // the batch may be completed or expired since the digest was answered
+      auto batch =
+          subscriber.findBatch(shared_model::crypto::Hash{batch_update.hash()});
+      if (not batch) {
+        continue;
+      }
+      const auto &batch_txs = batch->transactions();
+      const auto first = transactions.size();
+      for (const auto &tx : batch_txs) {
+        *transactions.Add() = getTransport(*tx);
+      }
+      for (const auto &tx_update : batch_update.transactions()) {
+        if (tx_update.index() >= batch_txs.size()) {
+          continue;
+        }
+        auto *tx = transactions.Mutable(first + tx_update.index());
+        for (const auto &signature : tx_update.signatures()) {
+          if (not hasSignature(*batch_txs[tx_update.index()],
+                               signature.public_key())) {
+            *tx->add_signatures() = signature;
+          }
+        }
+      }
+    }
+  }
+}  // namespace
 
 MstTransportGrpc::MstTransportGrpc(
     std::shared_ptr<AsyncGrpcClient<google::protobuf::Empty>> async_call,
@@ -72,8 +251,20 @@ grpc::Status MstTransportGrpc::SendState(
     ::google::protobuf::Empty *response) {
   log_->info("MstState Received");
 
+  const auto *proto_transactions = &request->transactions();
+  google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+      signed_transactions;
+  if (request->batch_signatures_size() > 0) {
+    if (auto subscriber = subscriber_.lock()) {
+      signed_transactions = request->transactions();
+      addSignedBatches(
+          request->batch_signatures(), *subscriber, signed_transactions);
+      proto_transactions = &signed_transactions;
+    }
+  }
+
   auto transactions = shared_model::proto::deserializeTransactions(
-      *transaction_factory_, request->transactions());
+      *transaction_factory_, *proto_transactions);
   if (auto e = expected::resultToOptionalError(transactions)) {
     log_->warn(
         "Transaction deserialization failed: hash {}, {}", e->hash, e->error);
@@ -132,6 +323,50 @@ grpc::Status MstTransportGrpc::SendState(
   return grpc::Status::OK;
 }
 
+grpc::Status MstTransportGrpc::GetMissing(
+    ::grpc::ServerContext *context,
+    const ::iroha::network::transport::MstStateDigest *request,
+    ::iroha::network::transport::MstMissing *response) {
+  auto subscriber = subscriber_.lock();
+  for (int i = 0; i < request->batches_size(); ++i) {
+    const auto &batch_digest = request->batches(i);
+    DataType batch;
+    if (subscriber) {
+      batch = subscriber->findBatch(
+          shared_model::crypto::Hash{batch_digest.hash()});
+    }
+    if (not batch) {
+      response->add_batches(i);
+      continue;
+    }
+
+    const auto &batch_txs = batch->transactions();
+    const auto txs_count =
+        std::min<size_t>(batch_txs.size(), batch_digest.transactions_size());
+    for (size_t j = 0; j < txs_count; ++j) {
+      const auto &public_keys = batch_digest.transactions(j).public_keys();
+      transport::MstMissingSignatures *missing = nullptr;
+      for (int k = 0; k < public_keys.size(); ++k) {
+        if (hasSignature(*batch_txs[j], public_keys[k])) {
+          continue;
+        }
+        if (not missing) {
+          missing = response->add_signatures();
+          missing->set_batch(i);
+          missing->set_transaction(j);
+        }
+        missing->add_signatures(k);
+      }
+    }
+  }
+
+  log_->info("Missing {} of {} batches, signatures of {} transactions",
+             response->batches_size(),
+             request->batches_size(),
+             response->signatures_size());
+  return grpc::Status::OK;
+}
+
 void MstTransportGrpc::subscribe(
     std::shared_ptr<MstTransportNotification> notification) {
   subscriber_ = notification;
@@ -155,15 +390,61 @@ rxcpp::observable<bool> MstTransportGrpc::sendState(
 
         if (log and async_call) {
           log->info("Propagate MstState to peer {}", to->address());
-          sendStateAsyncImpl(*to,
-                             providing_state,
-                             PublicKeyHexStringView{my_key},
-                             *async_call,
-                             [s](auto &status, auto &) {
-                               s.on_next(status.ok());
-                               s.on_completed();
-                             },
-                             sender_factory);
+          std::shared_ptr<transport::MstTransportGrpc::StubInterface> client =
+              sender_factory(*to);
+          std::vector<DataType> batches;
+          auto digest = makeStateDigest(
+              providing_state, PublicKeyHexStringView{my_key}, batches);
+          // the state is sent from the response handler, so that a peer which
+          // does not answer does not hold the propagation to the other peers
+          async_call->Call<transport::MstMissing>(
+              [client, digest = std::move(digest)](auto context, auto cq) {
+                context->set_deadline(std::chrono::system_clock::now()
+                                      + kGetMissingTimeout);
+                return client->AsyncGetMissing(context, digest, cq);
+              },
+              [s,
+               log_,
+               to,
+               client,
+               providing_state,
+               batches = std::move(batches),
+               my_key,
+               async_call_](auto &status, auto &missing) {
+                auto log = log_.lock();
+                auto async_call = async_call_.lock();
+                if (not log or not async_call) {
+                  s.on_next(false);
+                  s.on_completed();
+                  return;
+                }
+                auto proto_state =
+                    makeStateToSend(status,
+                                    missing,
+                                    providing_state,
+                                    batches,
+                                    PublicKeyHexStringView{my_key},
+                                    *log);
+                if (not proto_state) {
+                  s.on_next(false);
+                  s.on_completed();
+                  return;
+                }
+                if (proto_state->transactions_size() == 0
+                    and proto_state->batch_signatures_size() == 0) {
+                  log->info("Peer {} has the whole MstState", to->address());
+                  s.on_next(true);
+                  s.on_completed();
+                  return;
+                }
+                sendProtoStateAsync(std::move(client),
+                                    std::move(*proto_state),
+                                    *async_call,
+                                    [s](auto &status, auto &) {
+                                      s.on_next(status.ok());
+                                      s.on_completed();
+                                    });
+              });
         }
       });
 }
@@ -175,29 +456,8 @@ void iroha::network::sendStateAsync(
     AsyncGrpcClient<google::protobuf::Empty> &async_call,
     std::function<void(grpc::Status &, google::protobuf::Empty &)>
         on_response) {
-  sendStateAsyncImpl(to, state, sender_key, async_call, std::move(on_response));
-}
-
-void sendStateAsyncImpl(
-    shared_model::interface::Peer const &to,
-    MstState const &state,
-    PublicKeyHexStringView sender_key,
-    AsyncGrpcClient<google::protobuf::Empty> &async_call,
-    std::function<void(grpc::Status &, google::protobuf::Empty &)> on_response,
-    MstTransportGrpc::SenderFactory sender_factory) {
-  transport::MstState proto_state;
-  std::string_view sender_key_sv = sender_key;
-  proto_state.set_source_peer_key(sender_key_sv.data(), sender_key_sv.size());
-  state.iterateTransactions([&proto_state](auto const &tx) {
-    // TODO (@l4l) 04/03/18 simplify with IR-1040
-    *proto_state.add_transactions() =
-        std::static_pointer_cast<shared_model::proto::Transaction>(tx)
-            ->getTransport();
-  });
-  async_call.Call(
-      [client = sender_factory(to), proto_state = std::move(proto_state)](
-          auto context, auto cq) {
-        return client->AsyncSendState(context, proto_state, cq);
-      },
-      std::move(on_response));
+  sendProtoStateAsync(default_sender_factory(to),
+                      makeProtoState(state, sender_key),
+                      async_call,
+                      std::move(on_response));
 }
@@ -63,6 +63,18 @@ namespace iroha {
           const ::iroha::network::transport::MstState *request,
           ::google::protobuf::Empty *response) override;
 
+      /**
+       * Server part of grpc GetMissing method call
+       * @param context - server context with information about call
+       * @param request - digest of the state the client is going to send
+       * @param response - batches and signatures missing in own state
+       * @return grpc::Status (always OK)
+       */
+      grpc::Status GetMissing(
+          ::grpc::ServerContext *context,
+          const ::iroha::network::transport::MstStateDigest *request,
+          ::iroha::network::transport::MstMissing *response) override;
+
       void subscribe(
           std::shared_ptr<MstTransportNotification> notification) override;
 
@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_GRPC_SERVICE_HPP
+#define IROHA_ASYNC_GRPC_SERVICE_HPP
+
+#include <memory>
+#include <shared_mutex>
+
+#include <grpc++/grpc++.h>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Tag of an operation put to a completion queue, which is notified by the
+     * queue thread when the operation is completed
+     */
+    class AsyncCallTag {
+     public:
+      virtual ~AsyncCallTag() = default;
+
+      /**
+       * @param ok - whether the operation has succeeded
+       */
+      virtual void proceed(bool ok) = 0;
+    };
+
+    /**
+     * Server completion queue, which does not accept new operations after it
+     * is shut down, so that calls which are driven by other threads than the
+     * queue ones do not have to track the server state
+     */
+    class AsyncCallQueue {
+     public:
+      explicit AsyncCallQueue(std::unique_ptr<grpc::ServerCompletionQueue> cq)
+          : cq_(std::move(cq)) {}
+
+      /**
+       * Put a new operation to the queue, unless the queue is shut down
+       * @param start_operation - function which starts the operation with the
+       * given queue
+       * @return true if the operation was started
+       */
+      template <typename F>
+      bool startOperation(F &&start_operation) {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (is_shut_down_) {
+          return false;
+        }
+        std::forward<F>(start_operation)(cq_.get());
+        return true;
+      }
+
+      /**
+       * Process completed operations until the queue is shut down and drained
+       */
+      void run() {
+        void *tag;
+        bool ok;
+        while (cq_->Next(&tag, &ok)) {
+          static_cast<AsyncCallTag *>(tag)->proceed(ok);
+        }
+      }
+
+      /**
+       * Stop accepting new operations. Must be called after the server
+       * shutdown
+       */
+      void shutdown() {
+        std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+        if (not is_shut_down_) {
+          is_shut_down_ = true;
+          cq_->Shutdown();
+        }
+      }
+
+     private:
+      std::unique_ptr<grpc::ServerCompletionQueue> cq_;
+      std::shared_timed_mutex mutex_;
+      bool is_shut_down_ = false;
+    };
+
+    /**
+     * Service which handles some of its methods asynchronously. Such calls do
+     * not occupy a server thread, and are driven by the threads of the
+     * completion queues of the server
+     */
+    class AsyncGrpcService {
+     public:
+      virtual ~AsyncGrpcService() = default;
+
+      /**
+       * Start waiting for the asynchronous calls on the given queue. Called
+       * once per queue after the server is started
+       * @param queue - completion queue, which delivers the calls
+       */
+      virtual void requestCalls(std::shared_ptr<AsyncCallQueue> queue) = 0;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_GRPC_SERVICE_HPP
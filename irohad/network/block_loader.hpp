@@ -30,6 +30,21 @@ namespace iroha {
                      shared_model::interface::types::PublicKeyHexStringView
                          peer_pubkey) = 0;
 
+      /**
+       * Retrieve the blocks up to the given height from given peer
+       * @param height - top block height in requester's peer storage
+       * @param last_height - height of the last requested block
+       * @param peer_pubkey - peer for requesting blocks
+       * @return the blocks from height + 1, which may end before the last
+       * requested one if the peer does not have it
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlockRange(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType last_height,
+          shared_model::interface::types::PublicKeyHexStringView
+              peer_pubkey) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
@@ -19,7 +19,8 @@ namespace iroha {
 
     /**
      * Asynchronous gRPC client which does no processing of server responses
-     * @tparam Response type of server response
+     * @tparam Response type of server response, other response types may be
+     * requested with Call as well
      */
     template <typename Response>
     class AsyncGrpcClient {
@@ -35,13 +36,11 @@ namespace iroha {
         void *got_tag;
         auto ok = false;
         while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
+          auto call = static_cast<AsyncClientCallBase *>(got_tag);
           if (not call->status.ok()) {
             log_->warn("RPC failed: {}", call->status.error_message());
           }
-          if (call->on_response) {
-            call->on_response(call->status, call->reply);
-          }
+          call->onResponse();
           delete call;
         }
       }
@@ -57,34 +56,56 @@ namespace iroha {
       std::thread thread_;
 
       /**
-       * State and data information of gRPC call
+       * State and data information of gRPC call, which does not depend on the
+       * response type
        */
-      struct AsyncClientCall {
-        Response reply;
+      struct AsyncClientCallBase {
+        virtual ~AsyncClientCallBase() = default;
+
+        /// Pass the result of the call to its handler
+        virtual void onResponse() = 0;
 
         grpc::ClientContext context;
 
         grpc::Status status;
+      };
+
+      /**
+       * State and data information of gRPC call
+       * @tparam Reply type of server response of the call
+       */
+      template <typename Reply>
+      struct AsyncClientCall : public AsyncClientCallBase {
+        void onResponse() override {
+          if (on_response) {
+            on_response(this->status, reply);
+          }
+        }
+
+        Reply reply;
 
-        std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Response>>
+        std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Reply>>
             response_reader;
 
-        std::function<void(grpc::Status &, Response &)> on_response;
+        std::function<void(grpc::Status &, Reply &)> on_response;
       };
 
       /**
        * Universal method to perform all needed sends
+       * @tparam Reply type of server response of the call
        * @tparam lambda which must return unique pointer to
-       * ClientAsyncResponseReader<Response> object
+       * ClientAsyncResponseReader<Reply> object
        */
-      template <typename F>
-      void Call(
-          F &&lambda,
-          std::function<void(grpc::Status &, Response &)> on_response = {}) {
-        auto call = new AsyncClientCall;
+      template <typename Reply = Response, typename F>
+      void Call(F &&lambda,
+                std::function<void(grpc::Status &, Reply &)> on_response = {}) {
+        auto call = new AsyncClientCall<Reply>;
         call->on_response = std::move(on_response);
         call->response_reader = lambda(&call->context, &cq_);
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        call->response_reader->Finish(
+            &call->reply,
+            &call->status,
+            static_cast<AsyncClientCallBase *>(call));
       }
 
      private:
@@ -0,0 +1,274 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_SERVER_STREAM_HPP
+#define IROHA_ASYNC_SERVER_STREAM_HPP
+
+#include "network/server_stream.hpp"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include <boost/optional.hpp>
+#include "network/async_grpc_service.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Server streaming call served with the asynchronous gRPC API. The call
+     * keeps itself alive until gRPC is done with it, responses may be written
+     * from any thread, and only one write is in flight at a time, as required
+     * by gRPC
+     * @tparam Request - type of call request
+     * @tparam Response - type of streamed messages
+     */
+    template <typename Request, typename Response>
+    class AsyncServerStream
+        : public ServerStream<Response>,
+          public std::enable_shared_from_this<
+              AsyncServerStream<Request, Response>> {
+     public:
+      /// Function which requests the call from the generated async service
+      using RequestCallType =
+          std::function<void(grpc::ServerContext *,
+                             Request *,
+                             grpc::ServerAsyncWriter<Response> *,
+                             grpc::ServerCompletionQueue *,
+                             void *)>;
+      /// Function which serves the arrived call
+      using HandlerType = std::function<void(
+          const Request &, std::shared_ptr<ServerStream<Response>>)>;
+
+      /**
+       * Wait for the call on the queue. When the call arrives, the next one
+       * is requested in the same way, and the handler is called
+       * @param queue - completion queue to serve calls with
+       * @param request_call - requests the call from the service
+       * @param handler - serves the arrived call
+       * @param max_queued_responses - maximum number of responses waiting to
+       * be sent. A write beyond it closes the stream with RESOURCE_EXHAUSTED
+       * status and drops the waiting responses
+       */
+      static void request(
+          std::shared_ptr<AsyncCallQueue> queue,
+          RequestCallType request_call,
+          HandlerType handler,
+          size_t max_queued_responses = kDefaultMaxQueuedResponses) {
+        std::shared_ptr<AsyncServerStream> stream(
+            new AsyncServerStream(std::move(queue),
+                                  std::move(request_call),
+                                  std::move(handler),
+                                  max_queued_responses));
+        stream->start();
+      }
+
+      bool write(Response response) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+          return false;
+        }
+        if (responses_.size() > max_queued_responses_) {
+          // the client is too slow, keep only the response being sent
+          closed_ = true;
+          responses_.erase(responses_.begin() + 1, responses_.end());
+          finish_status_ = grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                        "Too many responses are not sent");
+          return false;
+        }
+        responses_.push_back(std::move(response));
+        if (not write_in_flight_) {
+          startWrite();
+        }
+        return true;
+      }
+
+      void finish(grpc::Status status) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+          return;
+        }
+        closed_ = true;
+        finish_status_ = std::move(status);
+        if (not write_in_flight_) {
+          startFinish();
+        }
+      }
+
+      void setOnDone(std::function<void()> on_done) override {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (not done_) {
+            on_done_ = std::move(on_done);
+            return;
+          }
+        }
+        on_done();
+      }
+
+      std::string peer() const override {
+        return context_.peer();
+      }
+
+     private:
+      /**
+       * Completion queue tag, which passes the result of the operation to
+       * the stream method
+       */
+      class Tag : public AsyncCallTag {
+       public:
+        using MethodType = void (AsyncServerStream::*)(bool);
+
+        Tag(AsyncServerStream *stream, MethodType method)
+            : stream_(stream), method_(method) {}
+
+        void proceed(bool ok) override {
+          (stream_->*method_)(ok);
+        }
+
+       private:
+        AsyncServerStream *stream_;
+        MethodType method_;
+      };
+
+      AsyncServerStream(std::shared_ptr<AsyncCallQueue> queue,
+                        RequestCallType request_call,
+                        HandlerType handler,
+                        size_t max_queued_responses)
+          : queue_(std::move(queue)),
+            request_call_(std::move(request_call)),
+            handler_(std::move(handler)),
+            max_queued_responses_(max_queued_responses),
+            writer_(&context_) {}
+
+      void start() {
+        self_ = this->shared_from_this();
+        context_.AsyncNotifyWhenDone(&done_tag_);
+        if (not queue_->startOperation([this](auto *cq) {
+              request_call_(&context_, &request_, &writer_, cq, &request_tag_);
+            })) {
+          self_.reset();
+        }
+      }
+
+      void onRequest(bool ok) {
+        if (not ok) {
+          // the server is shut down, the call has not started, so the done
+          // tag is not delivered
+          std::unique_lock<std::mutex> lock(mutex_);
+          release(lock);
+          return;
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          done_pending_ = true;
+        }
+        request(queue_, request_call_, handler_, max_queued_responses_);
+        handler_(request_, this->shared_from_this());
+      }
+
+      /// must be called under the lock, when no write is in flight
+      void startWrite() {
+        write_in_flight_ = queue_->startOperation([this](auto *) {
+          writer_.Write(responses_.front(), &write_tag_);
+        });
+        if (not write_in_flight_) {
+          closed_ = true;
+          responses_.clear();
+        }
+      }
+
+      void onWrite(bool ok) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        write_in_flight_ = false;
+        responses_.pop_front();
+        if (not ok) {
+          // the call is broken, the done tag follows
+          closed_ = true;
+          responses_.clear();
+        } else if (not responses_.empty()) {
+          startWrite();
+        } else if (finish_status_) {
+          startFinish();
+        }
+        release(lock);
+      }
+
+      /// must be called under the lock, when no write is in flight
+      void startFinish() {
+        finish_in_flight_ = queue_->startOperation([this](auto *) {
+          writer_.Finish(*finish_status_, &finish_tag_);
+        });
+      }
+
+      void onFinish(bool) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        finish_in_flight_ = false;
+        release(lock);
+      }
+
+      void onDone(bool) {
+        std::function<void()> on_done;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          done_ = true;
+          done_pending_ = false;
+          closed_ = true;
+          on_done = std::move(on_done_);
+        }
+        if (on_done) {
+          on_done();
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        release(lock);
+      }
+
+      /**
+       * Drop the self reference if gRPC does not use the call anymore. The
+       * stream may be destroyed by the call, so members must not be accessed
+       * afterwards
+       */
+      void release(std::unique_lock<std::mutex> &lock) {
+        if (write_in_flight_ or finish_in_flight_ or done_pending_) {
+          return;
+        }
+        auto self = std::move(self_);
+        lock.unlock();
+      }
+
+      std::shared_ptr<AsyncCallQueue> queue_;
+      RequestCallType request_call_;
+      HandlerType handler_;
+      const size_t max_queued_responses_;
+
+      grpc::ServerContext context_;
+      Request request_;
+      grpc::ServerAsyncWriter<Response> writer_;
+
+      Tag request_tag_{this, &AsyncServerStream::onRequest};
+      Tag write_tag_{this, &AsyncServerStream::onWrite};
+      Tag finish_tag_{this, &AsyncServerStream::onFinish};
+      Tag done_tag_{this, &AsyncServerStream::onDone};
+
+      std::mutex mutex_;
+      /// holds the stream while gRPC has pending operations with it
+      std::shared_ptr<AsyncServerStream> self_;
+      /// responses to send, the first one is being sent
+      std::deque<Response> responses_;
+      boost::optional<grpc::Status> finish_status_;
+      std::function<void()> on_done_;
+      /// new responses are not accepted
+      bool closed_ = false;
+      bool write_in_flight_ = false;
+      bool finish_in_flight_ = false;
+      bool done_pending_ = false;
+      bool done_ = false;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_SERVER_STREAM_HPP
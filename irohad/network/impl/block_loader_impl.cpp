@@ -16,6 +16,7 @@
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
+#include "network/impl/serialized_block.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
@@ -38,8 +39,22 @@ BlockLoaderImpl::BlockLoaderImpl(
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
     const shared_model::interface::types::HeightType height,
     types::PublicKeyHexStringView peer_pubkey) {
+  return requestBlocks(height, 0, peer_pubkey);
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlockRange(
+    const shared_model::interface::types::HeightType height,
+    const shared_model::interface::types::HeightType last_height,
+    types::PublicKeyHexStringView peer_pubkey) {
+  return requestBlocks(height, last_height, peer_pubkey);
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::requestBlocks(
+    types::HeightType height,
+    types::HeightType last_height,
+    types::PublicKeyHexStringView peer_pubkey) {
   return rxcpp::observable<>::create<std::shared_ptr<Block>>(
-      [this, height, peer_pubkey](auto subscriber) {
+      [this, height, last_height, peer_pubkey](auto subscriber) {
         auto peer = this->findPeer(peer_pubkey);
         if (not peer) {
           log_->error("{}", kPeerNotFound);
@@ -48,23 +63,30 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
         }
 
         proto::BlockRequest request;
-        grpc::ClientContext context;
-        protocol::Block block;
+        // the context is shared with the unsubscription handler, which
+        // cancels the call blocked on a peer which does not send the blocks
+        auto context = std::make_shared<grpc::ClientContext>();
+        subscriber.add([context] { context->TryCancel(); });
+        proto::SerializedBlock block;
 
         // request next block to our top
         request.set_height(height + 1);
+        request.set_last_height(last_height);
 
         auto reader =
-            this->getPeerStub(**peer).retrieveBlocks(&context, request);
+            this->getPeerStub(**peer).retrieveBlocks(context.get(), request);
         while (subscriber.is_subscribed() and reader->Read(&block)) {
-          block_factory_.createBlock(std::move(block))
+          (parseSerializedBlock(block) |
+           [this](auto &&proto_block) {
+             return block_factory_.createBlock(std::move(proto_block));
+           })
               .match(
                   [&subscriber](auto &&result) {
                     subscriber.on_next(std::move(result.value));
                   },
                   [this, &context](const auto &error) {
                     log_->error("{}", error.error);
-                    context.TryCancel();
+                    context->TryCancel();
                   });
         }
         reader->Finish();
@@ -128,6 +150,7 @@ BlockLoaderImpl::findPeer(types::PublicKeyHexStringView pubkey) {
 
 proto::Loader::StubInterface &BlockLoaderImpl::getPeerStub(
     const shared_model::interface::Peer &peer) {
+  std::lock_guard<std::mutex> lock(peer_connections_mutex_);
   auto it = peer_connections_.find(peer.address());
   if (it == peer_connections_.end()) {
     it = peer_connections_
@@ -8,6 +8,7 @@
 
 #include "network/block_loader.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 #include "ametsuchi/peer_query_factory.hpp"
@@ -31,12 +32,29 @@ namespace iroha {
                      shared_model::interface::types::PublicKeyHexStringView
                          peer_pubkey) override;
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlockRange(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType last_height,
+          shared_model::interface::types::PublicKeyHexStringView peer_pubkey)
+          override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           shared_model::interface::types::PublicKeyHexStringView peer_pubkey,
           shared_model::interface::types::HeightType block_height) override;
 
      private:
+      /**
+       * Request the blocks from height + 1 up to last_height, or up to the
+       * top block of the peer if last_height is 0
+       */
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      requestBlocks(
+          shared_model::interface::types::HeightType height,
+          shared_model::interface::types::HeightType last_height,
+          shared_model::interface::types::PublicKeyHexStringView peer_pubkey);
+
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
        * @param pubkey - public key of requested peer
@@ -56,6 +74,8 @@ namespace iroha {
       std::unordered_map<shared_model::interface::types::AddressType,
                          std::unique_ptr<proto::Loader::StubInterface>>
           peer_connections_;
+      /// the blocks may be retrieved from several threads at once
+      std::mutex peer_connections_mutex_;
       std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       shared_model::proto::ProtoBlockFactory block_factory_;
 
@@ -5,6 +5,12 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
@@ -32,44 +38,132 @@ static grpc::Status handleGetBlockError(const BlockQuery::GetBlockError &error,
   }
 }
 
+namespace {
+  /**
+   * Reads the serialized blocks of the given range from storage in its own
+   * thread, so that the next blocks are read while the previous ones are sent.
+   * Stops after the first block it has failed to read
+   */
+  class SerializedBlockReader {
+   public:
+    using HeightType = shared_model::interface::types::HeightType;
+
+    SerializedBlockReader(std::shared_ptr<BlockQuery> block_query,
+                          HeightType starting_height,
+                          HeightType ending_height,
+                          size_t capacity)
+        : block_query_(std::move(block_query)),
+          capacity_(capacity),
+          stop_(false),
+          thread_([this, starting_height, ending_height] {
+            this->run(starting_height, ending_height);
+          }) {}
+
+    ~SerializedBlockReader() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      not_full_.notify_one();
+      thread_.join();
+    }
+
+    /**
+     * Wait for the next block of the range
+     * @return the block or the error of reading it
+     */
+    BlockQuery::SerializedBlockResult next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_.wait(lock, [this] { return not blocks_.empty(); });
+      auto block = std::move(blocks_.front());
+      blocks_.pop_front();
+      lock.unlock();
+      not_full_.notify_one();
+      return block;
+    }
+
+   private:
+    void run(HeightType starting_height, HeightType ending_height) {
+      for (auto i = starting_height; i <= ending_height; ++i) {
+        auto block = block_query_->getSerializedBlock(i);
+        const bool failed = expected::hasError(block);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock,
+                       [this] { return stop_ or blocks_.size() < capacity_; });
+        if (stop_) {
+          return;
+        }
+        blocks_.push_back(std::move(block));
+        lock.unlock();
+        not_empty_.notify_one();
+        if (failed) {
+          return;
+        }
+      }
+    }
+
+    std::shared_ptr<BlockQuery> block_query_;
+    const size_t capacity_;
+
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<BlockQuery::SerializedBlockResult> blocks_;
+    bool stop_;
+
+    std::thread thread_;
+  };
+}  // namespace
+
 BlockLoaderService::BlockLoaderService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<iroha::consensus::ConsensusResultCache>
         consensus_result_cache,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<WsvSnapshotExporter> snapshot_exporter)
     : block_query_factory_(std::move(block_query_factory)),
       consensus_result_cache_(std::move(consensus_result_cache)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      snapshot_exporter_(std::move(snapshot_exporter)) {}
 
 grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
     const proto::BlockRequest *request,
-    ::grpc::ServerWriter<::iroha::protocol::Block> *writer) {
+    ::grpc::ServerWriter<proto::SerializedBlock> *writer) {
   auto block_query = block_query_factory_->createBlockQuery();
   if (not block_query) {
     log_->error("Could not create block query to retrieve block from storage");
     return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
 
-  auto top_height = (*block_query)->getTopBlockHeight();
-  for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
-    auto block_result = (*block_query)->getBlock(i);
+  auto last_height = (*block_query)->getTopBlockHeight();
+  if (request->last_height() != 0) {
+    last_height = std::min<shared_model::interface::types::HeightType>(
+        last_height, request->last_height());
+  }
+  if (request->height() > last_height) {
+    return grpc::Status::OK;
+  }
 
+  // the stored bytes are sent as they are, so the blocks are neither parsed
+  // nor built here
+  SerializedBlockReader reader(std::move(*block_query),
+                               request->height(),
+                               last_height,
+                               kReadAheadBlocks);
+  proto::SerializedBlock block;
+  for (auto i = request->height(); i <= last_height; ++i) {
+    auto block_result = reader.next();
     if (auto e = expected::resultToOptionalError(block_result)) {
       return handleGetBlockError(e.value(), log_);
     }
 
-    auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
-            .value;
-
-    protocol::Block proto_block;
-    *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
-
-    writer->Write(proto_block);
+    block.set_block_v1(std::move(block_result).assumeValue());
+    if (context->IsCancelled() or not writer->Write(block)) {
+      log_->info("Stopped sending blocks at height {}", i);
+      break;
+    }
   }
 
   return grpc::Status::OK;
@@ -125,3 +219,42 @@ grpc::Status BlockLoaderService::retrieveBlock(
   *response->mutable_block_v1() = block_v1;
   return grpc::Status::OK;
 }
+
+grpc::Status BlockLoaderService::retrieveWsvSnapshot(
+    ::grpc::ServerContext *context,
+    const proto::WsvSnapshotRequest *request,
+    ::grpc::ServerWriter<proto::WsvSnapshotChunk> *writer) {
+  if (not snapshot_exporter_) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "WSV snapshots are not served by this peer.");
+  }
+  // each export holds a database connection and a transaction for its whole
+  // duration
+  if (exporting_snapshot_.exchange(true)) {
+    return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                        "Another WSV snapshot is being exported.");
+  }
+
+  proto::WsvSnapshotChunk chunk;
+  auto result = snapshot_exporter_->exportSnapshot(
+      [&](const std::string &table, std::string rows) {
+        auto &message = *chunk.mutable_rows();
+        message.set_table(table);
+        message.set_rows(std::move(rows));
+        return not context->IsCancelled() and writer->Write(chunk);
+      });
+  exporting_snapshot_ = false;
+  if (auto e = expected::resultToOptionalError(result)) {
+    log_->error("Could not export WSV snapshot: {}", e.value());
+    return grpc::Status(grpc::StatusCode::INTERNAL,
+                        "Internal error while exporting WSV snapshot.");
+  }
+
+  const auto &info = result.assumeValue();
+  auto &message = *chunk.mutable_info();
+  message.set_height(info.top_block_info.height);
+  message.set_top_block_hash(info.top_block_info.top_hash.hex());
+  message.set_snapshot_hash(info.snapshot_hash.hex());
+  writer->Write(chunk);
+  return grpc::Status::OK;
+}
@@ -6,7 +6,10 @@
 #ifndef IROHA_BLOCK_LOADER_SERVICE_HPP
 #define IROHA_BLOCK_LOADER_SERVICE_HPP
 
+#include <atomic>
+
 #include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/wsv_snapshot.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
@@ -15,26 +18,42 @@ namespace iroha {
   namespace network {
     class BlockLoaderService : public proto::Loader::Service {
      public:
+      /// Number of blocks read from storage ahead of the blocks being sent
+      static constexpr size_t kReadAheadBlocks = 16;
+
+      /**
+       * @param snapshot_exporter - exporter of WSV snapshots, nullptr if the
+       * peer does not serve them. A single snapshot is exported at a time
+       */
       BlockLoaderService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<iroha::consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ametsuchi::WsvSnapshotExporter> snapshot_exporter =
+              nullptr);
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
           const proto::BlockRequest *request,
-          ::grpc::ServerWriter<protocol::Block> *writer) override;
+          ::grpc::ServerWriter<proto::SerializedBlock> *writer) override;
 
       grpc::Status retrieveBlock(::grpc::ServerContext *context,
                                  const proto::BlockRequest *request,
                                  protocol::Block *response) override;
 
+      grpc::Status retrieveWsvSnapshot(
+          ::grpc::ServerContext *context,
+          const proto::WsvSnapshotRequest *request,
+          ::grpc::ServerWriter<proto::WsvSnapshotChunk> *writer) override;
+
      private:
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<iroha::consensus::ConsensusResultCache>
           consensus_result_cache_;
       logger::LoggerPtr log_;
+      std::shared_ptr<ametsuchi::WsvSnapshotExporter> snapshot_exporter_;
+      std::atomic_bool exporting_snapshot_{false};
     };
   }  // namespace network
 }  // namespace iroha
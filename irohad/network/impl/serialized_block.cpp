@@ -0,0 +1,22 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/serialized_block.hpp"
+
+namespace iroha {
+  namespace network {
+
+    expected::Result<protocol::Block, std::string> parseSerializedBlock(
+        const proto::SerializedBlock &block) {
+      protocol::Block proto_block;
+      if (not proto_block.mutable_block_v1()->ParseFromString(
+              block.block_v1())) {
+        return expected::makeError("Could not parse received block.");
+      }
+      return proto_block;
+    }
+
+  }  // namespace network
+}  // namespace iroha
@@ -0,0 +1,29 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SERIALIZED_BLOCK_HPP
+#define IROHA_SERIALIZED_BLOCK_HPP
+
+#include <string>
+
+#include "block.pb.h"
+#include "common/result.hpp"
+#include "loader.pb.h"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Parse the block received from block loader service
+     * @param block - the block as it is kept in block storage
+     * @return the proto block or error if the bytes are not a block
+     */
+    expected::Result<protocol::Block, std::string> parseSerializedBlock(
+        const proto::SerializedBlock &block);
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_SERIALIZED_BLOCK_HPP
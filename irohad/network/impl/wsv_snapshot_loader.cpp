@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/wsv_snapshot_loader.hpp"
+
+#include "common/bind.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+#include "network/impl/serialized_block.hpp"
+
+using namespace iroha::network;
+
+WsvSnapshotLoader::WsvSnapshotLoader(
+    std::unique_ptr<proto::Loader::StubInterface> stub,
+    shared_model::proto::ProtoBlockFactory block_factory,
+    std::chrono::milliseconds call_timeout,
+    logger::LoggerPtr log)
+    : stub_(std::move(stub)),
+      block_factory_(std::move(block_factory)),
+      call_timeout_(call_timeout),
+      log_(std::move(log)) {}
+
+iroha::expected::Result<iroha::ametsuchi::WsvSnapshotInfo, std::string>
+WsvSnapshotLoader::retrieveSnapshot(ametsuchi::WsvSnapshotImporter &importer) {
+  grpc::ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + call_timeout_);
+  proto::WsvSnapshotChunk chunk;
+  boost::optional<ametsuchi::WsvSnapshotInfo> info;
+  size_t imported_bytes = 0;
+
+  auto reader = stub_->retrieveWsvSnapshot(&context, {});
+  while (reader->Read(&chunk)) {
+    if (info) {
+      context.TryCancel();
+      reader->Finish();
+      return expected::makeError("Unexpected WSV snapshot data after its end.");
+    }
+    if (chunk.has_info()) {
+      info = ametsuchi::WsvSnapshotInfo{
+          TopBlockInfo{chunk.info().height(),
+                       shared_model::crypto::Hash::fromHexString(
+                           chunk.info().top_block_hash())},
+          shared_model::crypto::Hash::fromHexString(
+              chunk.info().snapshot_hash())};
+      continue;
+    }
+    if (auto e = expected::resultToOptionalError(
+            importer.importRows(chunk.rows().table(), chunk.rows().rows()))) {
+      context.TryCancel();
+      reader->Finish();
+      return expected::makeError(std::move(e).value());
+    }
+    imported_bytes += chunk.rows().rows().size();
+    log_->debug("Imported {} bytes of WSV snapshot", imported_bytes);
+  }
+
+  auto status = reader->Finish();
+  if (not status.ok()) {
+    return expected::makeError(fmt::format(
+        "Failed to retrieve WSV snapshot: {}", status.error_message()));
+  }
+  if (not info) {
+    return expected::makeError("WSV snapshot has no info.");
+  }
+  log_->info("Retrieved WSV snapshot at height {}, {} bytes",
+             info->top_block_info.height,
+             imported_bytes);
+  return std::move(info).value();
+}
+
+iroha::expected::Result<void, std::string> WsvSnapshotLoader::retrieveBlocks(
+    shared_model::interface::types::HeightType height,
+    const BlockConsumer &consumer) {
+  grpc::ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + call_timeout_);
+  proto::BlockRequest request;
+  proto::SerializedBlock block;
+  shared_model::interface::types::HeightType next_height = 1;
+
+  request.set_height(next_height);
+  auto reader = stub_->retrieveBlocks(&context, request);
+  // the peer sends the blocks up to its top, which may be above the height
+  while (next_height <= height and reader->Read(&block)) {
+    auto consumed = parseSerializedBlock(block) |
+        [&](auto &&proto_block) {
+          return block_factory_.createBlock(std::move(proto_block));
+        }
+        | [&](auto &&block) -> expected::Result<void, std::string> {
+      if (block->height() != next_height) {
+        return fmt::format(
+            "Expected block {}, got {}.", next_height, block->height());
+      }
+      ++next_height;
+      return consumer(std::move(block));
+    };
+    if (auto e = expected::resultToOptionalError(consumed)) {
+      context.TryCancel();
+      reader->Finish();
+      return expected::makeError(std::move(e).value());
+    }
+  }
+
+  if (next_height <= height) {
+    auto status = reader->Finish();
+    return expected::makeError(
+        fmt::format("Failed to retrieve blocks, {} of {} received: {}",
+                    next_height - 1,
+                    height,
+                    status.error_message()));
+  }
+  context.TryCancel();
+  reader->Finish();
+  log_->info("Retrieved {} blocks", height);
+  return expected::Value<void>{};
+}
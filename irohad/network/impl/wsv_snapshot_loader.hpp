@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_LOADER_HPP
+#define IROHA_WSV_SNAPSHOT_LOADER_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include "ametsuchi/wsv_snapshot.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "loader.grpc.pb.h"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Downloads the WSV snapshot and the blocks below it from a peer, which
+     * is known by its address only, so that a new peer can start without
+     * executing the whole chain
+     */
+    class WsvSnapshotLoader {
+     public:
+      /// Called with each downloaded block, returns error to stop
+      using BlockConsumer = std::function<expected::Result<void, std::string>(
+          std::shared_ptr<shared_model::interface::Block>)>;
+
+      /**
+       * @param call_timeout - deadline of each call to the peer
+       */
+      WsvSnapshotLoader(std::unique_ptr<proto::Loader::StubInterface> stub,
+                        shared_model::proto::ProtoBlockFactory block_factory,
+                        std::chrono::milliseconds call_timeout,
+                        logger::LoggerPtr log);
+
+      /**
+       * Download the snapshot into the importer
+       * @return summary of the snapshot sent by the peer, which is not
+       * checked against the imported rows yet
+       */
+      expected::Result<ametsuchi::WsvSnapshotInfo, std::string>
+      retrieveSnapshot(ametsuchi::WsvSnapshotImporter &importer);
+
+      /**
+       * Download the blocks from the first one to the given height
+       * @param consumer - called with the blocks in the order of heights
+       */
+      expected::Result<void, std::string> retrieveBlocks(
+          shared_model::interface::types::HeightType height,
+          const BlockConsumer &consumer);
+
+     private:
+      std::unique_ptr<proto::Loader::StubInterface> stub_;
+      shared_model::proto::ProtoBlockFactory block_factory_;
+      std::chrono::milliseconds call_timeout_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_LOADER_HPP
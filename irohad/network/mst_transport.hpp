@@ -11,6 +11,7 @@
 #include <rxcpp/rx-observable-fwd.hpp>
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
+#include "multi_sig_transactions/mst_types.hpp"
 
 namespace iroha {
 
@@ -32,6 +33,14 @@ namespace iroha {
           shared_model::interface::types::PublicKeyHexStringView from,
           MstState &&new_state) = 0;
 
+      /**
+       * Find the batch, which the handler has in its own state
+       * @param hash - hash of any transaction of the batch
+       * @return the batch, nullptr if there is none
+       */
+      virtual DataType findBatch(
+          const shared_model::interface::types::HashType &hash) const = 0;
+
       virtual ~MstTransportNotification() = default;
     };
 
@@ -49,7 +58,8 @@ namespace iroha {
           std::shared_ptr<MstTransportNotification> notification) = 0;
 
       /**
-       * Share state with other peer
+       * Share state with other peer. Only the batches and signatures the peer
+       * does not have are transmitted
        * @param to - peer recipient of message
        * @param providing_state - state for transmitting
        * @return true if transmission was successful, false otherwise
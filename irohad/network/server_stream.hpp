@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SERVER_STREAM_HPP
+#define IROHA_SERVER_STREAM_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include <grpc++/grpc++.h>
+
+namespace iroha {
+  namespace network {
+
+    /// Default number of responses, which are queued to a client, which is
+    /// slower than the stream producer, before the stream is closed
+    constexpr size_t kDefaultMaxQueuedResponses = 1000;
+
+    /**
+     * Server side of a server streaming call. Methods are thread-safe and do
+     * not block, responses are sent in the order of write calls
+     * @tparam Response - type of streamed messages
+     */
+    template <typename Response>
+    class ServerStream {
+     public:
+      virtual ~ServerStream() = default;
+
+      /**
+       * Queue the response to be sent to the client
+       * @param response - message to send
+       * @return false if the stream is already finished or broken, or if the
+       * client does not keep up with the responses, so that the stream is
+       * closed
+       */
+      virtual bool write(Response response) = 0;
+
+      /**
+       * Complete the stream after all the queued responses are sent.
+       * Subsequent calls have no effect
+       * @param status - status to complete the call with
+       */
+      virtual void finish(grpc::Status status) = 0;
+
+      /**
+       * Set the callback, which is called once when the call is over: either
+       * finished, or cancelled by the client, or broken. Responses are not
+       * accepted afterwards, so all the sources should be released here
+       * @param on_done - callback to call
+       */
+      virtual void setOnDone(std::function<void()> on_done) = 0;
+
+      /**
+       * @return string identifying the client for logging
+       */
+      virtual std::string peer() const = 0;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_SERVER_STREAM_HPP
@@ -0,0 +1,166 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_mempool.hpp"
+
+#include <algorithm>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+BatchMempool::BatchMempool(size_t max_batches, size_t max_bytes)
+    : max_batches_(max_batches),
+      max_bytes_(max_bytes),
+      bytes_(0),
+      next_seq_(0) {}
+
+bool BatchMempool::insert(BatchPtr batch) {
+  const auto &txs = batch->transactions();
+  if (txs.empty()) {
+    return false;
+  }
+
+  size_t bytes = 0;
+  auto created_time = txs.front()->createdTime();
+  for (const auto &tx : txs) {
+    if (transactions_.count(tx->hash()) != 0) {
+      return false;
+    }
+    bytes += tx->blob().size();
+    created_time = std::min(created_time, tx->createdTime());
+  }
+
+  auto creator = txs.front()->creatorAccountId();
+  if (not makeRoom(creator, bytes)) {
+    return false;
+  }
+
+  const auto seq = next_seq_++;
+  for (const auto &tx : txs) {
+    transactions_.emplace(tx->hash(), seq);
+  }
+  creators_[creator].insert(seq);
+  expiration_.emplace(created_time, seq);
+  bytes_ += bytes;
+  batches_.emplace(
+      seq, Entry{std::move(batch), std::move(creator), bytes, created_time});
+  return true;
+}
+
+std::vector<BatchMempool::BatchPtr> BatchMempool::getBatches(
+    size_t requested_tx_amount) const {
+  using SeqIterator = std::set<SequenceNumber>::const_iterator;
+  // pending batches of every creator, ordered by the oldest batch
+  std::vector<std::pair<SeqIterator, SeqIterator>> queues;
+  queues.reserve(creators_.size());
+  for (const auto &creator : creators_) {
+    queues.emplace_back(creator.second.begin(), creator.second.end());
+  }
+  std::sort(queues.begin(), queues.end(), [](const auto &a, const auto &b) {
+    return *a.first < *b.first;
+  });
+
+  std::vector<BatchPtr> collection;
+  size_t tx_amount = 0;
+  bool taken = true;
+  while (taken) {
+    taken = false;
+    for (auto &queue : queues) {
+      if (queue.first == queue.second) {
+        continue;
+      }
+      const auto &batch = batches_.at(*queue.first).batch;
+      const auto batch_size = batch->transactions().size();
+      if (tx_amount + batch_size > requested_tx_amount) {
+        // later batches of the creator must not overtake this one
+        queue.first = queue.second;
+        continue;
+      }
+      collection.push_back(batch);
+      tx_amount += batch_size;
+      ++queue.first;
+      taken = true;
+    }
+  }
+  return collection;
+}
+
+size_t BatchMempool::removeExpired(
+    shared_model::interface::types::TimestampType oldest_created_time) {
+  size_t removed = 0;
+  while (not expiration_.empty()
+         and expiration_.begin()->first < oldest_created_time) {
+    erase(expiration_.begin()->second);
+    ++removed;
+  }
+  return removed;
+}
+
+void BatchMempool::remove(const HashesSetType &hashes) {
+  std::set<SequenceNumber> processed;
+  for (const auto &hash : hashes) {
+    auto it = transactions_.find(hash);
+    if (it != transactions_.end()) {
+      processed.insert(it->second);
+    }
+  }
+  for (auto seq : processed) {
+    erase(seq);
+  }
+}
+
+size_t BatchMempool::size() const {
+  return batches_.size();
+}
+
+size_t BatchMempool::transactionsQuantity() const {
+  return transactions_.size();
+}
+
+bool BatchMempool::empty() const {
+  return batches_.empty();
+}
+
+bool BatchMempool::makeRoom(
+    const shared_model::interface::types::AccountIdType &creator,
+    size_t bytes) {
+  if (max_batches_ == 0 or bytes > max_bytes_) {
+    return false;
+  }
+  auto own = creators_.find(creator);
+  while (batches_.size() >= max_batches_ or bytes_ + bytes > max_bytes_) {
+    auto heaviest = std::max_element(
+        creators_.begin(), creators_.end(), [](const auto &a, const auto &b) {
+          return a.second.size() < b.second.size();
+        });
+    const size_t own_batches = own == creators_.end() ? 0 : own->second.size();
+    // do not evict if the creator of the new batch would become the heaviest
+    if (heaviest->second.size() <= own_batches + 1) {
+      return false;
+    }
+    erase(*heaviest->second.rbegin());
+  }
+  return true;
+}
+
+void BatchMempool::erase(SequenceNumber seq) {
+  auto it = batches_.find(seq);
+  if (it == batches_.end()) {
+    return;
+  }
+  for (const auto &tx : it->second.batch->transactions()) {
+    transactions_.erase(tx->hash());
+  }
+  auto creator = creators_.find(it->second.creator);
+  creator->second.erase(seq);
+  if (creator->second.empty()) {
+    creators_.erase(creator);
+  }
+  expiration_.erase({it->second.created_time, seq});
+  bytes_ -= it->second.bytes;
+  batches_.erase(it);
+}
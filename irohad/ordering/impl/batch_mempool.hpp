@@ -0,0 +1,141 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BATCH_MEMPOOL_HPP
+#define IROHA_BATCH_MEMPOOL_HPP
+
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Pool of batches waiting to be included in a proposal. Batches stay in
+     * the pool until their transactions are committed or rejected, or until
+     * they expire, so the ones which did not fit into a proposal are used in
+     * the next rounds.
+     *
+     * The pool is bounded both by the number of batches and by their size.
+     * When it is full, batches of the creator with the most pending batches
+     * are evicted first, and proposals take batches of different creators in
+     * turns, so that a single account cannot starve the others.
+     *
+     * Note: the class is not thread-safe
+     */
+    class BatchMempool {
+     public:
+      using BatchPtr =
+          std::shared_ptr<shared_model::interface::TransactionBatch>;
+      using HashesSetType =
+          std::unordered_set<shared_model::crypto::Hash,
+                             shared_model::crypto::Hash::Hasher>;
+
+      /**
+       * @param max_batches - maximum number of batches in the pool
+       * @param max_bytes - maximum total size of transactions in the pool
+       */
+      BatchMempool(size_t max_batches, size_t max_bytes);
+
+      /**
+       * Add the batch to the pool. Batches of other creators may be evicted to
+       * free space for it
+       * @return false if a transaction of the batch is already in the pool, or
+       * the batch does not fit
+       */
+      bool insert(BatchPtr batch);
+
+      /**
+       * Take batches for a proposal without removing them from the pool.
+       * Creators are served in turns in the order of their oldest batches,
+       * and batches of each creator are taken in the order of arrival.
+       * @param requested_tx_amount - maximum amount of transactions in the
+       * batches
+       */
+      std::vector<BatchPtr> getBatches(size_t requested_tx_amount) const;
+
+      /**
+       * Remove batches with transactions created before the given time
+       * @return number of removed batches
+       */
+      size_t removeExpired(
+          shared_model::interface::types::TimestampType oldest_created_time);
+
+      /**
+       * Remove batches which contain any of the given transactions
+       * @param hashes - hashes of processed transactions
+       */
+      void remove(const HashesSetType &hashes);
+
+      /// @return number of batches in the pool
+      size_t size() const;
+
+      /// @return number of transactions in the pool
+      size_t transactionsQuantity() const;
+
+      bool empty() const;
+
+     private:
+      struct Entry {
+        BatchPtr batch;
+        shared_model::interface::types::AccountIdType creator;
+        size_t bytes;
+        /// creation time of the oldest transaction of the batch
+        shared_model::interface::types::TimestampType created_time;
+      };
+
+      using SequenceNumber = uint64_t;
+
+      /// Free space for a batch of the creator with given size
+      bool makeRoom(
+          const shared_model::interface::types::AccountIdType &creator,
+          size_t bytes);
+
+      void erase(SequenceNumber seq);
+
+      const size_t max_batches_;
+      const size_t max_bytes_;
+
+      /// Batches in the order of arrival
+      std::map<SequenceNumber, Entry> batches_;
+
+      /// Batches of every creator in the order of arrival
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         std::set<SequenceNumber>>
+          creators_;
+
+      /// Batch of every pooled transaction
+      std::unordered_map<shared_model::crypto::Hash,
+                         SequenceNumber,
+                         shared_model::crypto::Hash::Hasher>
+          transactions_;
+
+      /// Batches by the creation time of their oldest transaction
+      std::set<std::pair<shared_model::interface::types::TimestampType,
+                         SequenceNumber>>
+          expiration_;
+
+      size_t bytes_;
+      SequenceNumber next_seq_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_BATCH_MEMPOOL_HPP
@@ -45,6 +45,7 @@ OnDemandOrderingGate::OnDemandOrderingGate(
             log_->debug("Asking to remove {} transactions from cache.",
                         hashes->size());
             cache_->remove(*hashes);
+            ordering_service_->onTxsCommitted(*hashes);
           })),
       round_switch_subscription_(round_switch_events.subscribe(
           [this,
@@ -33,9 +33,14 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
     logger::LoggerPtr log,
-    size_t number_of_proposals)
+    size_t number_of_proposals,
+    size_t max_pending_batches,
+    size_t max_pending_bytes,
+    std::chrono::milliseconds max_batch_lifetime)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
+      pending_batches_(max_pending_batches, max_pending_bytes),
+      max_batch_lifetime_(max_batch_lifetime),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       proposal_creation_strategy_(std::move(proposal_creation_strategy)),
@@ -51,6 +56,13 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
   tryErase(round);
 }
 
+void OnDemandOrderingServiceImpl::onTxsCommitted(const HashesSetType &hashes) {
+  std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
+  pending_batches_.remove(hashes);
+  log_->debug("onTxsCommitted => {} batches left pending",
+              pending_batches_.size());
+}
+
 // ----------------------------| OdOsNotification |-----------------------------
 
 void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
@@ -60,12 +72,15 @@ void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
                     batch->reducedHash().hex());
         return not this->batchAlreadyProcessed(*batch);
       });
+  std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
   std::for_each(
       unprocessed_batches.begin(),
       unprocessed_batches.end(),
       [this](auto &obj) {
-        std::shared_lock<std::shared_timed_mutex> lock(batches_mutex_);
-        pending_batches_.insert(std::move(obj));
+        if (not pending_batches_.insert(obj)) {
+          log_->debug("Batch {} is a duplicate or the pool is full",
+                      obj->reducedHash().hex());
+        }
       });
   log_->info("onBatches => collection size = {}", batches.size());
 }
@@ -96,58 +111,63 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
 
 // ---------------------------------| Private |---------------------------------
 
-/**
- * Get transactions from the given batches queue. Does not break batches -
- * continues getting all the transactions from the ongoing batch until the
- * required amount is collected.
- * @param requested_tx_amount - amount of transactions to get
- * @param batch_collection - the collection to get transactions from
- * @param discarded_txs_amount - the amount of discarded txs
- * @return transactions
- */
-static std::vector<std::shared_ptr<shared_model::interface::Transaction>>
-getTransactions(size_t requested_tx_amount,
-                detail::BatchSetType &batch_collection,
-                boost::optional<size_t &> discarded_txs_amount) {
-  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
-
-  auto it = batch_collection.begin();
-  for (; it != batch_collection.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
-    collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
+void OnDemandOrderingServiceImpl::packNextProposals(
+    const consensus::Round &round) {
+  auto now = iroha::time::now();
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
+    if (auto expired = pending_batches_.removeExpired(
+            now - static_cast<shared_model::interface::types::TimestampType>(
+                      max_batch_lifetime_.count()))) {
+      log_->info("Dropped {} expired batches", expired);
+    }
   }
 
-  if (discarded_txs_amount) {
-    *discarded_txs_amount = 0;
-    for (; it != batch_collection.end(); ++it) {
-      *discarded_txs_amount += boost::size((*it)->transactions());
+  // batches stay in the pool until they are committed, so the ones which do
+  // not fit are used for the following rounds. The batches may have been
+  // processed in a block built by another peer after they were pooled, which
+  // is checked in the database without the lock, so that the new batches are
+  // not blocked meanwhile, and the processed batches are removed before the
+  // next selection
+  std::vector<BatchMempool::BatchPtr> batches;
+  std::unordered_set<shared_model::crypto::Hash,
+                     shared_model::crypto::Hash::Hasher>
+      checked_batches;
+  HashesSetType processed_txs;
+  size_t pooled_txs = 0;
+  do {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
+      pending_batches_.remove(processed_txs);
+      batches = pending_batches_.getBatches(transaction_limit_);
+      pooled_txs = pending_batches_.transactionsQuantity();
     }
-  }
+    processed_txs.clear();
+    for (const auto &batch : batches) {
+      if (not checked_batches.insert(batch->reducedHash()).second) {
+        continue;
+      }
+      if (batchAlreadyProcessed(*batch, false)) {
+        for (const auto &tx : batch->transactions()) {
+          processed_txs.insert(tx->hash());
+        }
+      }
+    }
+  } while (not processed_txs.empty());
 
-  return collection;
-}
+  TransactionsCollectionType txs;
+  for (const auto &batch : batches) {
+    const auto &batch_txs = batch->transactions();
+    txs.insert(txs.end(), batch_txs.begin(), batch_txs.end());
+  }
+  log_->debug("{} transactions are left for the following rounds",
+              pooled_txs - txs.size());
 
-void OnDemandOrderingServiceImpl::packNextProposals(
-    const consensus::Round &round) {
-  if (not pending_batches_.empty()) {
-    size_t discarded_txs_quantity;
-    auto txs = getTransactions(
-        transaction_limit_, pending_batches_, discarded_txs_quantity);
-    log_->debug("Discarded {} transactions", discarded_txs_quantity);
-    auto now = iroha::time::now();
+  if (not txs.empty()) {
     // create proposals for the next commit and reject rounds
     tryCreateProposal({round.block_round, round.reject_round + 1}, txs, now);
     tryCreateProposal({round.block_round + 1, kFirstRejectRound}, txs, now);
   }
-
-  if (round.reject_round == kFirstRejectRound) {
-    std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
-    pending_batches_.clear();
-  }
 }
 
 void OnDemandOrderingServiceImpl::tryCreateProposal(
@@ -205,12 +225,12 @@ void OnDemandOrderingServiceImpl::tryErase(
 }
 
 bool OnDemandOrderingServiceImpl::batchAlreadyProcessed(
-    const shared_model::interface::TransactionBatch &batch) {
+    const shared_model::interface::TransactionBatch &batch, bool on_error) {
   auto tx_statuses = tx_cache_->check(batch);
   if (not tx_statuses) {
     // TODO andrei 30.11.18 IR-51 Handle database error
     log_->warn("Check tx presence database error. Batch: {}", batch);
-    return true;
+    return on_error;
   }
   // if any transaction is commited or rejected, batch was already processed
   // Note: any_of returns false for empty sequence
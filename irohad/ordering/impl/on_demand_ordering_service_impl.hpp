@@ -8,15 +8,13 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
+#include <chrono>
 #include <map>
 #include <shared_mutex>
 
-#include <tbb/concurrent_unordered_set.h>
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
-#include "multi_sig_transactions/hash.hpp"
-// TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
-#include "multi_sig_transactions/state/mst_state.hpp"
+#include "ordering/impl/batch_mempool.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
@@ -26,11 +24,6 @@ namespace iroha {
   }
   namespace ordering {
     namespace detail {
-      using BatchSetType = tbb::concurrent_unordered_set<
-          transport::OdOsNotification::TransactionBatchType,
-          model::PointerBatchHasher,
-          shared_model::interface::BatchHashEquality>;
-
       using ProposalMapType = std::map<
           consensus::Round,
           std::shared_ptr<const transport::OdOsNotification::ProposalType>>;
@@ -38,6 +31,13 @@ namespace iroha {
 
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
+      static constexpr size_t kDefaultMaxPendingBatches = 10000;
+      static constexpr size_t kDefaultMaxPendingBytes = 64 * 1024 * 1024;
+      /// Transactions older than that are rejected by the stateless
+      /// validation of proposals
+      static constexpr std::chrono::milliseconds kDefaultMaxBatchLifetime =
+          std::chrono::hours(24);
+
       /**
        * Create on_demand ordering service with following options:
        * @param transaction_limit - number of maximum transactions in one
@@ -48,6 +48,12 @@ namespace iroha {
        * @param number_of_proposals - number of stored proposals, older will be
        * removed. Default value is 3
        * @param creation_strategy - provides a strategy for creating proposals
+       * @param max_pending_batches - maximum number of batches waiting for a
+       * proposal
+       * @param max_pending_bytes - maximum total size of transactions waiting
+       * for a proposal
+       * @param max_batch_lifetime - batches with transactions created earlier
+       * than that before the proposal are dropped
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -56,12 +62,18 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
           logger::LoggerPtr log,
-          size_t number_of_proposals = 3);
+          size_t number_of_proposals = 3,
+          size_t max_pending_batches = kDefaultMaxPendingBatches,
+          size_t max_pending_bytes = kDefaultMaxPendingBytes,
+          std::chrono::milliseconds max_batch_lifetime =
+              kDefaultMaxBatchLifetime);
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
       void onCollaborationOutcome(consensus::Round round) override;
 
+      void onTxsCommitted(const HashesSetType &hashes) override;
+
       // ----------------------- | OdOsNotification | --------------------------
 
       void onBatches(CollectionType batches) override;
@@ -93,9 +105,11 @@ namespace iroha {
 
       /**
        * Check if batch was already processed by the peer
+       * @param on_error - result in case of the database error
        */
       bool batchAlreadyProcessed(
-          const shared_model::interface::TransactionBatch &batch);
+          const shared_model::interface::TransactionBatch &batch,
+          bool on_error = true);
 
       /**
        * Max number of transaction in one proposal
@@ -113,9 +127,15 @@ namespace iroha {
       detail::ProposalMapType proposal_map_;
 
       /**
-       * Collections of batches for current round
+       * Batches waiting to be included in a committed block
+       */
+      BatchMempool pending_batches_;
+
+      /**
+       * Lifetime of the pending batches since the creation of their oldest
+       * transaction
        */
-      detail::BatchSetType pending_batches_;
+      std::chrono::milliseconds max_batch_lifetime_;
 
       /**
        * Batches and proposal collection mutexes for public methods
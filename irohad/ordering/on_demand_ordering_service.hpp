@@ -8,6 +8,10 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <unordered_set>
+
+#include "cryptography/hash.hpp"
+
 namespace iroha {
   namespace ordering {
 
@@ -21,6 +25,16 @@ namespace iroha {
        * @param round - proposal round which has started
        */
       virtual void onCollaborationOutcome(consensus::Round round) = 0;
+
+      using HashesSetType =
+          std::unordered_set<shared_model::crypto::Hash,
+                             shared_model::crypto::Hash::Hasher>;
+
+      /**
+       * Method which should be invoked on commit of a block
+       * @param hashes - hashes of committed and rejected transactions
+       */
+      virtual void onTxsCommitted(const HashesSetType &hashes) = 0;
     };
 
   }  // namespace ordering
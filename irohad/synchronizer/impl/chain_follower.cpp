@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/chain_follower.hpp"
+
+#include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/mutable_storage.hpp"
+#include "common/bind.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/common_objects/string_view_types.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+using namespace shared_model::interface::types;
+
+namespace iroha {
+  namespace synchronizer {
+
+    ChainFollower::ChainFollower(
+        std::unique_ptr<ametsuchi::CommandExecutor> command_executor,
+        std::shared_ptr<validation::ChainValidator> validator,
+        std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
+        std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+        std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+        std::shared_ptr<network::BlockLoader> block_loader,
+        logger::LoggerPtr log)
+        : command_executor_(std::move(command_executor)),
+          validator_(std::move(validator)),
+          mutable_factory_(std::move(mutable_factory)),
+          block_query_factory_(std::move(block_query_factory)),
+          peer_query_factory_(std::move(peer_query_factory)),
+          block_loader_(std::move(block_loader)),
+          next_peer_(0),
+          log_(std::move(log)) {}
+
+    ChainFollower::~ChainFollower() {
+      subscription_.unsubscribe();
+      // wait for the running synchronization
+      std::lock_guard<std::mutex> lock(synchronize_mutex_);
+    }
+
+    iroha::expected::Result<HeightType, std::string>
+    ChainFollower::synchronize() {
+      std::lock_guard<std::mutex> lock(synchronize_mutex_);
+
+      auto block_query = block_query_factory_->createBlockQuery();
+      if (not block_query) {
+        return expected::makeError("Failed to create block query");
+      }
+      auto peers = peer_query_factory_->createPeerQuery() |
+          [](auto &&peer_query) { return peer_query->getLedgerPeers(); };
+      if (not peers or peers->empty()) {
+        return expected::makeError("Failed to fetch ledger peers");
+      }
+
+      const HeightType top_height = (*block_query)->getTopBlockHeight();
+      HeightType my_height = top_height;
+      auto storage = mutable_factory_->createMutableStorage(command_executor_);
+      const size_t first_peer = next_peer_++ % peers->size();
+      for (size_t i = 0; i < peers->size(); ++i) {
+        const auto &peer = peers->at((first_peer + i) % peers->size());
+        log_->debug("trying to download blocks from {} from peer with key {}",
+                    my_height + 1,
+                    peer->pubkey());
+        auto applied = validator_->validateAndApply(
+            block_loader_->retrieveBlocks(
+                my_height, PublicKeyHexStringView{peer->pubkey()}),
+            *storage);
+
+        // a rejected or missing block is asked again from the next peer
+        if (auto ledger_state = storage->getLedgerState()) {
+          my_height = (*ledger_state)->top_block_info.height;
+        }
+        if (applied) {
+          // the peer has sent all the blocks it has, the rest will be
+          // downloaded on the next attempt
+          break;
+        }
+      }
+
+      if (my_height == top_height) {
+        return top_height;
+      }
+      return mutable_factory_->commit(std::move(storage)) |
+          [](auto &&ledger_state) -> expected::Result<HeightType, std::string> {
+        return ledger_state->top_block_info.height;
+      };
+    }
+
+    void ChainFollower::start(std::chrono::milliseconds period) {
+      rxcpp::observable<>::interval(std::chrono::steady_clock::now(),
+                                    period,
+                                    rxcpp::observe_on_new_thread())
+          .subscribe(subscription_, [this](auto) {
+            this->synchronize().match(
+                [this](const auto &height) {
+                  log_->debug("ledger is at height {}", height.value);
+                },
+                [this](const auto &error) {
+                  log_->error("Failed to follow the ledger: {}", error.error);
+                });
+          });
+    }
+
+  }  // namespace synchronizer
+}  // namespace iroha
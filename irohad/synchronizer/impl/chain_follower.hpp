@@ -0,0 +1,87 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHAIN_FOLLOWER_HPP
+#define IROHA_CHAIN_FOLLOWER_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include <rxcpp/rx-lite.hpp>
+#include "ametsuchi/mutable_factory.hpp"
+#include "ametsuchi/peer_query_factory.hpp"
+#include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "network/block_loader.hpp"
+#include "validation/chain_validator.hpp"
+
+namespace iroha {
+
+  namespace ametsuchi {
+    class BlockQueryFactory;
+    class CommandExecutor;
+  }  // namespace ametsuchi
+
+  namespace synchronizer {
+
+    /**
+     * Keeps the local ledger up to date with the network without taking part
+     * in consensus. The blocks above the local top block are downloaded from
+     * the ledger peers, validated against the peers of the local ledger and
+     * committed to the local storage. Used by the peers which only serve
+     * queries
+     */
+    class ChainFollower {
+     public:
+      ChainFollower(
+          std::unique_ptr<ametsuchi::CommandExecutor> command_executor,
+          std::shared_ptr<validation::ChainValidator> validator,
+          std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
+          std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          std::shared_ptr<network::BlockLoader> block_loader,
+          logger::LoggerPtr log);
+
+      ~ChainFollower();
+
+      /**
+       * Download the missing blocks from the ledger peers and commit them.
+       * Peers are asked in turns in order to spread the load, the next peer
+       * is asked only when the previous one has failed to send its blocks
+       * @return the local top block height after the synchronization
+       */
+      iroha::expected::Result<shared_model::interface::types::HeightType,
+                              std::string>
+      synchronize();
+
+      /**
+       * Synchronize with the given period until the follower is destroyed
+       * @param period - delay between the synchronization attempts
+       */
+      void start(std::chrono::milliseconds period);
+
+     private:
+      std::shared_ptr<ametsuchi::CommandExecutor> command_executor_;
+      std::shared_ptr<validation::ChainValidator> validator_;
+      std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
+      std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
+      std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+      std::shared_ptr<network::BlockLoader> block_loader_;
+
+      /// index of the ledger peer which is asked first on the next attempt
+      size_t next_peer_;
+      /// guards synchronize from the concurrent calls
+      std::mutex synchronize_mutex_;
+      rxcpp::composite_subscription subscription_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_CHAIN_FOLLOWER_HPP
@@ -0,0 +1,280 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/parallel_block_downloader.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <rxcpp/operators/rx-take.hpp>
+#include <rxcpp/operators/rx-take_while.hpp>
+#include <rxcpp/rx-lite.hpp>
+#include "interfaces/common_objects/string_view_types.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+using namespace shared_model::interface::types;
+
+namespace {
+  /// How often the waiting for a chunk checks for the stalled peers
+  const std::chrono::milliseconds kSlowPeerCheckPeriod{100};
+}  // namespace
+
+namespace iroha {
+  namespace synchronizer {
+
+    ParallelBlockDownloader::ParallelBlockDownloader(
+        std::shared_ptr<network::BlockLoader> block_loader,
+        ParallelDownloadOptions options,
+        HeightType start_height,
+        HeightType target_height,
+        const PublicKeyCollectionType &public_keys,
+        logger::LoggerPtr log)
+        : block_loader_(std::move(block_loader)),
+          options_(std::move(options)),
+          target_height_(target_height),
+          stopped_(false),
+          next_height_(start_height + 1),
+          returned_peer_(0),
+          log_(std::move(log)) {
+      assert(options_.chunk_size > 0);
+      for (auto first = start_height + 1; first <= target_height;
+           first += options_.chunk_size) {
+        pending_.emplace(
+            first, std::min(first + options_.chunk_size - 1, target_height));
+      }
+      for (const auto &public_key : public_keys) {
+        peers_.emplace_back();
+        peers_.back().public_key = public_key;
+      }
+      log_->info("Downloading blocks from {} to {} from {} peers",
+                 start_height + 1,
+                 target_height,
+                 peers_.size());
+      for (size_t peer = 0; peer < peers_.size(); ++peer) {
+        workers_.emplace_back([this, peer] { this->work(peer); });
+      }
+    }
+
+    ParallelBlockDownloader::~ParallelBlockDownloader() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+        // a peer may never finish its stream otherwise
+        for (auto &peer : peers_) {
+          peer.request.unsubscribe();
+        }
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    boost::optional<ParallelBlockDownloader::Chunk>
+    ParallelBlockDownloader::next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (next_height_ <= target_height_) {
+        auto it = ready_.find(next_height_);
+        if (it != ready_.end()) {
+          auto chunk = std::move(it->second);
+          ready_.erase(it);
+          returned_range_ =
+              Range{next_height_, next_height_ + chunk.blocks.size() - 1};
+          returned_peer_ = chunk.peer;
+          next_height_ = returned_range_->second + 1;
+          // the window of the downloaded chunks has moved
+          cv_.notify_all();
+          return std::move(chunk.blocks);
+        }
+        if (not hasPeers()) {
+          log_->warn("No peers are left to download block {}", next_height_);
+          return boost::none;
+        }
+        if (cv_.wait_for(lock, kSlowPeerCheckPeriod)
+            == std::cv_status::timeout) {
+          cancelStalledRequests();
+          evictSlowPeers();
+        }
+      }
+      return boost::none;
+    }
+
+    void ParallelBlockDownloader::reject(HeightType height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (not returned_range_ or height < returned_range_->first
+          or height > returned_range_->second) {
+        log_->error("Rejected block {} has not been returned", height);
+        return;
+      }
+      pending_.emplace(height, returned_range_->second);
+      next_height_ = height;
+      returned_range_ = boost::none;
+      evict(returned_peer_, "invalid block");
+    }
+
+    void ParallelBlockDownloader::work(size_t peer) {
+      auto &state = peers_[peer];
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (auto range = takeRange(lock, peer)) {
+        const auto first = range->first;
+        const auto last = range->second;
+        state.range = range;
+        state.range_blocks = 0;
+        state.range_started = Clock::now();
+        state.request = rxcpp::composite_subscription();
+        auto request = state.request;
+        lock.unlock();
+
+        Chunk blocks;
+        block_loader_
+            ->retrieveBlockRange(
+                first - 1, last, PublicKeyHexStringView{state.public_key})
+            .take_while([&](const BlockPtr &block) {
+              std::lock_guard<std::mutex> block_lock(mutex_);
+              if (stopped_ or not state.range
+                  or block->height() != first + blocks.size()) {
+                return false;
+              }
+              ++state.range_blocks;
+              return true;
+            })
+            .take(last - first + 1)
+            .as_blocking()
+            .subscribe(request, [&blocks](BlockPtr block) {
+              blocks.push_back(std::move(block));
+            });
+
+        lock.lock();
+        if (not state.range) {
+          // the peer has been evicted and the chunk is downloaded by others
+          continue;
+        }
+        state.range = boost::none;
+        state.blocks += blocks.size();
+        state.duration += Clock::now() - state.range_started;
+        log_->debug("Downloaded {} blocks from {} from peer {}",
+                    blocks.size(),
+                    first,
+                    state.public_key);
+        if (blocks.size() < last - first + 1) {
+          pending_.emplace(first + blocks.size(), last);
+          if (++state.failures >= options_.max_peer_failures) {
+            evict(peer, "incomplete chunks");
+          }
+        }
+        if (not blocks.empty()) {
+          ready_.emplace(first, ReadyChunk{std::move(blocks), peer});
+        }
+        cancelStalledRequests();
+        evictSlowPeers();
+        cv_.notify_all();
+      }
+    }
+
+    boost::optional<ParallelBlockDownloader::Range>
+    ParallelBlockDownloader::takeRange(std::unique_lock<std::mutex> &lock,
+                                       size_t peer) {
+      const auto window =
+          options_.chunk_size * std::max(options_.chunks_ahead, peers_.size());
+      cv_.wait(lock, [&] {
+        return stopped_ or peers_[peer].evicted
+            or (not pending_.empty()
+                and pending_.begin()->first < next_height_ + window);
+      });
+      if (stopped_ or peers_[peer].evicted) {
+        return boost::none;
+      }
+      Range range = *pending_.begin();
+      pending_.erase(pending_.begin());
+      return range;
+    }
+
+    double ParallelBlockDownloader::throughput(const PeerState &peer,
+                                               Clock::time_point now) const {
+      auto blocks = peer.blocks;
+      auto duration = peer.duration;
+      if (peer.range) {
+        blocks += peer.range_blocks;
+        duration += now - peer.range_started;
+      }
+      const auto seconds =
+          std::chrono::duration_cast<std::chrono::duration<double>>(duration)
+              .count();
+      return seconds > 0 ? blocks / seconds : 0;
+    }
+
+    void ParallelBlockDownloader::evictSlowPeers() {
+      if (options_.min_relative_throughput <= 0) {
+        return;
+      }
+      const auto now = Clock::now();
+      double best = 0;
+      for (const auto &peer : peers_) {
+        // a peer is compared with the others only after its first chunk
+        if (not peer.evicted and peer.blocks > 0) {
+          best = std::max(best, throughput(peer, now));
+        }
+      }
+      if (best <= 0) {
+        return;
+      }
+      // the peers are not judged before the fastest one could have
+      // downloaded a chunk
+      const std::chrono::duration<double> min_duration{options_.chunk_size
+                                                       / best};
+      for (size_t i = 0; i < peers_.size(); ++i) {
+        const auto &peer = peers_[i];
+        auto duration = peer.duration;
+        if (peer.range) {
+          duration += now - peer.range_started;
+        }
+        if (not peer.evicted and duration >= min_duration
+            and throughput(peer, now)
+                < options_.min_relative_throughput * best) {
+          evict(i, "slow download");
+        }
+      }
+    }
+
+    void ParallelBlockDownloader::cancelStalledRequests() {
+      const auto now = Clock::now();
+      for (auto &peer : peers_) {
+        // the worker counts the cancelled chunk as incomplete
+        if (peer.range and peer.request.is_subscribed()
+            and now - peer.range_started >= options_.chunk_timeout) {
+          log_->warn("Cancelled the request of blocks from {} to peer {}",
+                     peer.range->first,
+                     peer.public_key);
+          peer.request.unsubscribe();
+        }
+      }
+    }
+
+    void ParallelBlockDownloader::evict(size_t peer, const char *reason) {
+      auto &state = peers_[peer];
+      if (state.evicted) {
+        return;
+      }
+      state.evicted = true;
+      if (state.range) {
+        pending_.emplace(state.range->first, state.range->second);
+        state.range = boost::none;
+        state.request.unsubscribe();
+      }
+      log_->warn("Stopped downloading blocks from peer {}: {}",
+                 state.public_key,
+                 reason);
+      cv_.notify_all();
+    }
+
+    bool ParallelBlockDownloader::hasPeers() const {
+      return std::any_of(peers_.begin(), peers_.end(), [](const auto &peer) {
+        return not peer.evicted;
+      });
+    }
+
+  }  // namespace synchronizer
+}  // namespace iroha
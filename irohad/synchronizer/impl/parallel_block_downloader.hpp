@@ -0,0 +1,161 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
+#define IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <rxcpp/rx-lite.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "network/block_loader.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    /**
+     * Parameters of the download of the missing blocks from several peers
+     */
+    struct ParallelDownloadOptions {
+      /// number of blocks requested from a peer at once
+      shared_model::interface::types::HeightType chunk_size = 500;
+      /// number of chunks which are downloaded ahead of the validated ones
+      size_t chunks_ahead = 16;
+      /// a peer is evicted if its throughput falls below this part of the
+      /// throughput of the fastest peer, 0 disables the eviction
+      double min_relative_throughput = 0.25;
+      /// a peer is evicted after this number of incomplete chunks
+      size_t max_peer_failures = 3;
+      /// a chunk request is cancelled and counted as incomplete if it is not
+      /// finished within this time
+      std::chrono::milliseconds chunk_timeout{std::chrono::minutes(1)};
+    };
+
+    /**
+     * Downloads the range of blocks from several peers at once. The range is
+     * split into chunks, which are requested from the peers in parallel and
+     * returned in the order of heights, so that the returned chunks are
+     * validated while the next ones are downloaded. The peers which fail,
+     * send invalid blocks or are much slower than the fastest peer are
+     * evicted, and their chunks are requested from the others
+     */
+    class ParallelBlockDownloader {
+     public:
+      using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+      using Chunk = std::vector<BlockPtr>;
+
+      /**
+       * Start downloading the blocks above start_height up to target_height
+       * @param public_keys - keys of the peers to download the blocks from
+       */
+      ParallelBlockDownloader(
+          std::shared_ptr<network::BlockLoader> block_loader,
+          ParallelDownloadOptions options,
+          shared_model::interface::types::HeightType start_height,
+          shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &public_keys,
+          logger::LoggerPtr log);
+
+      /// Stops the download, cancels the current requests and waits for them
+      /// to finish
+      ~ParallelBlockDownloader();
+
+      /**
+       * Wait for the chunk which follows the previously returned one
+       * @return the consecutive blocks, or none if all the blocks have been
+       * returned or no peer is left to download them
+       */
+      boost::optional<Chunk> next();
+
+      /**
+       * Report that the block of the last returned chunk at the given height
+       * is invalid. The peer which sent it is evicted, and the blocks from
+       * this height are downloaded again and returned by the next call
+       */
+      void reject(shared_model::interface::types::HeightType height);
+
+     private:
+      using Clock = std::chrono::steady_clock;
+      /// first and last heights of a chunk
+      using Range = std::pair<shared_model::interface::types::HeightType,
+                              shared_model::interface::types::HeightType>;
+
+      struct PeerState {
+        std::string public_key;
+        bool evicted = false;
+        size_t failures = 0;
+        /// totals of the finished requests
+        size_t blocks = 0;
+        Clock::duration duration{};
+        /// the chunk which is being downloaded
+        boost::optional<Range> range;
+        size_t range_blocks = 0;
+        Clock::time_point range_started;
+        /// unsubscribing cancels the request of the chunk
+        rxcpp::composite_subscription request;
+      };
+
+      struct ReadyChunk {
+        Chunk blocks;
+        size_t peer;
+      };
+
+      /// Download the chunks by one peer until it is evicted or stopped
+      void work(size_t peer);
+
+      /// Take the lowest pending chunk within the window, under the lock
+      boost::optional<Range> takeRange(std::unique_lock<std::mutex> &lock,
+                                       size_t peer);
+
+      /// Blocks per second of the peer including its current request
+      double throughput(const PeerState &peer, Clock::time_point now) const;
+
+      /// Evict the peers which are too slow compared to the fastest one
+      void evictSlowPeers();
+
+      /// Cancel the requests which have not finished within the chunk timeout
+      void cancelStalledRequests();
+
+      void evict(size_t peer, const char *reason);
+
+      bool hasPeers() const;
+
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      const ParallelDownloadOptions options_;
+      const shared_model::interface::types::HeightType target_height_;
+
+      mutable std::mutex mutex_;
+      std::condition_variable cv_;
+      bool stopped_;
+      /// the first height which has not been returned by next
+      shared_model::interface::types::HeightType next_height_;
+      /// the last returned chunk and the peer which sent it
+      boost::optional<Range> returned_range_;
+      size_t returned_peer_;
+      /// chunks to download, by the first height
+      std::map<shared_model::interface::types::HeightType,
+               shared_model::interface::types::HeightType>
+          pending_;
+      /// downloaded chunks, by the first height
+      std::map<shared_model::interface::types::HeightType, ReadyChunk> ready_;
+      std::vector<PeerState> peers_;
+      std::vector<std::thread> workers_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
@@ -29,12 +29,14 @@ namespace iroha {
         std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
         std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
         std::shared_ptr<network::BlockLoader> block_loader,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        ParallelDownloadOptions download_options)
         : command_executor_(std::move(command_executor)),
           validator_(std::move(validator)),
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          download_options_(std::move(download_options)),
           notifier_(notifier_lifetime_),
           log_(std::move(log)) {
       consensus_gate->onOutcome().subscribe(
@@ -93,6 +95,17 @@ namespace iroha {
       auto storage = getStorage();
       shared_model::interface::types::HeightType my_height = start_height;
 
+      if (public_keys.size() > 1
+          and target_height - start_height > download_options_.chunk_size) {
+        my_height = downloadInParallel(
+            start_height, target_height, public_keys, *storage);
+        if (my_height >= target_height) {
+          return mutable_factory_->commit(std::move(storage));
+        }
+        log_->warn("Continuing synchronization from block {} with one peer",
+                   my_height + 1);
+      }
+
       // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
       for (const auto &public_key : public_keys) {
         while (true) {
@@ -136,6 +149,37 @@ namespace iroha {
           "Failed to download and commit any blocks from given peers");
     }
 
+    HeightType SynchronizerImpl::downloadInParallel(
+        const HeightType start_height,
+        const HeightType target_height,
+        const PublicKeyCollectionType &public_keys,
+        ametsuchi::MutableStorage &storage) {
+      ParallelBlockDownloader downloader(block_loader_,
+                                         download_options_,
+                                         start_height,
+                                         target_height,
+                                         public_keys,
+                                         log_);
+      HeightType my_height = start_height;
+      while (auto chunk = downloader.next()) {
+        // the chunk is validated while the downloader fetches the next ones
+        auto network_chain =
+            rxcpp::observable<>::iterate(*chunk).tap(
+                [&my_height](const std::shared_ptr<
+                             shared_model::interface::Block> &block) {
+                  my_height = block->height();
+                });
+        if (not validator_->validateAndApply(network_chain, storage)) {
+          // last block did not apply - it is downloaded again from other peer
+          const auto failed_height =
+              std::max(my_height, chunk->front()->height());
+          downloader.reject(failed_height);
+          my_height = failed_height - 1;
+        }
+      }
+      return my_height;
+    }
+
     std::unique_ptr<ametsuchi::MutableStorage> SynchronizerImpl::getStorage() {
       return mutable_factory_->createMutableStorage(command_executor_);
     }
@@ -15,6 +15,7 @@
 #include "logger/logger_fwd.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
+#include "synchronizer/impl/parallel_block_downloader.hpp"
 #include "validation/chain_validator.hpp"
 
 namespace iroha {
@@ -35,7 +36,8 @@ namespace iroha {
           std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<network::BlockLoader> block_loader,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          ParallelDownloadOptions download_options = {});
 
       ~SynchronizerImpl() override;
 
@@ -45,7 +47,8 @@ namespace iroha {
      private:
       /**
        * Iterate through the peers which signed the commit message, load and
-       * apply the missing blocks
+       * apply the missing blocks. Long ranges are downloaded from several
+       * peers at once first
        * @param start_height - the block from which to start synchronization
        * @param target_height - the block height that must be reached
        * @param public_keys - public keys of peers from which to ask the blocks
@@ -57,6 +60,18 @@ namespace iroha {
           const shared_model::interface::types::PublicKeyCollectionType
               &public_keys);
 
+      /**
+       * Download the blocks from several peers at once and apply them while
+       * the next ones are downloaded
+       * @return the height of the last applied block
+       */
+      shared_model::interface::types::HeightType downloadInParallel(
+          const shared_model::interface::types::HeightType start_height,
+          const shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &public_keys,
+          ametsuchi::MutableStorage &storage);
+
       void processNext(const consensus::PairValid &msg);
 
       /**
@@ -76,6 +91,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      ParallelDownloadOptions download_options_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
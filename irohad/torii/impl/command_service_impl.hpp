@@ -11,7 +11,7 @@
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "logger/logger_fwd.hpp"
@@ -26,7 +26,7 @@ namespace iroha {
     class CommandServiceImpl : public CommandService {
      public:
       // TODO: 2019-03-13 @muratovv fix with abstract cache type IR-397
-      using CacheType = iroha::cache::Cache<
+      using CacheType = iroha::cache::ShardedCache<
           shared_model::crypto::Hash,
           std::shared_ptr<shared_model::interface::TransactionResponse>,
           shared_model::crypto::Hash::Hasher>;
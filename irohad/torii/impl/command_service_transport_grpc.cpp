@@ -10,18 +10,15 @@
 #include <atomic>
 #include <condition_variable>
 #include <iterator>
+#include <mutex>
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include <rxcpp/operators/rx-start_with.hpp>
-#include <rxcpp/operators/rx-take_while.hpp>
-#include "backend/protobuf/deserialize_repeated_transactions.hpp"
+#include <rxcpp/operators/rx-subscribe_on.hpp>
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
 #include "backend/protobuf/util.hpp"
-#include "common/combine_latest_until_first_completed.hpp"
-#include "common/run_loop_handler.hpp"
 #include "cryptography/hash_providers/sha3_256.hpp"
 #include "interfaces/iroha_internal/parse_and_create_batches.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -30,6 +27,8 @@
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "network/impl/async_server_stream.hpp"
+#include "torii/impl/transaction_verification_stage.hpp"
 #include "torii/status_bus.hpp"
 
 namespace iroha {
@@ -47,16 +46,23 @@ namespace iroha {
             transaction_batch_factory,
         rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
         int maximum_rounds_without_update,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        size_t verification_threads,
+        size_t max_queued_responses,
+        rxcpp::observe_on_one_worker status_worker)
         : command_service_(std::move(command_service)),
           status_bus_(std::move(status_bus)),
           status_factory_(std::move(status_factory)),
           transaction_factory_(std::move(transaction_factory)),
+          verification_stage_(std::make_shared<TransactionVerificationStage>(
+              transaction_factory_, verification_threads)),
           batch_parser_(std::move(batch_parser)),
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
-          maximum_rounds_without_update_(maximum_rounds_without_update) {}
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          max_queued_responses_(max_queued_responses),
+          status_worker_(std::move(status_worker)) {}
 
     grpc::Status CommandServiceTransportGrpc::Torii(
         grpc::ServerContext *context,
@@ -85,8 +91,9 @@ namespace iroha {
         return grpc::Status::OK;
       };
 
-      auto transactions = shared_model::proto::deserializeTransactions(
-          *transaction_factory_, request->transactions());
+      // signatures of the transactions are checked in parallel
+      auto transactions =
+          verification_stage_->verify(request->transactions());
       if (auto e = expected::resultToOptionalError(transactions)) {
         return publish_stateless_fail(
             fmt::format("Transaction deserialization failed: hash {}, {}",
@@ -103,6 +110,7 @@ namespace iroha {
             fmt::format("Batch deserialization failed: {}", *e));
       }
 
+      // batches are passed further in the order of arrival
       for (auto &batch : std::move(batches).assumeValue()) {
         this->command_service_->handleTransactionBatch(std::move(batch));
       }
@@ -123,89 +131,138 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
-    grpc::Status CommandServiceTransportGrpc::StatusStream(
-        grpc::ServerContext *context,
-        const iroha::protocol::TxStatusRequest *request,
-        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
-      rxcpp::schedulers::run_loop rl;
-
-      auto current_thread = rxcpp::synchronize_in_one_worker(
-          rxcpp::schedulers::make_run_loop(rl));
+    namespace {
+      /**
+       * State of a single status stream, which is shared between the
+       * subscriptions to the statuses and to the consensus rounds
+       */
+      struct StatusStreamState {
+        std::mutex mutex;
+        /// the latest status of the transaction
+        std::shared_ptr<shared_model::interface::TransactionResponse>
+            last_response;
+        /// the latest status written to the stream
+        boost::optional<iroha::protocol::TxStatus> last_tx_status;
+        int rounds_counter{0};
+        rxcpp::composite_subscription statuses_subscription;
+        rxcpp::composite_subscription rounds_subscription;
 
-      rxcpp::composite_subscription subscription;
+        void unsubscribe() {
+          statuses_subscription.unsubscribe();
+          rounds_subscription.unsubscribe();
+        }
+      };
+    }  // namespace
 
-      auto hash = shared_model::crypto::Hash::fromHexString(request->tx_hash());
+    void CommandServiceTransportGrpc::statusStream(
+        const iroha::protocol::TxStatusRequest &request,
+        std::shared_ptr<network::ServerStream<iroha::protocol::ToriiResponse>>
+            stream) {
+      auto hash = shared_model::crypto::Hash::fromHexString(request.tx_hash());
 
       auto client_id_format = boost::format("Peer: '%s', %s");
       std::string client_id =
-          (client_id_format % context->peer() % hash.toString()).str();
-      auto status_bus = command_service_->getStatusStream(hash);
-      auto consensus_gate_observable =
-          consensus_gate_objects_
-              // a dummy start_with lets us don't wait for the consensus event
-              // on further combine_latest
-              .start_with(ConsensusGateEvent{});
-
-      boost::optional<iroha::protocol::TxStatus> last_tx_status;
-      auto rounds_counter{0};
-      makeCombineLatestUntilFirstCompleted(
-          status_bus,
-          current_thread,
-          [](auto status, auto) { return status; },
-          consensus_gate_observable)
-          // complete the observable if client is disconnected or too many
-          // rounds have passed without tx status change
-          .take_while([=, &rounds_counter, &last_tx_status](
-                          const auto &response) {
-            const auto &proto_response =
-                std::static_pointer_cast<
-                    shared_model::proto::TransactionResponse>(response)
-                    ->getTransport();
-
-            if (context->IsCancelled()) {
-              log_->debug("client unsubscribed, {}", client_id);
-              return false;
-            }
+          (client_id_format % stream->peer() % hash.toString()).str();
 
-            // increment round counter when the same status arrived again.
-            auto status = proto_response.tx_status();
-            auto status_is_same =
-                last_tx_status and (status == *last_tx_status);
-            if (status_is_same) {
-              ++rounds_counter;
-              if (rounds_counter >= maximum_rounds_without_update_) {
-                // we stop the stream when round counter is greater than
-                // allowed.
-                return false;
-              }
-              // omit the received status, but do not stop the stream
-              return true;
-            }
-            rounds_counter = 0;
-            last_tx_status = status;
+      auto state = std::make_shared<StatusStreamState>();
+      stream->setOnDone([this, state, client_id] {
+        state->unsubscribe();
+        log_->debug("status stream done, {}", client_id);
+      });
+
+      // complete the stream if too many rounds have passed without tx status
+      // change, must be called under the state lock
+      auto process_status = [this, state, stream, client_id] {
+        const auto &proto_response =
+            std::static_pointer_cast<shared_model::proto::TransactionResponse>(
+                state->last_response)
+                ->getTransport();
 
-            // write a new status to the stream
-            if (not response_writer->Write(proto_response)) {
-              log_->error("write to stream has failed to client {}", client_id);
-              return false;
+        // increment round counter when the same status arrived again.
+        auto status = proto_response.tx_status();
+        auto status_is_same =
+            state->last_tx_status and (status == *state->last_tx_status);
+        if (status_is_same) {
+          ++state->rounds_counter;
+          if (state->rounds_counter >= maximum_rounds_without_update_) {
+            // we stop the stream when round counter is greater than allowed.
+            state->unsubscribe();
+            stream->finish(grpc::Status::OK);
+          }
+          // omit the received status, but do not stop the stream
+          return;
+        }
+        state->rounds_counter = 0;
+        state->last_tx_status = status;
+
+        // write a new status to the stream
+        if (not stream->write(proto_response)) {
+          log_->debug("client unsubscribed, {}", client_id);
+          state->unsubscribe();
+          return;
+        }
+        log_->debug("status written, {}", client_id);
+      };
+
+      auto finish = [state, stream] {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->unsubscribe();
+        stream->finish(grpc::Status::OK);
+      };
+
+      // the stream completes when the final status is received. The initial
+      // status may be read from the database, so it is looked up on the
+      // status worker, and only the writes reach the completion queue
+      rxcpp::observable<>::defer([this, hash] {
+        return command_service_->getStatusStream(hash);
+      })
+          .subscribe_on(status_worker_)
+          .subscribe(
+              state->statuses_subscription,
+              [state, process_status](const auto &response) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->last_response = response;
+                process_status();
+              },
+              [this, client_id, finish](std::exception_ptr ep) {
+                log_->error("something bad happened, client_id {}",
+                            client_id);
+                finish();
+              },
+              finish);
+
+      if (not state->statuses_subscription.is_subscribed()) {
+        return;
+      }
+
+      // the same status is sent again on each consensus round, so that the
+      // rounds without status change are counted
+      consensus_gate_objects_.subscribe(
+          state->rounds_subscription,
+          [state, process_status](const auto &) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->last_response) {
+              process_status();
             }
-            log_->debug("status written, {}", client_id);
-            return true;
-          })
-          .subscribe(subscription,
-                     [](const auto &) {},
-                     [&](std::exception_ptr ep) {
-                       log_->error("something bad happened, client_id {}",
-                                   client_id);
-                     },
-                     [&] { log_->debug("stream done, {}", client_id); });
-
-      // run loop while subscription is active or there are pending events in
-      // the queue
-      iroha::schedulers::handleEvents(subscription, rl);
-
-      log_->debug("status stream done, {}", client_id);
-      return grpc::Status::OK;
+          });
+    }
+
+    void CommandServiceTransportGrpc::requestCalls(
+        std::shared_ptr<network::AsyncCallQueue> queue) {
+      network::AsyncServerStream<iroha::protocol::TxStatusRequest,
+                                 iroha::protocol::ToriiResponse>::
+          request(std::move(queue),
+                  [this](auto *context,
+                         auto *request,
+                         auto *writer,
+                         auto *cq,
+                         auto *tag) {
+                    RequestStatusStream(context, request, writer, cq, cq, tag);
+                  },
+                  [this](const auto &request, auto stream) {
+                    statusStream(request, std::move(stream));
+                  },
+                  max_queued_responses_);
     }
   }  // namespace torii
 }  // namespace iroha
@@ -9,15 +9,19 @@
 #include "torii/command_service.hpp"
 
 #include <rxcpp/rx-lite.hpp>
+#include <rxcpp/operators/rx-observe_on.hpp>
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "network/async_grpc_service.hpp"
+#include "network/server_stream.hpp"
 
 namespace iroha {
   namespace torii {
     class StatusBus;
+    class TransactionVerificationStage;
   }
 }  // namespace iroha
 
@@ -31,8 +35,16 @@ namespace shared_model {
 
 namespace iroha {
   namespace torii {
+    /**
+     * Command service. StatusStream is served asynchronously, so that the
+     * number of simultaneous status streams is not limited by the number of
+     * server threads
+     */
     class CommandServiceTransportGrpc
-        : public iroha::protocol::CommandService_v1::Service {
+        : public iroha::protocol::CommandService_v1::
+              WithAsyncMethod_StatusStream<
+                  iroha::protocol::CommandService_v1::Service>,
+          public network::AsyncGrpcService {
      public:
       using TransportFactoryType =
           shared_model::interface::AbstractTransportFactory<
@@ -53,6 +65,13 @@ namespace iroha {
        * @param maximum_rounds_without_update - defines how long tx status
        * stream is kept alive when no new tx statuses appear
        * @param log to print progress
+       * @param verification_threads - number of threads which verify incoming
+       * transactions, 0 to use all the available cores
+       * @param max_queued_responses - maximum number of statuses waiting to
+       * be sent to a status stream client, which is closed when exceeded
+       * @param status_worker - coordination on which the initial status of a
+       * status stream is looked up, so that the completion queue thread is
+       * not blocked by the database
        */
       CommandServiceTransportGrpc(
           std::shared_ptr<CommandService> command_service,
@@ -66,7 +85,11 @@ namespace iroha {
               transaction_batch_factory,
           rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
           int maximum_rounds_without_update,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t verification_threads = 0,
+          size_t max_queued_responses = network::kDefaultMaxQueuedResponses,
+          rxcpp::observe_on_one_worker status_worker =
+              rxcpp::observe_on_event_loop());
 
       /**
        * Torii call via grpc
@@ -104,25 +127,28 @@ namespace iroha {
                           iroha::protocol::ToriiResponse *response) override;
 
       /**
-       * StatusStream call via grpc
-       * @param context - call context
+       * Serve StatusStream call: write statuses of the transaction to the
+       * stream until the final one, or until too many rounds have passed
+       * without a status change. Does not block
        * @param request - TxStatusRequest object which identifies transaction
        * uniquely
-       * @param response_writer - grpc::ServerWriter which can repeatedly send
-       * transaction statuses back to the client
-       * @return status
+       * @param stream - stream which sends transaction statuses back to the
+       * client
        */
-      grpc::Status StatusStream(
-          grpc::ServerContext *context,
-          const iroha::protocol::TxStatusRequest *request,
-          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
-          override;
+      void statusStream(
+          const iroha::protocol::TxStatusRequest &request,
+          std::shared_ptr<network::ServerStream<iroha::protocol::ToriiResponse>>
+              stream);
+
+      void requestCalls(
+          std::shared_ptr<network::AsyncCallQueue> queue) override;
 
      private:
       std::shared_ptr<CommandService> command_service_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
       std::shared_ptr<TransportFactoryType> transaction_factory_;
+      std::shared_ptr<TransactionVerificationStage> verification_stage_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -131,6 +157,8 @@ namespace iroha {
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
+      const size_t max_queued_responses_;
+      rxcpp::observe_on_one_worker status_worker_;
     };
   }  // namespace torii
 }  // namespace iroha
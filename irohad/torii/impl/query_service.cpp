@@ -5,15 +5,15 @@
 
 #include "torii/query_service.hpp"
 
-#include <rxcpp/operators/rx-observe_on.hpp>
-#include <rxcpp/operators/rx-take_while.hpp>
+#include <boost/format.hpp>
 #include "backend/protobuf/query_responses/proto_block_query_response.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "backend/protobuf/util.hpp"
-#include "common/run_loop_handler.hpp"
+#include "common/visitor.hpp"
 #include "cryptography/default_hash_provider.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger.hpp"
+#include "network/impl/async_server_stream.hpp"
 #include "validators/default_validator.hpp"
 
 namespace iroha {
@@ -23,14 +23,16 @@ namespace iroha {
         std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
         std::shared_ptr<QueryFactoryType> query_factory,
         std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        size_t max_queued_responses)
         : query_processor_{std::move(query_processor)},
           query_factory_{std::move(query_factory)},
           blocks_query_factory_{std::move(blocks_query_factory)},
-          log_{std::move(log)} {}
+          log_{std::move(log)},
+          max_queued_responses_{max_queued_responses} {}
 
-    void QueryService::Find(iroha::protocol::Query const &request,
-                            iroha::protocol::QueryResponse &response) {
+    grpc::Status QueryService::Find(iroha::protocol::Query const &request,
+                                    iroha::protocol::QueryResponse &response) {
       shared_model::crypto::Hash hash;
       auto blobPayload = shared_model::proto::makeBlob(request.payload());
       hash = shared_model::crypto::DefaultHashProvider::makeHash(blobPayload);
@@ -39,22 +41,33 @@ namespace iroha {
         // Query was already processed
         response.mutable_error_response()->set_reason(
             iroha::protocol::ErrorResponse::STATELESS_INVALID);
-        return;
+        return grpc::Status::OK;
       }
 
-      query_factory_->build(request).match(
+      return query_factory_->build(request).match(
           [this, &hash, &response](const auto &query) {
-            query_processor_->queryHandle(*query.value) |
-                [&](auto &&iface_response) {
-                  // Send query to iroha
-                  response = static_cast<shared_model::proto::QueryResponse &>(
-                                 *iface_response)
-                                 .getTransport();
-                  // TODO 18.02.2019 lebdron: IR-336 Replace cache
-                  // 0 is used as a dummy value
-                  cache_.addItem(hash, 0);
-                  return iroha::expected::Value<void>{};
-                };
+            return query_processor_->queryHandle(*query.value)
+                .match(
+                    [&](auto &&iface_response) {
+                      // Send query to iroha
+                      response =
+                          static_cast<shared_model::proto::QueryResponse &>(
+                              *iface_response.value)
+                              .getTransport();
+                      // TODO 18.02.2019 lebdron: IR-336 Replace cache
+                      // 0 is used as a dummy value
+                      cache_.addItem(hash, 0);
+                      return grpc::Status::OK;
+                    },
+                    [&](const auto &error) {
+                      // the query is valid, but the peer has no database
+                      // connection for it at the moment
+                      log_->warn("Query {} is not served: {}",
+                                 hash.hex(),
+                                 error.error);
+                      return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                          error.error);
+                    });
           },
           [&hash, &response](auto &&error) {
             response.set_query_hash(hash.hex());
@@ -62,89 +75,100 @@ namespace iroha {
                 iroha::protocol::ErrorResponse::STATELESS_INVALID);
             response.mutable_error_response()->set_message(
                 std::move(error.error.error));
+            return grpc::Status::OK;
           });
     }
 
     grpc::Status QueryService::Find(grpc::ServerContext *context,
                                     const iroha::protocol::Query *request,
                                     iroha::protocol::QueryResponse *response) {
-      Find(*request, *response);
-      return grpc::Status::OK;
+      return Find(*request, *response);
     }
 
-    grpc::Status QueryService::FetchCommits(
-        grpc::ServerContext *context,
-        const iroha::protocol::BlocksQuery *request,
-        grpc::ServerWriter<iroha::protocol::BlockQueryResponse> *writer) {
+    void QueryService::fetchCommits(
+        const iroha::protocol::BlocksQuery &request,
+        std::shared_ptr<
+            network::ServerStream<iroha::protocol::BlockQueryResponse>>
+            stream) {
       log_->debug("Fetching commits");
 
-      rxcpp::schedulers::run_loop run_loop;
-      auto current_thread = rxcpp::synchronize_in_one_worker(
-          rxcpp::schedulers::make_run_loop(run_loop));
-
-      blocks_query_factory_->build(*request).match(
-          [this, context, request, writer, &current_thread, &run_loop](
-              const auto &query) {
+      blocks_query_factory_->build(request).match(
+          [this, &request, &stream](const auto &query) {
             rxcpp::composite_subscription subscription;
             std::string client_id =
-                (boost::format("Peer: '%s'") % context->peer()).str();
+                (boost::format("Peer: '%s'") % stream->peer()).str();
+            stream->setOnDone([this, subscription, client_id] {
+              subscription.unsubscribe();
+              log_->debug("block stream done, {}", client_id);
+            });
             query_processor_->blocksQueryHandle(*query.value)
-                .observe_on(current_thread)
-                .take_while([this, context, request, writer, client_id](
-                                const std::shared_ptr<
-                                    shared_model::interface::BlockQueryResponse>
-                                    response) {
-                  if (context->IsCancelled()) {
-                    log_->debug("Unsubscribed from block stream");
-                    return false;
-                  }
-
-                  log_->debug("{} receives {}",
-                              request->meta().creator_account_id(),
-                              *response);
-
-                  const auto &proto_response =
-                      std::static_pointer_cast<
-                          shared_model::proto::BlockQueryResponse>(response)
-                          ->getTransport();
-
-                  if (not writer->Write(proto_response)) {
-                    log_->error("write to stream has failed to client {}",
-                                client_id);
-                    return false;
-                  }
-
-                  return iroha::visit_in_place(
-                      response->get(),
-                      [](const shared_model::interface::BlockResponse &) {
-                        return true;
-                      },
-                      [](const shared_model::interface::BlockErrorResponse &) {
-                        return false;
-                      });
-                })
                 .subscribe(
                     subscription,
-                    [](const auto &) {},
-                    [&](std::exception_ptr ep) {
+                    [this,
+                     subscription,
+                     stream,
+                     client_id,
+                     creator_id = request.meta().creator_account_id()](
+                        const std::shared_ptr<
+                            shared_model::interface::BlockQueryResponse>
+                            response) {
+                      log_->debug("{} receives {}", creator_id, *response);
+
+                      const auto &proto_response =
+                          std::static_pointer_cast<
+                              shared_model::proto::BlockQueryResponse>(response)
+                              ->getTransport();
+
+                      if (not stream->write(proto_response)) {
+                        log_->debug("Unsubscribed from block stream");
+                        subscription.unsubscribe();
+                        return;
+                      }
+
+                      iroha::visit_in_place(
+                          response->get(),
+                          [](const shared_model::interface::BlockResponse &) {},
+                          [&](const shared_model::interface::BlockErrorResponse
+                                  &) {
+                            subscription.unsubscribe();
+                            stream->finish(grpc::Status::OK);
+                          });
+                    },
+                    [this, stream, client_id](std::exception_ptr ep) {
                       log_->error(
                           "something bad happened during block "
                           "streaming, client_id {}",
                           client_id);
+                      stream->finish(grpc::Status::OK);
                     },
-                    [&] { log_->debug("block stream done, {}", client_id); });
-
-            iroha::schedulers::handleEvents(subscription, run_loop);
+                    [stream] { stream->finish(grpc::Status::OK); });
           },
-          [this, writer](auto &&error) {
+          [this, &stream](auto &&error) {
             log_->debug("Stateless invalid: {}", error.error.error);
             iroha::protocol::BlockQueryResponse response;
             response.mutable_block_error_response()->set_message(
                 std::move(error.error.error));
-            writer->WriteLast(response, grpc::WriteOptions());
+            stream->write(std::move(response));
+            stream->finish(grpc::Status::OK);
           });
+    }
 
-      return grpc::Status::OK;
+    void QueryService::requestCalls(
+        std::shared_ptr<network::AsyncCallQueue> queue) {
+      network::AsyncServerStream<iroha::protocol::BlocksQuery,
+                                 iroha::protocol::BlockQueryResponse>::
+          request(std::move(queue),
+                  [this](auto *context,
+                         auto *request,
+                         auto *writer,
+                         auto *cq,
+                         auto *tag) {
+                    RequestFetchCommits(context, request, writer, cq, cq, tag);
+                  },
+                  [this](const auto &request, auto stream) {
+                    fetchCommits(request, std::move(stream));
+                  },
+                  max_queued_responses_);
     }
 
   }  // namespace torii
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/transaction_verification_stage.hpp"
+
+#include <vector>
+
+#include <tbb/parallel_for.h>
+#include <boost/optional.hpp>
+
+using namespace iroha::torii;
+
+TransactionVerificationStage::TransactionVerificationStage(
+    std::shared_ptr<TransportFactoryType> transaction_factory,
+    size_t concurrency)
+    : transaction_factory_(std::move(transaction_factory)),
+      arena_(concurrency == 0 ? tbb::task_arena::automatic
+                              : static_cast<int>(concurrency)) {}
+
+iroha::expected::Result<shared_model::interface::types::SharedTxsCollectionType,
+                        TransactionVerificationStage::TransportFactoryType::
+                            Error>
+TransactionVerificationStage::verify(const TransactionsType &transactions) {
+  // a single transaction is not worth passing to another thread
+  if (transactions.size() <= 1) {
+    return shared_model::proto::deserializeTransactions(*transaction_factory_,
+                                                        transactions);
+  }
+
+  using BuildResult = decltype(transaction_factory_->build(
+      std::declval<iroha::protocol::Transaction>()));
+  std::vector<boost::optional<BuildResult>> results(transactions.size());
+  arena_.execute([&] {
+    tbb::parallel_for(0, transactions.size(), [&](int i) {
+      results[i] = transaction_factory_->build(transactions[i]);
+    });
+  });
+
+  // results are collected in the order of arrival, so the reported error is
+  // the same as in case of sequential verification
+  shared_model::interface::types::SharedTxsCollectionType tx_collection;
+  tx_collection.reserve(results.size());
+  for (auto &result : results) {
+    if (auto e = iroha::expected::resultToOptionalError(*result)) {
+      return *e;
+    }
+    tx_collection.emplace_back(std::move(*result).assumeValue());
+  }
+  return tx_collection;
+}
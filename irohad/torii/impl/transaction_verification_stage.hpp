@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_TRANSACTION_VERIFICATION_STAGE_HPP
+#define TORII_TRANSACTION_VERIFICATION_STAGE_HPP
+
+#include <memory>
+
+#include <tbb/task_arena.h>
+#include "backend/protobuf/deserialize_repeated_transactions.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Deserializes and statelessly validates incoming transactions, including
+     * verification of their signatures, in parallel on a dedicated pool of
+     * worker threads
+     */
+    class TransactionVerificationStage {
+     public:
+      using TransportFactoryType =
+          shared_model::proto::TransactionFactoryType;
+      using TransactionsType =
+          google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>;
+
+      /**
+       * @param transaction_factory - factory which builds and validates
+       * transactions
+       * @param concurrency - number of threads used for verification, 0 to
+       * use all the available cores
+       */
+      TransactionVerificationStage(
+          std::shared_ptr<TransportFactoryType> transaction_factory,
+          size_t concurrency = 0);
+
+      /**
+       * Build transactions from the transport, verifying them in parallel
+       * @param transactions - transactions in the order of arrival
+       * @return transactions in the same order, or the error of the first
+       * invalid transaction
+       */
+      iroha::expected::Result<
+          shared_model::interface::types::SharedTxsCollectionType,
+          TransportFactoryType::Error>
+      verify(const TransactionsType &transactions);
+
+     private:
+      std::shared_ptr<TransportFactoryType> transaction_factory_;
+      tbb::task_arena arena_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_TRANSACTION_VERIFICATION_STAGE_HPP
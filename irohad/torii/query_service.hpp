@@ -14,8 +14,10 @@
 #include "backend/protobuf/queries/proto_blocks_query.hpp"
 #include "backend/protobuf/queries/proto_query.hpp"
 #include "builders/protobuf/transport_builder.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "logger/logger_fwd.hpp"
+#include "network/async_grpc_service.hpp"
+#include "network/server_stream.hpp"
 #include "torii/processor/query_processor.hpp"
 
 namespace shared_model {
@@ -30,9 +32,13 @@ namespace iroha {
     /**
      * Actual implementation of async QueryService.
      * ToriiServiceHandler::(SomeMethod)Handler calls a corresponding method in
-     * this class.
+     * this class. FetchCommits is served asynchronously, so that block streams
+     * do not occupy server threads.
      */
-    class QueryService : public iroha::protocol::QueryService_v1::Service {
+    class QueryService
+        : public iroha::protocol::QueryService_v1::WithAsyncMethod_FetchCommits<
+              iroha::protocol::QueryService_v1::Service>,
+          public network::AsyncGrpcService {
      public:
       using QueryFactoryType =
           shared_model::interface::AbstractTransportFactory<
@@ -47,7 +53,8 @@ namespace iroha {
           std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
           std::shared_ptr<QueryFactoryType> query_factory,
           std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t max_queued_responses = network::kDefaultMaxQueuedResponses);
 
       QueryService(const QueryService &) = delete;
       QueryService &operator=(const QueryService &) = delete;
@@ -56,19 +63,30 @@ namespace iroha {
        * actual implementation of async Find in QueryService
        * @param request - Query
        * @param response - QueryResponse
+       * @return RESOURCE_EXHAUSTED status if no database connection could be
+       * taken for the query, so that the client may retry it, OK otherwise
        */
-      void Find(iroha::protocol::Query const &request,
-                iroha::protocol::QueryResponse &response);
+      grpc::Status Find(iroha::protocol::Query const &request,
+                        iroha::protocol::QueryResponse &response);
 
       grpc::Status Find(grpc::ServerContext *context,
                         const iroha::protocol::Query *request,
                         iroha::protocol::QueryResponse *response) override;
 
-      grpc::Status FetchCommits(
-          grpc::ServerContext *context,
-          const iroha::protocol::BlocksQuery *request,
-          grpc::ServerWriter<::iroha::protocol::BlockQueryResponse> *writer)
-          override;
+      /**
+       * Serve FetchCommits call: write committed blocks to the stream until
+       * the client disconnects. Does not block
+       * @param request - blocks query
+       * @param stream - stream which sends blocks back to the client
+       */
+      void fetchCommits(
+          const iroha::protocol::BlocksQuery &request,
+          std::shared_ptr<
+              network::ServerStream<iroha::protocol::BlockQueryResponse>>
+              stream);
+
+      void requestCalls(
+          std::shared_ptr<network::AsyncCallQueue> queue) override;
 
      private:
       std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
@@ -76,12 +94,14 @@ namespace iroha {
       std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory_;
 
       // TODO 18.02.2019 lebdron: IR-336 Replace cache
-      iroha::cache::Cache<shared_model::crypto::Hash,
-                          int,
-                          shared_model::crypto::Hash::Hasher>
+      iroha::cache::ShardedCache<shared_model::crypto::Hash,
+                                 int,
+                                 shared_model::crypto::Hash::Hasher>
           cache_;
 
       logger::LoggerPtr log_;
+      /// maximum number of blocks waiting to be sent to a FetchCommits client
+      const size_t max_queued_responses_;
     };
   }  // namespace torii
 }  // namespace iroha
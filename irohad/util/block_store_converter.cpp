@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/segmented_file/segmented_file.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
+#include "common/irohad_version.hpp"
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/iroha_conf_literals.hpp"
+
+/**
+ * Offline converter of a block store with a file per block, as written by
+ * FlatFile, to the segmented layout of SegmentedFile. The daemon must be
+ * stopped while the conversion runs.
+ */
+
+DEFINE_string(flat_file_dir, "", "Folder of the block store to convert");
+DEFINE_string(segmented_dir, "", "Folder for the converted block store");
+DEFINE_string(verbosity, "info", "Log verbosity");
+
+int main(int argc, char **argv) {
+  gflags::SetVersionString(iroha::kGitPrettyVersion);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  logger::LoggerConfig cfg;
+  const auto level = config_members::LogLevels.find(FLAGS_verbosity);
+  if (level != config_members::LogLevels.end()) {
+    cfg.log_level = level->second;
+  }
+  logger::LoggerManagerTreePtr log_manager =
+      std::make_shared<logger::LoggerManagerTree>(std::move(cfg))
+          ->getChild("BlockStoreConverter");
+  logger::LoggerPtr log = log_manager->getLogger();
+
+  if (FLAGS_flat_file_dir.empty() or FLAGS_segmented_dir.empty()) {
+    log->error("Both --flat_file_dir and --segmented_dir must be specified");
+    return EXIT_FAILURE;
+  }
+  if (FLAGS_flat_file_dir == FLAGS_segmented_dir) {
+    log->error("The converted block store must be in a separate folder");
+    return EXIT_FAILURE;
+  }
+
+  auto flat_file = iroha::ametsuchi::FlatFile::create(
+      FLAGS_flat_file_dir, log_manager->getChild("FlatFile")->getLogger());
+  auto segmented_file = iroha::ametsuchi::SegmentedFile::create(
+      FLAGS_segmented_dir,
+      log_manager->getChild("SegmentedFile")->getLogger());
+  if (not flat_file or not segmented_file) {
+    return EXIT_FAILURE;
+  }
+  if ((*segmented_file)->size() != 0) {
+    log->error("Block store in {} is not empty", FLAGS_segmented_dir);
+    return EXIT_FAILURE;
+  }
+
+  shared_model::proto::ProtoBlockJsonConverter converter;
+  for (auto height : (*flat_file)->blockIdentifiers()) {
+    auto json = (*flat_file)->get(height);
+    if (not json) {
+      log->error("Unable to read block {}", height);
+      return EXIT_FAILURE;
+    }
+    auto converted =
+        converter.deserialize(iroha::bytesToString(*json))
+            .match(
+                [&](const auto &block) {
+                  if ((*segmented_file)
+                          ->add(height, block.value->blob().blob())) {
+                    return true;
+                  }
+                  log->error("Unable to write block {}", height);
+                  return false;
+                },
+                [&](const auto &error) {
+                  log->error(
+                      "Unable to parse block {}: {}", height, error.error);
+                  return false;
+                });
+    if (not converted) {
+      return EXIT_FAILURE;
+    }
+  }
+  (*segmented_file)->sync();
+
+  log->info("Converted {} blocks", (*segmented_file)->size());
+  return EXIT_SUCCESS;
+}
@@ -126,6 +126,8 @@ namespace iroha {
       log_->info("transactions in proposal: {}",
                  proposal.transactions().size());
 
+      temporaryWsv.prefetchSignatories(proposal.transactions());
+
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
       auto valid_txs =
           validateTransactions(proposal.transactions(),
@@ -0,0 +1,167 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARDED_CACHE_HPP
+#define IROHA_SHARDED_CACHE_HPP
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace cache {
+
+    /// Default maximum number of items in a ShardedCache
+    constexpr size_t kDefaultCacheCapacity = 20000;
+
+    /**
+     * Bounded concurrent cache. Items are distributed between shards by the
+     * key hash, every shard has its own lock, so that accesses to different
+     * shards do not block each other. Items are stored by the whole key, not
+     * only by its hash. When a shard is full, its oldest inserted item is
+     * evicted.
+     * @tparam KeyType type of key objects
+     * @tparam ValueType type of value objects
+     * @tparam KeyHash hasher for keys
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    class ShardedCache {
+     public:
+      static constexpr size_t kDefaultShards = 16;
+
+      /**
+       * @param capacity - maximum number of items in the cache, rounded up to
+       * a multiple of the number of shards
+       * @param shards - number of independently locked parts of the cache,
+       * rounded up to a power of two
+       */
+      explicit ShardedCache(size_t capacity = kDefaultCacheCapacity,
+                            size_t shards = kDefaultShards)
+          : hits_(0), misses_(0) {
+        size_t shards_count = 1;
+        while (shards_count < shards and shards_count < capacity) {
+          shards_count <<= 1;
+        }
+        mask_ = shards_count - 1;
+        shard_capacity_ = (capacity + shards_count - 1) / shards_count;
+        capacity_ = shard_capacity_ * shards_count;
+        shards_.reserve(shards_count);
+        for (size_t i = 0; i < shards_count; ++i) {
+          shards_.push_back(std::make_unique<Shard>());
+        }
+      }
+
+      ShardedCache(const ShardedCache &) = delete;
+      ShardedCache &operator=(const ShardedCache &) = delete;
+
+      /**
+       * @return maximum number of items in the cache
+       */
+      uint32_t getIndexSizeHigh() const {
+        return static_cast<uint32_t>(capacity_);
+      }
+
+      /**
+       * @return amount of items in cache
+       */
+      uint32_t getCacheItemCount() const {
+        size_t count = 0;
+        for (const auto &shard : shards_) {
+          std::shared_lock<std::shared_timed_mutex> lock(shard->mutex);
+          count += shard->items.size();
+        }
+        return static_cast<uint32_t>(count);
+      }
+
+      /**
+       * Add new item to the cache or update the value of an existing one.
+       * Updated item keeps its position in the eviction order.
+       * @param key - key to insert
+       * @param value - value to insert
+       */
+      void addItem(const KeyType &key, const ValueType &value) {
+        if (capacity_ == 0) {
+          return;
+        }
+        auto &shard = getShard(key);
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        auto it = shard.items.find(key);
+        if (it != shard.items.end()) {
+          it->second = value;
+          return;
+        }
+        if (shard.items.size() >= shard_capacity_) {
+          shard.items.erase(shard.order.front());
+          shard.order.pop_front();
+        }
+        shard.items.emplace(key, value);
+        shard.order.push_back(key);
+      }
+
+      /**
+       * Performs a search for an item with a specific key.
+       * @param key - key to find
+       * @return Optional of ValueType
+       */
+      boost::optional<ValueType> findItem(const KeyType &key) const {
+        auto &shard = getShard(key);
+        std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+        auto it = shard.items.find(key);
+        if (it == shard.items.end()) {
+          misses_.fetch_add(1, std::memory_order_relaxed);
+          return boost::none;
+        }
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+      }
+
+      /**
+       * @return number of findItem calls which found an item
+       */
+      uint64_t getHits() const {
+        return hits_.load(std::memory_order_relaxed);
+      }
+
+      /**
+       * @return number of findItem calls which did not find an item
+       */
+      uint64_t getMisses() const {
+        return misses_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      struct Shard {
+        mutable std::shared_timed_mutex mutex;
+        std::unordered_map<KeyType, ValueType, KeyHash> items;
+        /// keys in the order of insertion, the oldest first
+        std::deque<KeyType> order;
+      };
+
+      Shard &getShard(const KeyType &key) const {
+        auto hash = KeyHash()(key);
+        // low bits are used by the maps inside the shards
+        return *shards_[(hash ^ (hash >> (sizeof(hash) * 4))) & mask_];
+      }
+
+      size_t capacity_;
+      size_t shard_capacity_;
+      size_t mask_;
+      std::vector<std::unique_ptr<Shard>> shards_;
+
+      mutable std::atomic<uint64_t> hits_;
+      mutable std::atomic<uint64_t> misses_;
+    };
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_SHARDED_CACHE_HPP
@@ -5,6 +5,7 @@
 #ifndef IROHA_HEXUTILS_HPP
 #define IROHA_HEXUTILS_HPP
 
+#include <array>
 #include <iterator>
 #include <string>
 
@@ -81,6 +82,58 @@ namespace iroha {
     return iroha::expected::makeValue(std::move(result));
   }
 
+  /**
+   * Get the value of a hex digit
+   * @param c - hex digit in either case
+   * @return - the value, or -1 if c is not a hex digit
+   */
+  inline int hexDigitValue(char c) {
+    if (c >= '0' and c <= '9') {
+      return c - '0';
+    }
+    if (c >= 'a' and c <= 'f') {
+      return c - 'a' + 10;
+    }
+    if (c >= 'A' and c <= 'F') {
+      return c - 'A' + 10;
+    }
+    return -1;
+  }
+
+  /**
+   * Convert printable hex string to raw bytes in the given buffer, so that
+   * no memory is allocated
+   * @param str - hex string to convert
+   * @param buffer - destination of the raw bytes
+   * @return - range of the converted bytes in the buffer, or an error if
+   * provided string was not a correct hex string or does not fit the buffer
+   */
+  template <size_t N>
+  inline iroha::expected::Result<shared_model::interface::types::ByteRange,
+                                 const char *>
+  hexstringToBytes(std::string_view str, std::array<std::byte, N> &buffer) {
+    using namespace iroha::expected;
+    if (str.empty()) {
+      return makeError("Empty hex string.");
+    }
+    if (str.size() % 2 != 0) {
+      return makeError("Hex string contains uneven number of characters.");
+    }
+    const auto size = hexstringToBytestringSize(str);
+    if (size > N) {
+      return makeError("Hex string is too long.");
+    }
+    for (size_t i = 0; i < size; ++i) {
+      const auto high = hexDigitValue(str[2 * i]);
+      const auto low = hexDigitValue(str[2 * i + 1]);
+      if (high < 0 or low < 0) {
+        return makeError("Hex string contains non-hex characters.");
+      }
+      buffer[i] = static_cast<std::byte>((high << 4) | low);
+    }
+    return shared_model::interface::types::ByteRange{buffer.data(), size};
+  }
+
   [[deprecated]] inline boost::optional<std::string> hexstringToBytestring(
       const std::string &str) {
     return iroha::expected::resultToOptionalValue(
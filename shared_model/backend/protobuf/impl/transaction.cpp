@@ -5,16 +5,75 @@
 
 #include "backend/protobuf/transaction.hpp"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/batch_meta.hpp"
 #include "backend/protobuf/commands/proto_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/util.hpp"
+#include "utils/lazy_initializer.hpp"
 #include "utils/reference_holder.hpp"
 
 namespace shared_model {
   namespace proto {
 
+    namespace {
+      /**
+       * Find the serialized embedded message in the serialized parent message
+       * @param message - serialized parent message
+       * @param field_number - number of the embedded message field
+       * @return bytes of the embedded message, or nullopt if the field is
+       * absent or the message is malformed
+       */
+      std::optional<interface::types::ByteRange> findEmbeddedMessage(
+          interface::types::ByteRange message, int field_number) {
+        using google::protobuf::internal::WireFormatLite;
+        google::protobuf::io::CodedInputStream input(
+            reinterpret_cast<const uint8_t *>(message.data()),
+            static_cast<int>(message.size()));
+        while (auto tag = input.ReadTag()) {
+          if (WireFormatLite::GetTagFieldNumber(tag) == field_number
+              and WireFormatLite::GetTagWireType(tag)
+                  == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+            uint32_t length;
+            if (not input.ReadVarint32(&length)) {
+              return std::nullopt;
+            }
+            auto offset = static_cast<size_t>(input.CurrentPosition());
+            if (offset + length > message.size()) {
+              return std::nullopt;
+            }
+            return message.substr(offset, length);
+          }
+          if (not WireFormatLite::SkipField(&input, tag)) {
+            return std::nullopt;
+          }
+        }
+        return std::nullopt;
+      }
+
+      /**
+       * Cut the serialized embedded message out of the serialized parent
+       * instead of serializing it once again
+       */
+      template <typename Message>
+      interface::types::BlobType makeEmbeddedBlob(
+          const interface::types::BlobType &parent,
+          int field_number,
+          const Message &message) {
+        if (auto range = findEmbeddedMessage(parent.range(), field_number)) {
+          return interface::types::BlobType{*range};
+        }
+        return makeBlob(message);
+      }
+    }  // namespace
+
+    /**
+     * Transport is parsed as is, the rest of the fields are computed on the
+     * first access, since most of them are not required for every
+     * transaction of a block or a proposal
+     */
     struct Transaction::Impl {
       explicit Impl(const TransportType &ref) : proto_{ref} {}
 
@@ -30,39 +89,55 @@ namespace shared_model {
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
-
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
-
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
-
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
-
-      std::vector<proto::Command> commands_{
-          reduced_payload_.mutable_commands()->begin(),
-          reduced_payload_.mutable_commands()->end()};
-
-      std::optional<std::shared_ptr<interface::BatchMeta>> meta_{
-          [this]() -> std::optional<std::shared_ptr<interface::BatchMeta>> {
-            if (payload_.has_batch()) {
-              std::shared_ptr<interface::BatchMeta> b =
-                  std::make_shared<proto::BatchMeta>(*payload_.mutable_batch());
-              return b;
-            }
-            return std::nullopt;
-          }()};
-
-      SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }()};
-
-      interface::types::HashType hash_{makeHash(payload_blob_)};
+      detail::LazyInitializer<interface::types::BlobType> blob_{
+          [this] { return makeBlob(*proto_); }};
+
+      detail::LazyInitializer<interface::types::BlobType> payload_blob_{
+          [this] {
+            return makeEmbeddedBlob(
+                *blob_, TransportType::kPayloadFieldNumber, payload_);
+          }};
+
+      detail::LazyInitializer<interface::types::BlobType>
+          reduced_payload_blob_{[this] {
+            return makeEmbeddedBlob(
+                *payload_blob_,
+                TransportType::Payload::kReducedPayloadFieldNumber,
+                reduced_payload_);
+          }};
+
+      detail::LazyInitializer<interface::types::HashType> reduced_hash_{
+          [this] { return makeHash(*reduced_payload_blob_); }};
+
+      detail::LazyInitializer<std::vector<proto::Command>> commands_{[this] {
+        return std::vector<proto::Command>{
+            reduced_payload_.mutable_commands()->begin(),
+            reduced_payload_.mutable_commands()->end()};
+      }};
+
+      using BatchMetaType =
+          std::optional<std::shared_ptr<interface::BatchMeta>>;
+
+      detail::LazyInitializer<BatchMetaType> meta_{[this]() -> BatchMetaType {
+        if (payload_.has_batch()) {
+          std::shared_ptr<interface::BatchMeta> b =
+              std::make_shared<proto::BatchMeta>(*payload_.mutable_batch());
+          return b;
+        }
+        return std::nullopt;
+      }};
+
+      detail::LazyInitializer<SignatureSetType<proto::Signature>> signatures_{
+          [this] {
+            auto signatures = *proto_->mutable_signatures()
+                | boost::adaptors::transformed(
+                                  [](auto &x) { return proto::Signature(x); });
+            return SignatureSetType<proto::Signature>(signatures.begin(),
+                                                      signatures.end());
+          }};
+
+      detail::LazyInitializer<interface::types::HashType> hash_{
+          [this] { return makeHash(*payload_blob_); }};
     };
 
     Transaction::Transaction(const TransportType &transaction) {
@@ -93,39 +168,39 @@ namespace shared_model {
     }
 
     Transaction::CommandsType Transaction::commands() const {
-      return impl_->commands_;
+      return *impl_->commands_;
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return *impl_->payload_blob_;
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return *impl_->reduced_payload_blob_;
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
-      return impl_->signatures_;
+      return *impl_->signatures_;
     }
 
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return *impl_->reduced_hash_;
     }
 
     bool Transaction::addSignature(
         interface::types::SignedHexStringView signed_blob,
         interface::types::PublicKeyHexStringView public_key) {
       // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
+      if (std::find_if(impl_->signatures_->begin(),
+                       impl_->signatures_->end(),
                        [&public_key](const auto &signature) {
                          return signature.publicKey() == public_key;
                        })
-          != impl_->signatures_.end()) {
+          != impl_->signatures_->end()) {
         return false;
       }
 
@@ -135,20 +210,16 @@ namespace shared_model {
       std::string_view const &public_key_string{public_key};
       sig->set_public_key(public_key_string.data(), public_key_string.size());
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
-      impl_->blob_ = makeBlob(*impl_->proto_);
+      // payload is not changed, so only signatures and the whole transaction
+      // have to be rebuilt
+      impl_->signatures_.invalidate();
+      impl_->blob_.invalidate();
 
       return true;
     }
 
     const interface::types::HashType &Transaction::hash() const {
-      return impl_->hash_;
+      return *impl_->hash_;
     }
 
     const Transaction::TransportType &Transaction::getTransport() const {
@@ -165,7 +236,7 @@ namespace shared_model {
 
     std::optional<std::shared_ptr<interface::BatchMeta>>
     Transaction::batchMeta() const {
-      return impl_->meta_;
+      return *impl_->meta_;
     }
 
     std::unique_ptr<interface::Transaction> Transaction::moveTo() {
@@ -5,6 +5,8 @@
 
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
+#include <array>
+
 #include "common/hexutils.hpp"
 #include "common/result.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
@@ -89,21 +91,28 @@ Result<void, const char *> CryptoVerifier::verify(
     SignedHexStringView signature,
     const Blob &source,
     PublicKeyHexStringView public_key) {
-  return iroha::hexstringToBytestringResult(signature) |
-      [&source, &public_key](const auto &signature) {
-        return iroha::hexstringToBytestringResult(public_key) |
-            [&signature, &source](const auto &public_key) {
-              return verifyDefaultOrMultihash(
-                         SignatureByteRangeView{makeByteRange(signature)},
-                         source,
-                         PublicKeyByteRangeView{makeByteRange(public_key)})
-                         | [](const auto &verification_result)
-                         -> Result<void, const char *> {
-                if (not verification_result) {
-                  return "Bad signature.";
-                }
-                return Value<void>{};
-              };
+  std::array<std::byte, kMaxSignatureSize> signature_buffer;
+  std::array<std::byte, kMaxPublicKeySize> public_key_buffer;
+  return iroha::hexstringToBytes(signature, signature_buffer) |
+      [&](ByteRange signature) {
+        return iroha::hexstringToBytes(public_key, public_key_buffer) |
+            [&](ByteRange public_key) {
+              return verify(SignatureByteRangeView{signature},
+                            source,
+                            PublicKeyByteRangeView{public_key});
             };
       };
 }
+
+Result<void, const char *> CryptoVerifier::verify(
+    SignatureByteRangeView signature,
+    const Blob &source,
+    PublicKeyByteRangeView public_key) {
+  return verifyDefaultOrMultihash(signature, source, public_key) |
+      [](bool verification_result) -> Result<void, const char *> {
+    if (not verification_result) {
+      return "Bad signature.";
+    }
+    return Value<void>{};
+  };
+}
@@ -21,7 +21,8 @@ namespace shared_model {
     class CryptoVerifier {
      public:
       /**
-       * Verify signature attached to source data
+       * Verify signature attached to source data. Hex strings are decoded to
+       * stack buffers
        * @param signedData - cryptographic signature
        * @param source - data that was signed
        * @param pubKey - public key of signatory
@@ -33,6 +34,20 @@ namespace shared_model {
           const Blob &source,
           shared_model::interface::types::PublicKeyHexStringView public_key);
 
+      /**
+       * Verify signature attached to source data. Does not allocate memory
+       * apart from what the crypto algorithm needs
+       * @param signature - raw bytes of cryptographic signature
+       * @param source - data that was signed
+       * @param public_key - raw bytes of public key of signatory
+       * @return a result of void if signature is correct or error message
+       * otherwise or if verification could not be completed
+       */
+      static iroha::expected::Result<void, const char *> verify(
+          shared_model::interface::types::SignatureByteRangeView signature,
+          const Blob &source,
+          shared_model::interface::types::PublicKeyByteRangeView public_key);
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
 
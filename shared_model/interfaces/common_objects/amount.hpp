@@ -8,17 +8,26 @@
 
 #include "interfaces/base/model_primitive.hpp"
 
+#include <string_view>
+
+#include <boost/multiprecision/cpp_int.hpp>
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
 
     /**
-     * Representation of fixed point number
+     * Representation of fixed point number: an unsigned 256-bit integer and
+     * the number of its digits after the decimal separator
      */
     class Amount final : public ModelPrimitive<Amount> {
      public:
-      explicit Amount(const std::string &amount);
+      /**
+       * Parse the decimal representation. Amount is invalid if the string is
+       * not a non-negative decimal number or if it does not fit the value
+       * @param amount - digits with an optional decimal separator
+       */
+      explicit Amount(std::string_view amount);
 
       /**
        * Returns a value less than zero if Amount is negative, a value greater
@@ -32,6 +41,12 @@ namespace shared_model {
        */
       types::PrecisionType precision() const;
 
+      /**
+       * Gets the value scaled by 10^precision
+       * @return the integer value, zero for an invalid amount
+       */
+      const boost::multiprecision::uint256_t &value() const;
+
       /**
        * String representation.
        * @return string representation of the asset.
@@ -52,9 +67,9 @@ namespace shared_model {
       std::string toString() const override;
 
      private:
-      struct Impl;
-
-      const std::shared_ptr<const Impl> impl_;
+      boost::multiprecision::uint256_t value_;
+      types::PrecisionType precision_;
+      bool valid_;
     };
   }  // namespace interface
 }  // namespace shared_model
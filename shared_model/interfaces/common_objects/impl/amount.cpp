@@ -5,103 +5,148 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+
 #include "utils/string_builder.hpp"
 
 static const char kDecimalSeparator = '.';
-static const char *kDigits = "0123456789";
-static const char kZero = kDigits[0];
+static const char kZero = '0';
 
 using namespace shared_model::interface;
+using boost::multiprecision::uint256_t;
 
-struct Amount::Impl {
-  Impl(const std::string &amount)
-      : string_repr_("NaN"), precision_(0), multiprecision_repr_(0) {
-    const char *const start = amount.data();
-    const char *const end = start + amount.size();
-
-    const char *first_nonzero_digit_pos = end;
-    const char *dot_pos = end;
-    for (auto *c = start; c < end; ++c) {
-      static const auto is_digit = boost::is_any_of(kDigits);
-      if (*c == kDecimalSeparator and dot_pos == end) {
-        dot_pos = c;
-      } else if (is_digit(*c)) {
-        if (first_nonzero_digit_pos == end and *c != kZero) {
-          first_nonzero_digit_pos = c;
-        }
-      } else {
-        // invalid character
-        return;
-      }
-    }
+namespace {
+  /// number of decimal digits which always fit uint64_t
+  constexpr size_t kChunkDigits = 19;
 
-    if (dot_pos == start or dot_pos == end - 1) {
-      // not allowed to start or end with a dot
-      return;
+  /// powers of ten up to 10^kChunkDigits
+  constexpr auto kPowersOfTen = [] {
+    std::array<uint64_t, kChunkDigits + 1> powers{1};
+    for (size_t i = 1; i < powers.size(); ++i) {
+      powers[i] = powers[i - 1] * 10;
     }
+    return powers;
+  }();
+
+  /// max number of digits in the string representation: all the digits of
+  /// the greatest value or the zeros of the greatest precision
+  constexpr size_t kMaxDigits =
+      std::max<size_t>(std::numeric_limits<uint256_t>::digits10 + 1,
+                       std::numeric_limits<types::PrecisionType>::max() + 1);
 
-    string_repr_.clear();
-    if (dot_pos == end) {
-      if (first_nonzero_digit_pos == end) {
-        string_repr_.push_back(kZero);
-      } else {
-        // we have nonzero digits and no dot. reuse the original string.
-        string_repr_.append(first_nonzero_digit_pos, end);
-        multiprecision_repr_ =
-            boost::multiprecision::uint256_t(first_nonzero_digit_pos);
+  /**
+   * Append the digits to the value, which is built in chunks of uint64_t in
+   * order not to do a 256-bit multiplication per digit
+   * @return false if a non-digit character is met or the value overflows
+   */
+  bool appendDigits(std::string_view digits, uint256_t &value) {
+    static const uint256_t kMaxValue = std::numeric_limits<uint256_t>::max();
+    while (not digits.empty()) {
+      auto chunk_size = std::min(digits.size(), kChunkDigits);
+      uint64_t chunk = 0;
+      for (auto c : digits.substr(0, chunk_size)) {
+        if (c < '0' or c > '9') {
+          return false;
+        }
+        chunk = chunk * 10 + static_cast<uint64_t>(c - kZero);
+      }
+      if (value != 0) {
+        if (value > (kMaxValue - chunk) / kPowersOfTen[chunk_size]) {
+          return false;
+        }
+        value *= kPowersOfTen[chunk_size];
       }
-    } else if (first_nonzero_digit_pos > dot_pos) {
-      // we have a dot preceded by zeroes only. reuse the original string.
-      assert(dot_pos > start and dot_pos < end);
-      string_repr_.append(dot_pos - 1, end);
-      multiprecision_repr_ =
-          boost::multiprecision::uint256_t(first_nonzero_digit_pos);
-    } else {
-      // we have a decimal separator with at least one nonzero digit before it.
-      assert(dot_pos < end);
-      assert(first_nonzero_digit_pos < dot_pos);
-      // build a copy of amount string, starting with nonzero digit and having
-      // no decimal separator
-      string_repr_.append(first_nonzero_digit_pos, end);
-      std::string amount_without_dot;
-      amount_without_dot.append(first_nonzero_digit_pos, dot_pos);
-      amount_without_dot.append(dot_pos + 1, end);
-      multiprecision_repr_ =
-          boost::multiprecision::uint256_t(amount_without_dot);
+      value += chunk;
+      digits.remove_prefix(chunk_size);
     }
-    precision_ = dot_pos == end ? 0 : end - dot_pos - 1;
+    return true;
   }
+}  // namespace
 
-  std::string string_repr_;
-  interface::types::PrecisionType precision_;
-  boost::multiprecision::uint256_t multiprecision_repr_;
-};
+Amount::Amount(std::string_view amount)
+    : value_(0), precision_(0), valid_(false) {
+  const auto dot_pos = amount.find(kDecimalSeparator);
+  if (dot_pos == 0 or dot_pos + 1 == amount.size()) {
+    // not allowed to be empty, or to start or end with a dot
+    return;
+  }
 
-Amount::Amount(const std::string &amount)
-    : impl_(std::make_shared<Impl>(amount)) {}
+  uint256_t value = 0;
+  if (not appendDigits(amount.substr(0, dot_pos), value)) {
+    return;
+  }
+  if (dot_pos != std::string_view::npos) {
+    auto fraction = amount.substr(dot_pos + 1);
+    if (fraction.size() > std::numeric_limits<types::PrecisionType>::max()
+        or not appendDigits(fraction, value)) {
+      return;
+    }
+    precision_ = static_cast<types::PrecisionType>(fraction.size());
+  }
+  value_ = value;
+  valid_ = true;
+}
 
 int Amount::sign() const {
-  return impl_->multiprecision_repr_.sign();
+  return value_.sign();
 }
 
 types::PrecisionType Amount::precision() const {
-  return impl_->precision_;
+  return precision_;
+}
+
+const uint256_t &Amount::value() const {
+  return value_;
 }
 
 std::string Amount::toStringRepr() const {
-  return impl_->string_repr_;
+  if (not valid_) {
+    return "NaN";
+  }
+
+  // digits are written from the end, in chunks which fit uint64_t
+  std::array<char, kMaxDigits> digits;
+  auto *const end = digits.data() + digits.size();
+  auto *begin = end;
+  uint256_t rest = value_;
+  while (rest != 0) {
+    uint256_t quotient, remainder;
+    boost::multiprecision::divide_qr(
+        rest, uint256_t{kPowersOfTen[kChunkDigits]}, quotient, remainder);
+    auto chunk = static_cast<uint64_t>(remainder);
+    rest = std::move(quotient);
+    // inner chunks keep their leading zeros
+    for (size_t i = 0; i < kChunkDigits and (chunk != 0 or rest != 0); ++i) {
+      *--begin = static_cast<char>(kZero + chunk % 10);
+      chunk /= 10;
+    }
+  }
+  // at least one digit before the separator
+  while (end - begin < precision_ + 1) {
+    *--begin = kZero;
+  }
+
+  const size_t integer_digits = end - begin - precision_;
+  std::string result;
+  result.reserve(end - begin + 1);
+  result.append(begin, integer_digits);
+  if (precision_ > 0) {
+    result.push_back(kDecimalSeparator);
+    result.append(begin + integer_digits, precision_);
+  }
+  return result;
 }
 
 bool Amount::operator==(const ModelType &rhs) const {
-  return impl_->precision_ == rhs.impl_->precision_
-      and impl_->multiprecision_repr_ == rhs.impl_->multiprecision_repr_;
+  return valid_ == rhs.valid_ and precision_ == rhs.precision_
+      and value_ == rhs.value_;
 }
 
 std::string Amount::toString() const {
   return detail::PrettyStringBuilder()
       .init("Amount")
-      .append(impl_->string_repr_)
+      .append(toStringRepr())
       .finalize();
 }
@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LAZY_INITIALIZER_HPP
+#define IROHA_LAZY_INITIALIZER_HPP
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+namespace shared_model {
+  namespace detail {
+    /**
+     * Value which is computed by the generator on the first access and cached
+     * afterwards. Concurrent const accesses are safe, the generator is called
+     * only once
+     * @tparam T type of stored value
+     */
+    template <typename T>
+    class LazyInitializer {
+     public:
+      using GeneratorType = std::function<T()>;
+
+      explicit LazyInitializer(GeneratorType generator)
+          : generator_(std::move(generator)) {}
+
+      LazyInitializer(const LazyInitializer &) = delete;
+      LazyInitializer &operator=(const LazyInitializer &) = delete;
+
+      const T &operator*() const {
+        return get();
+      }
+
+      const T *operator->() const {
+        return &get();
+      }
+
+      const T &get() const {
+        if (not initialized_.load(std::memory_order_acquire)) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (not initialized_.load(std::memory_order_relaxed)) {
+            value_.emplace(generator_());
+            initialized_.store(true, std::memory_order_release);
+          }
+        }
+        return *value_;
+      }
+
+      /**
+       * Drop the cached value, so that it is generated again on the next
+       * access
+       * Note: method is not thread-safe
+       */
+      void invalidate() {
+        initialized_.store(false, std::memory_order_relaxed);
+        value_.reset();
+      }
+
+     private:
+      GeneratorType generator_;
+      mutable std::mutex mutex_;
+      mutable std::atomic<bool> initialized_{false};
+      mutable std::optional<T> value_;
+    };
+  }  // namespace detail
+}  // namespace shared_model
+
+#endif  // IROHA_LAZY_INITIALIZER_HPP
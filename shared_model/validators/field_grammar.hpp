@@ -0,0 +1,190 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIELD_GRAMMAR_HPP
+#define IROHA_SHARED_MODEL_FIELD_GRAMMAR_HPP
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Recognizers of the field grammars used by the stateless validation. Each
+ * one is a single pass over the value, which accepts exactly the strings
+ * matched by the regular expression given in its description
+ */
+namespace shared_model::validation::grammar {
+
+  constexpr bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  constexpr bool isLowerAlpha(char c) {
+    return c >= 'a' and c <= 'z';
+  }
+
+  constexpr bool isAlpha(char c) {
+    return isLowerAlpha(c) or (c >= 'A' and c <= 'Z');
+  }
+
+  constexpr bool isAlnum(char c) {
+    return isAlpha(c) or isDigit(c);
+  }
+
+  constexpr bool isHexDigit(char c) {
+    return isDigit(c) or (c >= 'a' and c <= 'f') or (c >= 'A' and c <= 'F');
+  }
+
+  /// [a-z_0-9]
+  constexpr bool isNameChar(char c) {
+    return isLowerAlpha(c) or isDigit(c) or c == '_';
+  }
+
+  /// [A-Za-z0-9_]
+  constexpr bool isDetailKeyChar(char c) {
+    return isAlnum(c) or c == '_';
+  }
+
+  /**
+   * @return true if value consists of [min_size, max_size] characters, each
+   * of which satisfies the predicate
+   */
+  template <typename Predicate>
+  constexpr bool isSequenceOf(std::string_view value,
+                              Predicate predicate,
+                              size_t min_size,
+                              size_t max_size) {
+    if (value.size() < min_size or value.size() > max_size) {
+      return false;
+    }
+    for (auto c : value) {
+      if (not predicate(c)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// [a-z_0-9]{1,32}
+  constexpr bool isName(std::string_view value) {
+    return isSequenceOf(value, isNameChar, 1, 32);
+  }
+
+  /// [A-Za-z0-9_]{1,64}
+  constexpr bool isDetailKey(std::string_view value) {
+    return isSequenceOf(value, isDetailKeyChar, 1, 64);
+  }
+
+  /// [0-9a-fA-F]*
+  constexpr bool isHex(std::string_view value) {
+    return isSequenceOf(value, isHexDigit, 0, value.size());
+  }
+
+  /// ([0-9a-fA-F][0-9a-fA-F])*
+  constexpr bool isHexBytes(std::string_view value) {
+    return value.size() % 2 == 0 and isHex(value);
+  }
+
+  /// [0-9a-fA-F]{40}
+  constexpr bool isEvmAddress(std::string_view value) {
+    return value.size() == 40 and isHex(value);
+  }
+
+  /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+  constexpr bool isDomainLabel(std::string_view label) {
+    if (label.empty() or label.size() > 63 or not isAlpha(label.front())
+        or not isAlnum(label.back())) {
+      return false;
+    }
+    for (auto c : label) {
+      if (not isAlnum(c) and c != '-') {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// (label\.)*label
+  constexpr bool isDomain(std::string_view value) {
+    while (true) {
+      auto dot = value.find('.');
+      if (not isDomainLabel(value.substr(0, dot))) {
+        return false;
+      }
+      if (dot == std::string_view::npos) {
+        return true;
+      }
+      value.remove_prefix(dot + 1);
+    }
+  }
+
+  /**
+   * Decimal number without leading zeros
+   * @return true if value is such a number, which does not exceed max_value
+   */
+  constexpr bool isDecimalNumber(std::string_view value, unsigned max_value) {
+    if (value.empty() or value.size() > 5
+        or (value.size() > 1 and value.front() == '0')) {
+      return false;
+    }
+    unsigned number = 0;
+    for (auto c : value) {
+      if (not isDigit(c)) {
+        return false;
+      }
+      number = number * 10 + static_cast<unsigned>(c - '0');
+    }
+    return number <= max_value;
+  }
+
+  /// ([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5]) repeated 4 times
+  /// with dots in between
+  constexpr bool isIpV4(std::string_view value) {
+    for (int octet = 0; octet < 4; ++octet) {
+      auto dot = value.find('.');
+      if ((octet < 3) == (dot == std::string_view::npos)
+          or not isDecimalNumber(value.substr(0, dot), 255)) {
+        return false;
+      }
+      value.remove_prefix(octet < 3 ? dot + 1 : value.size());
+    }
+    return true;
+  }
+
+  /// (ipv4|domain):port, where port is a number from 0 to 65535
+  constexpr bool isPeerAddress(std::string_view value) {
+    // neither of the host grammars contains a colon
+    auto colon = value.find(':');
+    if (colon == std::string_view::npos) {
+      return false;
+    }
+    auto host = value.substr(0, colon);
+    return (isIpV4(host) or isDomain(host))
+        and isDecimalNumber(value.substr(colon + 1), 65535);
+  }
+
+  /**
+   * name<separator>domain
+   */
+  constexpr bool isQualifiedName(std::string_view value, char separator) {
+    // names do not contain the separator
+    auto position = value.find(separator);
+    return position != std::string_view::npos
+        and isName(value.substr(0, position))
+        and isDomain(value.substr(position + 1));
+  }
+
+  /// [a-z_0-9]{1,32}\@domain
+  constexpr bool isAccountId(std::string_view value) {
+    return isQualifiedName(value, '@');
+  }
+
+  /// [a-z_0-9]{1,32}\#domain
+  constexpr bool isAssetId(std::string_view value) {
+    return isQualifiedName(value, '#');
+  }
+
+}  // namespace shared_model::validation::grammar
+
+#endif  // IROHA_SHARED_MODEL_FIELD_GRAMMAR_HPP
@@ -9,7 +9,6 @@
 #include <string_view>
 
 #include <fmt/core.h>
-#include <boost/algorithm/string_regex.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include "common/bind.hpp"
@@ -26,6 +25,7 @@
 #include "interfaces/queries/query_payload_meta.hpp"
 #include "interfaces/queries/tx_pagination_meta.hpp"
 #include "multihash/multihash.hpp"
+#include "validators/field_grammar.hpp"
 #include "validators/field_validator.hpp"
 #include "validators/validation_error_helpers.hpp"
 
@@ -34,15 +34,27 @@
 using iroha::operator|;
 
 namespace {
-  class RegexValidator {
+  namespace grammar = shared_model::validation::grammar;
+
+  class GrammarValidator {
    public:
-    RegexValidator(
+    using MatcherType = bool (*)(std::string_view);
+
+    /**
+     * @param name - name of the validated field
+     * @param pattern - regular expression describing the grammar for the
+     * error messages
+     * @param matcher - recognizer of the grammar
+     * @param format_description - optional explanation for the error messages
+     */
+    GrammarValidator(
         std::string name,
         std::string pattern,
+        MatcherType matcher,
         std::optional<const char *> format_description = std::nullopt)
         : name_(std::move(name)),
           pattern_(std::move(pattern)),
-          regex_(pattern_),
+          matcher_(matcher),
           format_description_(
               std::move(format_description) | [](std::string description) {
                 return std::string{" "} + std::move(description);
@@ -50,7 +62,7 @@ namespace {
 
     std::optional<shared_model::validation::ValidationError> validate(
         std::string_view value) const {
-      if (not std::regex_match(value.begin(), value.end(), regex_)) {
+      if (not matcher_(value)) {
         return shared_model::validation::ValidationError(
             name_,
             {fmt::format("passed value: '{}' does not match regex '{}'.{}",
@@ -68,54 +80,75 @@ namespace {
    private:
     std::string name_;
     std::string pattern_;
-    std::regex regex_;
+    MatcherType matcher_;
     std::string format_description_;
   };
 
-  const RegexValidator kAccountNameValidator{"AccountName",
-                                             R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kAssetNameValidator{"AssetName", R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kDomainValidator{
+  const GrammarValidator kAccountNameValidator{
+      "AccountName", R"#([a-z_0-9]{1,32})#", grammar::isName};
+  const GrammarValidator kAssetNameValidator{
+      "AssetName", R"#([a-z_0-9]{1,32})#", grammar::isName};
+  const GrammarValidator kDomainValidator{
       "Domain",
       R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
-      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#"};
+      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#",
+      grammar::isDomain};
   static const std::string kIpV4Pattern{
       R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
       R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#"};
   static const std::string kPortPattern{
       R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4}|[1-9]\d{0,3}|0)$)#"};
-  const RegexValidator kPeerAddressValidator{
+  const GrammarValidator kPeerAddressValidator{
       "PeerAddress",
       fmt::format("(({})|({})):{}",
                   kIpV4Pattern,
                   kDomainValidator.getPattern(),
                   kPortPattern),
+      grammar::isPeerAddress,
       "Field should have a valid 'host:port' format where host is "
       "IPv4 or a hostname following RFC1035, RFC1123 specifications"};
-  const RegexValidator kAccountIdValidator{"AccountId",
-                                           kAccountNameValidator.getPattern()
-                                               + R"#(\@)#"
-                                               + kDomainValidator.getPattern()};
-  const RegexValidator kAssetIdValidator{"AssetId",
-                                         kAssetNameValidator.getPattern()
-                                             + R"#(\#)#"
-                                             + kDomainValidator.getPattern()};
-  const RegexValidator kAccountDetailKeyValidator{"DetailKey",
-                                                  R"([A-Za-z0-9_]{1,64})"};
-  const RegexValidator kRoleIdValidator{"RoleId", R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kHexValidator{
-      "Hex", R"#(([0-9a-fA-F][0-9a-fA-F])*)#", "Hex encoded string expected"};
-  const RegexValidator kPublicKeyHexValidator{
+  const GrammarValidator kAccountIdValidator{
+      "AccountId",
+      kAccountNameValidator.getPattern() + R"#(\@)#"
+          + kDomainValidator.getPattern(),
+      grammar::isAccountId};
+  const GrammarValidator kAssetIdValidator{
+      "AssetId",
+      kAssetNameValidator.getPattern() + R"#(\#)#"
+          + kDomainValidator.getPattern(),
+      grammar::isAssetId};
+  const GrammarValidator kAccountDetailKeyValidator{
+      "DetailKey", R"([A-Za-z0-9_]{1,64})", grammar::isDetailKey};
+  const GrammarValidator kRoleIdValidator{
+      "RoleId", R"#([a-z_0-9]{1,32})#", grammar::isName};
+  const GrammarValidator kHexValidator{"Hex",
+                                       R"#(([0-9a-fA-F][0-9a-fA-F])*)#",
+                                       grammar::isHexBytes,
+                                       "Hex encoded string expected"};
+
+  constexpr size_t kMaxPublicKeyHexSize =
+      shared_model::crypto::CryptoVerifier::kMaxPublicKeySize * 2;
+  constexpr size_t kMaxSignatureHexSize =
+      shared_model::crypto::CryptoVerifier::kMaxSignatureSize * 2;
+
+  const GrammarValidator kPublicKeyHexValidator{
       "PublicKeyHex",
-      fmt::format("[A-Fa-f0-9]{{1,{}}}",
-                  shared_model::crypto::CryptoVerifier::kMaxPublicKeySize * 2)};
-  const RegexValidator kSignatureHexValidator{
+      fmt::format("[A-Fa-f0-9]{{1,{}}}", kMaxPublicKeyHexSize),
+      [](std::string_view value) {
+        return grammar::isSequenceOf(
+            value, grammar::isHexDigit, 1, kMaxPublicKeyHexSize);
+      }};
+  const GrammarValidator kSignatureHexValidator{
       "SignatureHex",
-      fmt::format("[A-Fa-f0-9]{{1,{}}}",
-                  shared_model::crypto::CryptoVerifier::kMaxSignatureSize * 2)};
-  const RegexValidator kEvmAddressValidator{
+      fmt::format("[A-Fa-f0-9]{{1,{}}}", kMaxSignatureHexSize),
+      [](std::string_view value) {
+        return grammar::isSequenceOf(
+            value, grammar::isHexDigit, 1, kMaxSignatureHexSize);
+      }};
+  const GrammarValidator kEvmAddressValidator{
       "EvmHexAddress",
       R"#([0-9a-fA-F]{40})#",
+      grammar::isEvmAddress,
       "Hex encoded 20-byte address expected"};
 }  // namespace
 
@@ -6,8 +6,6 @@
 #ifndef IROHA_SHARED_MODEL_FIELD_VALIDATOR_HPP
 #define IROHA_SHARED_MODEL_FIELD_VALIDATOR_HPP
 
-#include <regex>
-
 #include "cryptography/default_hash_provider.hpp"
 #include "datetime/time.hpp"
 #include "interfaces/base/signable.hpp"
@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_burrow_storage.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+
+using iroha::ametsuchi::PostgresBurrowStorage;
+using iroha::integration_framework::TestDbManager;
+
+namespace {
+  const std::string kTxHash{"erc20 transfers"};
+  const std::string kTokenAddress{"c0ffee0000000000000000000000000000c0ffee"};
+  // keccak256("Transfer(address,address,uint256)")
+  const std::string kTransferTopic{
+      "ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef"};
+  constexpr size_t kHolders = 100;
+
+  /// 32-byte EVM word in hex
+  std::string word(uint64_t value) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(64) << value;
+    return ss.str();
+  }
+}  // namespace
+
+/**
+ * Each iteration is a single engine call of an ERC-20 contract, which does the
+ * given number of transfers between its holders. Every transfer reads and
+ * writes the balance slots of both holders and emits a Transfer log, as the
+ * contract bytecode does, so the benchmark measures the storage round trips of
+ * such a call, including the final flush. The call is rolled back afterwards
+ */
+static void BM_Erc20TransferLoop(benchmark::State &state) {
+  auto db_manager = TestDbManager::createWithRandomDbName(
+                        1, getTestLoggerManager()->getChild("TestDbManager"))
+                        .assumeValue();
+  auto sql = db_manager->getSession();
+
+  std::vector<std::string> holders;
+  std::vector<std::string> balance_slots;
+  {
+    PostgresBurrowStorage storage(*sql, kTxHash, 0);
+    for (size_t i = 0; i < kHolders; ++i) {
+      holders.push_back(word(i + 1));
+      // balances mapping is at slot 0, the slot key of a holder is derived
+      // from it with keccak256 in the contract
+      balance_slots.push_back(word((i + 1) << 32));
+      storage.setStorage(kTokenAddress, balance_slots.back(), word(1000000));
+    }
+    if (auto error =
+            iroha::expected::resultToOptionalError(storage.flush())) {
+      state.SkipWithError(error->c_str());
+      return;
+    }
+  }
+
+  const auto transfers = static_cast<size_t>(state.range(0));
+  while (state.KeepRunning()) {
+    soci::transaction tx(*sql);
+    PostgresBurrowStorage storage(*sql, kTxHash, 0);
+    for (size_t i = 0; i < transfers; ++i) {
+      auto from = i % kHolders;
+      auto to = (i * 7 + 1) % kHolders;
+      storage.getStorage(kTokenAddress, balance_slots[from]).assumeValue();
+      storage.getStorage(kTokenAddress, balance_slots[to]).assumeValue();
+      storage.setStorage(kTokenAddress, balance_slots[from], word(999999 - i));
+      storage.setStorage(kTokenAddress, balance_slots[to], word(1000001 + i));
+      storage.storeLog(
+          kTokenAddress, word(1), {kTransferTopic, holders[from], holders[to]});
+    }
+    if (auto error =
+            iroha::expected::resultToOptionalError(storage.flush())) {
+      state.SkipWithError(error->c_str());
+      break;
+    }
+    tx.rollback();
+  }
+  state.SetItemsProcessed(state.iterations() * transfers);
+}
+BENCHMARK(BM_Erc20TransferLoop)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -85,6 +85,31 @@ class ProposalBenchmark : public benchmark::Fixture {
   }
 };
 
+class TransactionBenchmark : public benchmark::Fixture {
+ public:
+  /// serialized transactions of a block
+  std::vector<std::string> serialized_txs;
+
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    serialized_txs.clear();
+    for (int i = 0; i < number_of_txs; i++) {
+      serialized_txs.push_back(
+          base_tx.createdTime(iroha::time::now() + i)
+              .build()
+              .getTransport()
+              .SerializeAsString());
+    }
+  }
+};
+
 /**
  * calls getters of a given object (block or proposal),
  * so that lazy fields are initialized.
@@ -212,6 +237,23 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, MoveTest)(benchmark::State &st) {
   }
 }
 
+/**
+ * Benchmark parsing of transactions followed by calculation of their hashes,
+ * which is what happens to every transaction of a received block
+ */
+BENCHMARK_DEFINE_F(TransactionBenchmark, ParseToHashTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    for (const auto &serialized : serialized_txs) {
+      iroha::protocol::Transaction proto_tx;
+      proto_tx.ParseFromString(serialized);
+      shared_model::proto::Transaction tx(std::move(proto_tx));
+      benchmark::DoNotOptimize(tx.hash());
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * serialized_txs.size());
+}
+
 BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
@@ -219,5 +261,6 @@ BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(TransactionBenchmark, ParseToHashTest);
 
 BENCHMARK_MAIN();
@@ -59,4 +59,74 @@ static void BM_QueryAccount(benchmark::State &state) {
 }
 BENCHMARK(BM_QueryAccount)->Unit(benchmark::kMicrosecond);
 
+/**
+ * This benchmark executes get account transactions query over the blocks,
+ * which contain much more data than the requested transactions, in order to
+ * measure the cost of reading the transactions from the block storage
+ */
+static void BM_QueryAccountTransactions(benchmark::State &state) {
+  constexpr size_t kBlocks = 20;
+  constexpr size_t kFillerCommands = 500;
+  constexpr shared_model::interface::types::TransactionsNumberType kPageSize =
+      10;
+
+  integration_framework::IntegrationTestFramework itf(1);
+  itf.setInitialState(kAdminKeypair);
+  itf.sendTxAwait(
+      createUserWithPerms(
+          kUser,
+          PublicKeyHexStringView{kUserKeypair.publicKey()},
+          kRole,
+          {shared_model::interface::permissions::Role::kGetMyAccTxs})
+          .build()
+          .signAndAddSignature(kAdminKeypair)
+          .finish());
+
+  for (size_t block = 0; block < kBlocks; ++block) {
+    const std::string value(64, 'a');
+    auto filler = TestUnsignedTransactionBuilder()
+                      .creatorAccountId(kAdminId)
+                      .createdTime(iroha::time::now())
+                      .quorum(1)
+                      .setAccountDetail(kAdminId, "key0", value);
+    for (size_t i = 1; i < kFillerCommands; ++i) {
+      filler = filler.setAccountDetail(
+          kAdminId, "key" + std::to_string(i), value);
+    }
+    itf.sendTx(filler.build().signAndAddSignature(kAdminKeypair).finish());
+    itf.sendTxAwait(TestUnsignedTransactionBuilder()
+                        .creatorAccountId(kUserId)
+                        .createdTime(iroha::time::now())
+                        .quorum(1)
+                        .setAccountDetail(kUserId, "key", std::to_string(block))
+                        .build()
+                        .signAndAddSignature(kUserKeypair)
+                        .finish());
+  }
+
+  auto make_query = []() {
+    return TestUnsignedQueryBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId(kUserId)
+        .queryCounter(1)
+        .getAccountTransactions(kUserId, kPageSize)
+        .build()
+        .signAndAddSignature(kUserKeypair)
+        .finish();
+  };
+
+  auto check = [](auto &status) {
+    boost::get<const shared_model::interface::TransactionsPageResponse &>(
+        status.get());
+  };
+
+  itf.sendQuery(make_query(), check);
+
+  while (state.KeepRunning()) {
+    itf.sendQuery(make_query());
+  }
+  itf.done();
+}
+BENCHMARK(BM_QueryAccountTransactions)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
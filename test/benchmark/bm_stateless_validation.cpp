@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Stateless validation checks every field of every incoming transaction
+ * against its grammar. The purpose of this benchmark is to keep track of the
+ * throughput of the field checks alone and of the whole stateless validation
+ * of a transaction with typical commands.
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "datetime/time.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "validators/default_validator.hpp"
+#include "validators/field_validator.hpp"
+
+using shared_model::interface::types::PublicKeyHexStringView;
+
+/// number of command groups in a single transaction
+constexpr int number_of_command_groups = 10;
+
+static void BM_FieldValidation(benchmark::State &state) {
+  shared_model::validation::FieldValidator validator(
+      iroha::test::kTestsValidatorsConfig);
+  const std::string account_id{"long_account_name_42@sub.domain.example"};
+  const std::string asset_id{"coin#sub.domain.example"};
+  const std::string peer_address{"node-17.cluster.example.com:10001"};
+  const std::string detail_key{"Detail_Key_With_Some_Length_42"};
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(validator.validateAccountId(account_id));
+    benchmark::DoNotOptimize(validator.validateAssetId(asset_id));
+    benchmark::DoNotOptimize(validator.validatePeerAddress(peer_address));
+    benchmark::DoNotOptimize(validator.validateAccountDetailKey(detail_key));
+  }
+  state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_FieldValidation);
+
+static void BM_TransactionValidation(benchmark::State &state) {
+  shared_model::validation::DefaultUnsignedTransactionValidator validator(
+      iroha::test::kTestsValidatorsConfig);
+  auto keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  PublicKeyHexStringView public_key{keypair.publicKey()};
+
+  auto builder = TestTransactionBuilder()
+                     .createdTime(iroha::time::now())
+                     .creatorAccountId("admin@sub.domain.example")
+                     .quorum(1);
+  for (int i = 0; i < number_of_command_groups; ++i) {
+    auto name = "user_" + std::to_string(i);
+    auto account_id = name + "@sub.domain.example";
+    builder = builder.createAccount(name, "sub.domain.example", public_key)
+                  .addPeer("node-" + std::to_string(i) + ".example.com:10001",
+                           public_key)
+                  .setAccountDetail(account_id, "detail_key", "value")
+                  .transferAsset("admin@sub.domain.example",
+                                 account_id,
+                                 "coin#sub.domain.example",
+                                 "transfer",
+                                 "1.00");
+  }
+  auto tx = builder.build();
+
+  if (auto error = validator.validate(tx)) {
+    state.SkipWithError(error->toString().c_str());
+    return;
+  }
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(validator.validate(tx));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransactionValidation)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
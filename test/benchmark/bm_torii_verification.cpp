@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Torii deserializes incoming transactions and verifies their signatures
+ * before passing them further, which takes most of the CPU time of the
+ * ingress path.
+ *
+ * The purpose of this benchmark is to keep track of the throughput of the
+ * verification stage depending on the number of threads it uses.
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "endpoint.pb.h"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "torii/impl/transaction_verification_stage.hpp"
+#include "validators/default_validator.hpp"
+#include "validators/protobuf/proto_transaction_validator.hpp"
+
+/// number of transactions in a single list
+constexpr int number_of_txs = 100;
+
+/// number of signatures of a single transaction
+constexpr int number_of_signatures = 3;
+
+class VerificationBenchmark : public benchmark::Fixture {
+ public:
+  using TransactionFactory = shared_model::proto::ProtoTransportFactory<
+      shared_model::interface::Transaction,
+      shared_model::proto::Transaction>;
+
+  iroha::protocol::TxList tx_list;
+  std::shared_ptr<TransactionFactory> transaction_factory;
+
+  void SetUp(benchmark::State &st) override {
+    transaction_factory = std::make_shared<TransactionFactory>(
+        std::make_unique<
+            shared_model::validation::DefaultSignedTransactionValidator>(
+            iroha::test::kTestsValidatorsConfig),
+        std::make_unique<
+            shared_model::validation::ProtoTransactionValidator>());
+
+    auto now = iroha::time::now();
+    tx_list.Clear();
+    for (int i = 0; i < number_of_txs; ++i) {
+      auto tx = shared_model::proto::TransactionBuilder()
+                    .createdTime(now + i)
+                    .creatorAccountId("player@one")
+                    .transferAsset(
+                        "player@one", "player@two", "coin#one", "", "5.00")
+                    .quorum(number_of_signatures)
+                    .build();
+      for (int j = 0; j < number_of_signatures; ++j) {
+        tx.signAndAddSignature(
+            shared_model::crypto::DefaultCryptoAlgorithmType::
+                generateKeypair());
+      }
+      *tx_list.add_transactions() = tx.finish().getTransport();
+    }
+  }
+};
+
+/**
+ * Verify a list of transactions with the number of threads given by the
+ * benchmark argument
+ */
+BENCHMARK_DEFINE_F(VerificationBenchmark, VerifyTxList)
+(benchmark::State &state) {
+  iroha::torii::TransactionVerificationStage stage(transaction_factory,
+                                                   state.range(0));
+
+  while (state.KeepRunning()) {
+    auto transactions = stage.verify(tx_list.transactions());
+    if (iroha::expected::hasError(transactions)) {
+      state.SkipWithError("verification failed");
+      break;
+    }
+    benchmark::DoNotOptimize(transactions);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_txs);
+}
+BENCHMARK_REGISTER_F(VerificationBenchmark, VerifyTxList)
+    ->DenseRange(1, std::max(1u, std::thread::hardware_concurrency()))
+    ->ArgName("threads")
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
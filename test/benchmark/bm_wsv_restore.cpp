@@ -0,0 +1,153 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "ametsuchi/impl/wsv_restorer_impl.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+
+using namespace common_constants;
+using iroha::ametsuchi::BlockStorage;
+using iroha::ametsuchi::PgConnectionInit;
+using iroha::ametsuchi::PostgresOptions;
+using iroha::ametsuchi::StorageImpl;
+using iroha::ametsuchi::WsvRestorerImpl;
+using shared_model::interface::permissions::Role;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace {
+  constexpr size_t kPoolSize = 10;
+
+  shared_model::proto::Transaction makeGenesisTx() {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId(kUserId)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .createRole(kRole, {Role::kAddAssetQty})
+        .createDomain(kDomain, kRole)
+        .createAccount(
+            kUser, kDomain, PublicKeyHexStringView{kUserKeypair.publicKey()})
+        .createAsset(kAssetName, kDomain, 2)
+        .build()
+        .signAndAddSignature(kUserKeypair)
+        .finish();
+  }
+
+  shared_model::proto::Transaction makeAddAssetTx() {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId(kUserId)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .addAssetQuantity(kAssetId, "1.00")
+        .build()
+        .signAndAddSignature(kUserKeypair)
+        .finish();
+  }
+
+  /**
+   * Fill the block storage with the chain of the genesis block and the
+   * blocks adding asset quantity to its account
+   */
+  void makeChain(BlockStorage &block_storage, size_t blocks) {
+    auto prev_hash = shared_model::crypto::Hash(std::string(32, '0'));
+    for (size_t height = 1; height <= blocks; ++height) {
+      auto block = std::make_shared<shared_model::proto::Block>(
+          TestBlockBuilder()
+              .height(height)
+              .prevHash(prev_hash)
+              .createdTime(iroha::time::now())
+              .transactions(std::vector<shared_model::proto::Transaction>{
+                  height == 1 ? makeGenesisTx() : makeAddAssetTx()})
+              .build());
+      prev_hash = block->hash();
+      block_storage.insert(std::move(block));
+    }
+  }
+}  // namespace
+
+/**
+ * Each iteration restores WSV from scratch by replaying the synthetic chain
+ * of the given number of blocks from the in-memory block storage, so the
+ * benchmark measures the throughput of the restoration in blocks per second
+ */
+static void BM_RestoreWsv(benchmark::State &state) {
+  const auto blocks = static_cast<size_t>(state.range(0));
+  auto log_manager = getTestLoggerManager()->getChild("WsvRestore");
+  const auto pg_opt = "dbname=" + integration_framework::getRandomDbName() + " "
+      + integration_framework::getPostgresCredsOrDefault();
+  PostgresOptions options(
+      pg_opt,
+      integration_framework::kDefaultWorkingDatabaseName,
+      log_manager->getChild("PostgresOptions")->getLogger());
+  iroha::ametsuchi::KTimesReconnectionStrategyFactory reconnection_factory(0);
+
+  std::shared_ptr<BlockStorage> block_storage =
+      iroha::ametsuchi::InMemoryBlockStorageFactory{}.create();
+  makeChain(*block_storage, blocks);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto storage =
+        PgConnectionInit::prepareWorkingDatabase(
+            iroha::StartupWsvDataPolicy::kDrop, options)
+        | [&] {
+            return PgConnectionInit::prepareConnectionPool(
+                reconnection_factory,
+                options,
+                kPoolSize,
+                log_manager->getChild("Storage"));
+          }
+        | [&](auto &&pool_wrapper) {
+            return StorageImpl::create(
+                options,
+                std::move(pool_wrapper),
+                std::make_shared<
+                    shared_model::proto::ProtoPermissionToString>(),
+                nullptr,
+                std::make_shared<
+                    shared_model::proto::ProtoQueryResponseFactory>(),
+                std::make_unique<
+                    iroha::ametsuchi::InMemoryBlockStorageFactory>(),
+                block_storage,
+                std::nullopt,
+                log_manager->getChild("Storage"),
+                kPoolSize);
+          };
+    if (auto error = iroha::expected::resultToOptionalError(storage)) {
+      state.SkipWithError(error->c_str());
+      break;
+    }
+    state.ResumeTiming();
+
+    WsvRestorerImpl restorer(log_manager->getChild("Restorer")->getLogger());
+    if (auto error = iroha::expected::resultToOptionalError(
+            restorer.restoreWsv(*storage.assumeValue()))) {
+      state.SkipWithError(error->c_str());
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * blocks);
+  PgConnectionInit::dropWorkingDatabase(options);
+}
+BENCHMARK(BM_RestoreWsv)
+    ->Arg(100000)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -41,7 +41,7 @@ namespace integration_framework {
       iroha::network::proto::BlockRequest request;
       request.set_height(height);
       grpc::ClientContext context;
-      iroha::protocol::Block block;
+      iroha::network::proto::SerializedBlock block;
       auto client = iroha::network::createClient<iroha::network::proto::Loader>(
           dest_address);
 
@@ -89,7 +89,7 @@ namespace integration_framework {
     ::grpc::Status LoaderGrpc::retrieveBlocks(
         ::grpc::ServerContext *context,
         const iroha::network::proto::BlockRequest *request,
-        ::grpc::ServerWriter<iroha::protocol::Block> *writer) {
+        ::grpc::ServerWriter<iroha::network::proto::SerializedBlock> *writer) {
       LoaderBlocksRequest height = request->height();
       auto fake_peer = fake_peer_wptr_.lock();
       BOOST_VERIFY_MSG(fake_peer, "Fake peer is not set!");
@@ -100,9 +100,10 @@ namespace integration_framework {
       }
       auto blocks = behaviour->processLoaderBlocksRequest(height);
       for (auto &block : blocks) {
-        iroha::protocol::Block proto_block;
-        *proto_block.mutable_block_v1() = block->getTransport();
-        writer->Write(proto_block);
+        iroha::network::proto::SerializedBlock serialized_block;
+        serialized_block.set_block_v1(
+            shared_model::crypto::toBinaryString(block->blob()));
+        writer->Write(serialized_block);
       }
       return ::grpc::Status::OK;
     }
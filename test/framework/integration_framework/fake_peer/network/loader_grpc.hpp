@@ -51,7 +51,8 @@ namespace integration_framework {
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
           const iroha::network::proto::BlockRequest *request,
-          ::grpc::ServerWriter<iroha::protocol::Block> *writer) override;
+          ::grpc::ServerWriter<iroha::network::proto::SerializedBlock> *writer)
+          override;
 
       /// Handler of grpc retrieveBlock calls.
       grpc::Status retrieveBlock(
@@ -16,6 +16,12 @@ namespace integration_framework {
           std::make_shared<MstMessage>(from, std::move(new_state)));
     }
 
+    iroha::DataType MstNetworkNotifier::findBatch(
+        const shared_model::interface::types::HashType &) const {
+      // fake peer keeps no state, so it receives the batches in full
+      return nullptr;
+    }
+
     rxcpp::observable<std::shared_ptr<MstMessage>>
     MstNetworkNotifier::getObservable() {
       return mst_subject_.get_observable();
@@ -24,6 +24,9 @@ namespace integration_framework {
           shared_model::interface::types::PublicKeyHexStringView from,
           iroha::MstState &&new_state) override;
 
+      iroha::DataType findBatch(
+          const shared_model::interface::types::HashType &hash) const override;
+
       rxcpp::observable<std::shared_ptr<MstMessage>> getObservable();
 
      private:
@@ -44,6 +44,12 @@ namespace fuzzing {
         return iroha::expected::makeValue(
             clone<shared_model::interface::Block>(TestBlockBuilder().build()));
       }));
+      EXPECT_CALL(*storage_, getSerializedBlock(_))
+          .WillRepeatedly(Invoke([](auto) {
+            return iroha::expected::makeValue(
+                shared_model::crypto::toBinaryString(
+                    TestBlockBuilder().build().blob()));
+          }));
     }
   };
 
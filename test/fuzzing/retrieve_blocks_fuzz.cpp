@@ -18,11 +18,13 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
   iroha::network::proto::BlockRequest request;
   if (protobuf_mutator::libfuzzer::LoadProtoInput(true, data, size, &request)) {
     grpc::ServerContext context;
-    NiceMock<iroha::MockServerWriter<iroha::protocol::Block>> serverWriter;
+    NiceMock<iroha::MockServerWriter<iroha::network::proto::SerializedBlock>>
+        serverWriter;
     fixture.block_loader_service_->retrieveBlocks(
         &context,
         &request,
-        reinterpret_cast<grpc::ServerWriter<iroha::protocol::Block> *>(
+        reinterpret_cast<
+            grpc::ServerWriter<iroha::network::proto::SerializedBlock> *>(
             &serverWriter));
   }
 
@@ -215,6 +215,7 @@ struct GetEngineReceiptsTest : public ExecutorTestBase {
         burrow_storage->storeLog(
             log.address, log.data, {log.topics.begin(), log.topics.end()});
       }
+      burrow_storage->flush();
       prepareVmCallerForCommand(
           tx_hash,
           cmd_idx,
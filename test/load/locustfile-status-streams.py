@@ -0,0 +1,107 @@
+"""
+Opens a transaction status stream per Locust user and keeps it open until the
+final status of the transaction arrives, so that the number of simultaneously
+open streams is equal to the number of users. Spawn 10000 users to check that
+Torii serves 10k concurrent status streams, e.g.:
+
+    locust -f locustfile-status-streams.py --no-web -c 10000 -r 500
+
+Each user sends a transaction and then waits for its final status, the whole
+round trip is reported as 'status_stream'. A stream which breaks before the
+final status is reported as a failure.
+"""
+
+import time
+import random
+
+from locust import Locust, TaskSet, events, task
+
+import grpc.experimental.gevent as grpc_gevent
+grpc_gevent.init_gevent()
+
+import grpc
+from iroha import Iroha, IrohaGrpc
+from iroha import IrohaCrypto as ic
+
+import gevent
+
+
+ADMIN_PRIVATE_KEY = 'f101537e319568c765b2cc89698325604991dca57b9716b58016b253506cab70'
+
+FINAL_STATUSES = {'STATELESS_VALIDATION_FAILED', 'STATEFUL_VALIDATION_FAILED',
+                  'COMMITTED', 'MST_EXPIRED', 'REJECTED'}
+
+# streams which are open at the moment
+OPEN_STREAMS = [0]
+
+
+class IrohaClient(IrohaGrpc):
+    def send_tx_and_wait(self, transaction):
+        """
+        Send a transaction and read its status stream until the final status
+        :param transaction: protobuf Transaction
+        :return: None
+        """
+        start_time = time.time()
+        last_status = None
+        OPEN_STREAMS[0] += 1
+        try:
+            self.send_tx(transaction)
+            for status, _, _ in self.tx_status_stream(transaction):
+                last_status = status
+                if status in FINAL_STATUSES:
+                    break
+        except grpc.RpcError as e:
+            total_time = int((time.time() - start_time) * 1000)
+            events.request_failure.fire(request_type="grpc", name='status_stream', response_time=total_time,
+                                        exception=e)
+            return
+        finally:
+            OPEN_STREAMS[0] -= 1
+
+        total_time = int((time.time() - start_time) * 1000)
+        if last_status in FINAL_STATUSES:
+            events.request_success.fire(request_type="grpc", name='status_stream', response_time=total_time,
+                                        response_length=0)
+        else:
+            events.request_failure.fire(request_type="grpc", name='status_stream', response_time=total_time,
+                                        exception=Exception('stream closed on status {}'.format(last_status)))
+
+
+def open_streams_reporter():
+    while True:
+        print("Open status streams: {}".format(OPEN_STREAMS[0]))
+        gevent.sleep(5)
+
+
+class IrohaLocust(Locust):
+    """
+    This is the abstract Locust class which should be subclassed. It provides an Iroha gRPC client
+    that can be used to make gRPC requests that will be tracked in Locust's statistics.
+    """
+    def __init__(self, *args, **kwargs):
+        super(IrohaLocust, self).__init__(*args, **kwargs)
+        self.client = IrohaClient(self.host)
+
+
+gevent.spawn(open_streams_reporter)
+
+
+class ApiUser(IrohaLocust):
+
+    host = "127.0.0.1:50051"
+    min_wait = 1000
+    max_wait = 1000
+
+    class task_set(TaskSet):
+        @task
+        def send_tx_and_track_status(self):
+            iroha = Iroha('admin@test')
+
+            tx = iroha.transaction([iroha.command(
+                'TransferAsset', src_account_id='admin@test', dest_account_id='test@test', asset_id='coin#test',
+                amount='0.01', description=str(random.random())
+            )])
+
+            ic.sign_transaction(tx, ADMIN_PRIVATE_KEY)
+            self.client.send_tx_and_wait(tx)
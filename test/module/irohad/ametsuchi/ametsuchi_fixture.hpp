@@ -194,6 +194,11 @@ namespace iroha {
 
 #undef PROXY_STORAGE_IMPL_FUNCTION
 
+      /// Make storage behave as if the database had no prepared transactions
+      void disablePreparedBlocks() {
+        storage->prepared_blocks_enabled_ = false;
+      }
+
      protected:
       static std::shared_ptr<soci::session> sql;
 
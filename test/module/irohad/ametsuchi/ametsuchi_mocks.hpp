@@ -104,6 +104,10 @@ namespace iroha {
       MOCK_METHOD1(apply,
                    expected::Result<void, validation::CommandError>(
                        const shared_model::interface::Transaction &));
+      MOCK_METHOD1(
+          prefetchSignatories,
+          void(const shared_model::interface::types::TransactionsCollectionType
+                   &));
       MOCK_METHOD1(
           createSavepoint,
           std::unique_ptr<TemporaryWsv::SavepointWrapper>(const std::string &));
@@ -5,11 +5,15 @@
 
 #include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
 
+#include <atomic>
+
 #include <gtest/gtest.h>
+#include <boost/algorithm/string/replace.hpp>
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
@@ -476,7 +480,7 @@ TEST_F(AmetsuchiTest, TestRestoreWsvFromBlockStorage) {
   EXPECT_FALSE(res);
 
   // recover WSV from block storage and check it is recovered
-  WsvRestorerImpl wsvRestorer;
+  WsvRestorerImpl wsvRestorer(getTestLogger("WsvRestorer"));
   wsvRestorer.restoreWsv(*storage).match([](const auto &) {},
                                          [&](const auto &error) {
                                            FAIL() << "Failed to recover WSV: "
@@ -487,10 +491,82 @@ TEST_F(AmetsuchiTest, TestRestoreWsvFromBlockStorage) {
   EXPECT_TRUE(res);
 }
 
+/**
+ * Block storage, which fails to fetch the block of the given height and
+ * passes all the other calls to the wrapped storage
+ */
+class FailingBlockStorage : public BlockStorage {
+ public:
+  explicit FailingBlockStorage(std::shared_ptr<BlockStorage> storage)
+      : storage_(std::move(storage)) {}
+
+  bool insert(
+      std::shared_ptr<const shared_model::interface::Block> block) override {
+    return storage_->insert(std::move(block));
+  }
+
+  boost::optional<std::unique_ptr<shared_model::interface::Block>> fetch(
+      shared_model::interface::types::HeightType height) const override {
+    if (height == failing_height) {
+      return boost::none;
+    }
+    return storage_->fetch(height);
+  }
+
+  boost::optional<std::string> fetchSerialized(
+      shared_model::interface::types::HeightType height) const override {
+    if (height == failing_height) {
+      return boost::none;
+    }
+    return storage_->fetchSerialized(height);
+  }
+
+  boost::optional<
+      std::vector<std::unique_ptr<shared_model::interface::Transaction>>>
+  fetchTransactions(shared_model::interface::types::HeightType height,
+                    const std::vector<TxLocation> &locations) const override {
+    if (height == failing_height) {
+      return boost::none;
+    }
+    return storage_->fetchTransactions(height, locations);
+  }
+
+  size_t size() const override {
+    return storage_->size();
+  }
+
+  void clear() override {
+    storage_->clear();
+  }
+
+  void forEach(FunctionType function) const override {
+    storage_->forEach(std::move(function));
+  }
+
+  /// height of the block which is not fetched, 0 to fetch all the blocks
+  std::atomic<shared_model::interface::types::HeightType> failing_height{0};
+
+ private:
+  std::shared_ptr<BlockStorage> storage_;
+};
+
 class RestoreWsvTest : public AmetsuchiTest {
  public:
   using BlockPtr = decltype(createBlock({}));
 
+  /**
+   * Reinitialize the storage over the present block storage wrapped to fail
+   * on demand, keeping the WSV data
+   * @return the wrapping block storage
+   */
+  std::shared_ptr<FailingBlockStorage> makeBlockStorageFailing() {
+    destroyWsvStorage();
+    auto failing = std::make_shared<FailingBlockStorage>(block_storage_);
+    block_storage_ = failing;
+    initializeStorage(true);
+    return failing;
+  }
+
   void commitToWsvAndBlockStorage(const std::vector<BlockPtr> &blocks) {
     for (const auto &block : blocks) {
       apply(storage, block);
@@ -518,8 +594,10 @@ class RestoreWsvTest : public AmetsuchiTest {
         << "Failed to rewrite block storage.";
   }
 
-  void restoreWsv() {
-    WsvRestorerImpl wsvRestorer;
+  void restoreWsv(size_t blocks_per_commit =
+                      WsvRestorerImpl::kDefaultBlocksPerCommit) {
+    WsvRestorerImpl wsvRestorer(getTestLogger("WsvRestorer"),
+                                blocks_per_commit);
     wsvRestorer.restoreWsv(*storage).match([](const auto &) {},
                                            [&](const auto &error) {
                                              FAIL() << "Failed to recover WSV: "
@@ -528,7 +606,7 @@ class RestoreWsvTest : public AmetsuchiTest {
   }
 
   void checkRestoreWsvError(const std::string error_substr) {
-    WsvRestorerImpl wsvRestorer;
+    WsvRestorerImpl wsvRestorer(getTestLogger("WsvRestorer"));
     wsvRestorer.restoreWsv(*storage).match(
         [](const auto &) { FAIL() << "Should have failed to recover WSV."; },
         [&](const auto &error) {
@@ -561,6 +639,70 @@ TEST_F(RestoreWsvTest, TestRestoreWsvFromBlockStorageReuseOlderState) {
   validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
 }
 
+/**
+ * @given valid WSV matching genesis block. block store contains genesis block
+ * and three more blocks.
+ * @when WSV is restored from block storage committing a block at a time
+ * @then all the missing blocks are applied to WSV @and WSV is valid
+ */
+TEST_F(RestoreWsvTest, TestRestoreWsvFromBlockStorageInChunks) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  commitToWsvAndBlockStorage({genesis_block});
+
+  auto block2 = createBlock({createAddAsset("5.00")}, 2, genesis_block->hash());
+  auto block3 = createBlock({createAddAsset("5.00")}, 3, block2->hash());
+  auto block4 = createBlock({createAddAsset("5.00")}, 4, block3->hash());
+  commitToBlockStorageOnly({block2, block3, block4});
+
+  restoreWsv(1);
+  shared_model::interface::Amount updated_qty("20.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
+  ASSERT_TRUE(storage->getLedgerState());
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.top_hash,
+            block4->hash());
+}
+
+/**
+ * @given valid WSV matching genesis block. block store contains genesis block
+ * and four more blocks, and fails to fetch the fourth one.
+ * @when WSV is restored committing two blocks at a time @and restored again
+ * after the block storage is fixed
+ * @then the first restore fails leaving WSV at the last committed chunk
+ * @and the second one continues from it giving the same WSV as a restore,
+ * which was not interrupted
+ */
+TEST_F(RestoreWsvTest, TestRestoreWsvResumesFromLastCommittedChunk) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  commitToWsvAndBlockStorage({genesis_block});
+
+  auto block2 = createBlock({createAddAsset("5.00")}, 2, genesis_block->hash());
+  auto block3 = createBlock({createAddAsset("5.00")}, 3, block2->hash());
+  auto block4 = createBlock({createAddAsset("5.00")}, 4, block3->hash());
+  auto block5 = createBlock({createAddAsset("5.00")}, 5, block4->hash());
+  commitToBlockStorageOnly({block2, block3, block4, block5});
+
+  auto block_storage = makeBlockStorageFailing();
+  block_storage->failing_height = 4;
+  WsvRestorerImpl interrupted_restorer(getTestLogger("WsvRestorer"), 2);
+  IROHA_ASSERT_RESULT_ERROR(interrupted_restorer.restoreWsv(*storage));
+
+  shared_model::interface::Amount committed_qty("15.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, committed_qty);
+  ASSERT_TRUE(storage->getLedgerState());
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.height, 3);
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.top_hash,
+            block3->hash());
+
+  block_storage->failing_height = 0;
+  restoreWsv(2);
+  shared_model::interface::Amount updated_qty("25.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, updated_qty);
+  ASSERT_TRUE(storage->getLedgerState());
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.height, 5);
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.top_hash,
+            block5->hash());
+}
+
 /**
  * @given valid WSV matching block storage
  * @when WSV is restored from block storage reusing present data
@@ -662,6 +804,96 @@ TEST_F(RestoreWsvTest, TestRestoreWsvFromIncompatibleSchema) {
               ::testing::HasSubstr("The schema is not compatible."));
 }
 
+class WsvSnapshotTest : public RestoreWsvTest {
+ public:
+  using Chunks = std::vector<std::pair<std::string, std::string>>;
+
+  /// Export WSV snapshot to the chunks
+  iroha::expected::Result<WsvSnapshotInfo, std::string> exportSnapshot(
+      Chunks &chunks) {
+    return PgConnectionInit::prepareConnectionPool(
+               *reconnection_strategy_factory_,
+               *options_,
+               1,
+               getTestLoggerManager()->getChild("WsvSnapshotPool"))
+        | [&chunks](auto &&pool_wrapper) {
+            return PostgresWsvSnapshotExporter(std::move(pool_wrapper),
+                                               getTestLogger("WsvSnapshot"))
+                .exportSnapshot(
+                    [&chunks](const std::string &table, std::string rows) {
+                      chunks.emplace_back(table, std::move(rows));
+                      return true;
+                    });
+          };
+  }
+};
+
+/**
+ * @given WSV after 2 blocks
+ * @when WSV snapshot is exported @and imported into the empty WSV
+ * @then WSV is the same as before the export
+ */
+TEST_F(WsvSnapshotTest, ImportedSnapshotMatchesExportedWsv) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  auto block2 = createBlock({createAddAsset("5.00")}, 2, genesis_block->hash());
+  commitToWsvAndBlockStorage({genesis_block, block2});
+
+  Chunks chunks;
+  auto exported = exportSnapshot(chunks);
+  IROHA_ASSERT_RESULT_VALUE(exported);
+  const auto &info = exported.assumeValue();
+  EXPECT_EQ(info.top_block_info.height, 2);
+  EXPECT_EQ(info.top_block_info.top_hash, block2->hash());
+
+  truncateWsv();
+  {
+    PostgresWsvSnapshotImporter importer(*sql, getTestLogger("WsvSnapshot"));
+    for (const auto &chunk : chunks) {
+      IROHA_ASSERT_RESULT_VALUE(importer.importRows(chunk.first, chunk.second));
+    }
+    IROHA_ASSERT_RESULT_VALUE(importer.finish(info));
+    IROHA_ASSERT_RESULT_VALUE(importer.commit());
+  }
+
+  validateAccountAsset(
+      sql_query, kUserId, kAssetId, shared_model::interface::Amount("10.00"));
+  ASSERT_TRUE(storage->getLedgerState());
+  EXPECT_EQ((*storage->getLedgerState())->top_block_info.top_hash,
+            block2->hash());
+}
+
+/**
+ * @given WSV after 2 blocks
+ * @when WSV snapshot is exported @and imported with altered rows
+ * @then the import fails @and WSV keeps unchanged
+ */
+TEST_F(WsvSnapshotTest, AlteredSnapshotIsRejected) {
+  auto genesis_block = createBlock({getGenesisTx()});
+  auto block2 = createBlock({createAddAsset("5.00")}, 2, genesis_block->hash());
+  commitToWsvAndBlockStorage({genesis_block, block2});
+
+  Chunks chunks;
+  auto exported = exportSnapshot(chunks);
+  IROHA_ASSERT_RESULT_VALUE(exported);
+  const auto &info = exported.assumeValue();
+  for (auto &chunk : chunks) {
+    if (chunk.first == "account_has_asset") {
+      boost::replace_all(chunk.second, "10.00", "99.00");
+    }
+  }
+
+  {
+    PostgresWsvSnapshotImporter importer(*sql, getTestLogger("WsvSnapshot"));
+    for (const auto &chunk : chunks) {
+      IROHA_ASSERT_RESULT_VALUE(importer.importRows(chunk.first, chunk.second));
+    }
+    IROHA_ASSERT_RESULT_ERROR(importer.finish(info));
+  }
+
+  validateAccountAsset(
+      sql_query, kUserId, kAssetId, shared_model::interface::Amount("10.00"));
+}
+
 /**
  * @given created storage
  *        @and a subscribed observer on on_commit() event
@@ -743,9 +975,7 @@ TEST_F(PreparedBlockTest, PrepareBlockNoStateChanged) {
  * @then state of the ledger is changed
  */
 TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
-  auto other_tx = createAddAsset("5.00");
-
-  auto block = createBlock({other_tx}, 2);
+  auto block = createBlock({*initial_tx}, 2, genesis_block->hash());
 
   auto result = temp_wsv->apply(*initial_tx);
   ASSERT_FALSE(framework::expected::err(result));
@@ -768,6 +998,27 @@ TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
   EXPECT_EQ(top_block_info->top_hash, ledger_state->top_block_info.top_hash);
 }
 
+/**
+ * @given Storage with prepared state
+ * @when a block with other transactions is committed as prepared
+ * @then commitPrepared fails @and the block can be applied as usual
+ */
+TEST_F(PreparedBlockTest, CommitPreparedMismatchFails) {
+  auto other_tx = createAddAsset("10.00");
+  auto block = createBlock({other_tx}, 2, genesis_block->hash());
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  EXPECT_TRUE(err(storage->commitPrepared(block)));
+  validateAccountAsset(sql_query, kUserId, kAssetId, base_balance);
+
+  apply(storage, block);
+  shared_model::interface::Amount resultingBalance{"15.00"};
+  validateAccountAsset(sql_query, kUserId, kAssetId, resultingBalance);
+}
+
 /**
  * @given Storage with prepared state
  * @when another block is applied
@@ -834,3 +1085,136 @@ TEST_F(PreparedBlockTest, TemporaryWsvUnlocks) {
   ASSERT_TRUE(val(result));
   storage->prepareBlock(std::move(temp_wsv));
 }
+
+/**
+ * Same as PreparedBlockTest, but for a database without prepared
+ * transactions, where the state of the validated proposal is kept in an open
+ * database transaction
+ */
+class ExecutedBlockTest : public PreparedBlockTest {
+ public:
+  void SetUp() override {
+    PreparedBlockTest::SetUp();
+    disablePreparedBlocks();
+  }
+};
+
+/**
+ * @given Storage with executed state of a proposal
+ * @when the block built from the proposal is committed
+ * @then state of the ledger is changed without applying the block again
+ */
+TEST_F(ExecutedBlockTest, CommitExecutedStateChanged) {
+  auto block = createBlock({*initial_tx}, 2, genesis_block->hash());
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+  validateAccountAsset(sql_query, kUserId, kAssetId, base_balance);
+  ASSERT_TRUE(storage->preparedCommitEnabled());
+
+  auto commited_res = storage->commitPrepared(block);
+  IROHA_ASSERT_RESULT_VALUE(commited_res);
+
+  shared_model::interface::Amount resultingAmount("10.00");
+  validateAccountAsset(sql_query, kUserId, kAssetId, resultingAmount);
+  EXPECT_EQ(std::move(commited_res).assumeValue()->top_block_info.top_hash,
+            block->hash());
+  EXPECT_FALSE(storage->preparedCommitEnabled());
+}
+
+/**
+ * @given Storage with executed state of a proposal
+ * @when a block with other transactions is committed
+ * @then commitPrepared fails @and the block can be applied as usual
+ */
+TEST_F(ExecutedBlockTest, CommitExecutedMismatchFails) {
+  auto other_tx = createAddAsset("10.00");
+  auto block = createBlock({other_tx}, 2, genesis_block->hash());
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  EXPECT_TRUE(err(storage->commitPrepared(block)));
+  EXPECT_FALSE(storage->preparedCommitEnabled());
+
+  apply(storage, block);
+  shared_model::interface::Amount resultingBalance{"15.00"};
+  validateAccountAsset(sql_query, kUserId, kAssetId, resultingBalance);
+}
+
+/**
+ * @given Storage with executed state of a proposal
+ * @when another temporary wsv is created and transaction is applied
+ * @then previous state is dropped and new transaction is applied successfully
+ */
+TEST_F(ExecutedBlockTest, TemporaryWsvUnlocks) {
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  temp_wsv = storage->createTemporaryWsv(command_executor);
+  EXPECT_FALSE(storage->preparedCommitEnabled());
+
+  result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+}
+
+namespace {
+  shared_model::proto::Transaction createAddAsset(
+      const std::string &creator,
+      const shared_model::crypto::Keypair &keypair) {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId(creator)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .addAssetQuantity(kAssetId, "1.00")
+        .build()
+        .signAndAddSignature(keypair)
+        .finish();
+  }
+}  // namespace
+
+/**
+ * @given signatories of the proposal creators are prefetched
+ * @when transactions signed by a signatory and by a foreign key are applied
+ * @then only the transaction signed by the signatory is applied
+ */
+TEST_F(PreparedBlockTest, PrefetchedSignaturesChecked) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(createAddAsset(kUserId, kUserKeypair));
+  txs.push_back(createAddAsset(kUserId, kSameDomainUserKeypair));
+  temp_wsv->prefetchSignatories(txs);
+
+  EXPECT_TRUE(val(temp_wsv->apply(txs.at(0))));
+  EXPECT_TRUE(err(temp_wsv->apply(txs.at(1))));
+}
+
+/**
+ * @given signatories of the proposal creators are prefetched
+ * @when the proposal creates an account and then uses it
+ * @then the transaction of the new account passes signatures validation
+ */
+TEST_F(PreparedBlockTest, AccountCreatedInProposalSignaturesChecked) {
+  const std::string new_user = "third";
+  const std::string new_user_id = new_user + "@" + kDomain;
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId(kUserId)
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createAccount(
+              new_user,
+              kDomain,
+              PublicKeyHexStringView{kSecondDomainUserKeypair.publicKey()})
+          .build()
+          .signAndAddSignature(kUserKeypair)
+          .finish());
+  txs.push_back(createAddAsset(new_user_id, kSecondDomainUserKeypair));
+  temp_wsv->prefetchSignatories(txs);
+
+  EXPECT_TRUE(val(temp_wsv->apply(txs.at(0))));
+  EXPECT_TRUE(val(temp_wsv->apply(txs.at(1))));
+}
@@ -20,6 +20,15 @@ namespace iroha {
           fetch,
           boost::optional<std::unique_ptr<shared_model::interface::Block>>(
               shared_model::interface::types::HeightType));
+      MOCK_CONST_METHOD1(fetchSerialized,
+                         boost::optional<std::string>(
+                             shared_model::interface::types::HeightType));
+      MOCK_CONST_METHOD2(
+          fetchTransactions,
+          boost::optional<std::vector<
+              std::unique_ptr<shared_model::interface::Transaction>>>(
+              shared_model::interface::types::HeightType,
+              const std::vector<TxLocation> &));
       MOCK_CONST_METHOD0(size, size_t(void));
       MOCK_METHOD0(clear, void(void));
       MOCK_CONST_METHOD1(forEach, void(FunctionType));
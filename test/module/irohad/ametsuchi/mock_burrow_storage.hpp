@@ -42,6 +42,7 @@ namespace iroha {
                    std::string_view data,
                    std::vector<std::string_view> topics),
                   (override));
+      MOCK_METHOD((expected::Result<void, std::string>), flush, (), (override));
     };
 
   }  // namespace ametsuchi
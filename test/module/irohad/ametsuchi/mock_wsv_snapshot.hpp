@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MOCK_WSV_SNAPSHOT_HPP
+#define IROHA_MOCK_WSV_SNAPSHOT_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include <gmock/gmock.h>
+
+namespace testing {
+  // iroha::ametsuchi::WsvSnapshotInfo is not default-constructible, so this
+  // provides a default for exportSnapshot mock
+  template <>
+  class DefaultValue<iroha::expected::Result<iroha::ametsuchi::WsvSnapshotInfo,
+                                             std::string>> {
+   public:
+    using ValueType =
+        iroha::expected::Result<iroha::ametsuchi::WsvSnapshotInfo,
+                                std::string>;
+    static bool Exists() {
+      return true;
+    }
+    static ValueType &Get() {
+      static ValueType val("default error value");
+      return val;
+    }
+  };
+}  // namespace testing
+
+namespace iroha {
+  namespace ametsuchi {
+    class MockWsvSnapshotExporter : public WsvSnapshotExporter {
+     public:
+      MOCK_METHOD1(exportSnapshot,
+                   expected::Result<WsvSnapshotInfo, std::string>(
+                       const ChunkConsumer &));
+    };
+
+    class MockWsvSnapshotImporter : public WsvSnapshotImporter {
+     public:
+      MOCK_METHOD2(importRows,
+                   expected::Result<void, std::string>(const std::string &,
+                                                       const std::string &));
+      MOCK_METHOD1(finish,
+                   expected::Result<void, std::string>(
+                       const WsvSnapshotInfo &));
+      MOCK_METHOD0(commit, expected::Result<void, std::string>());
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_MOCK_WSV_SNAPSHOT_HPP
@@ -0,0 +1,201 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/pool_lane.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/pool_wrapper.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+class PoolLaneTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    IROHA_ASSERT_RESULT_VALUE(PgConnectionInit::prepareWorkingDatabase(
+        iroha::StartupWsvDataPolicy::kDrop, options_));
+
+    pool_options_.commit_connections = 2;
+    pool_options_.query_connections = 1;
+    pool_options_.max_waiting_queries = 1;
+    pool_options_.query_wait_timeout = 100ms;
+  }
+
+  void TearDown() override {
+    pool_wrapper_ = nullptr;
+    IROHA_ASSERT_RESULT_VALUE(PgConnectionInit::dropWorkingDatabase(options_));
+  }
+
+  void preparePool() {
+    auto pool = PgConnectionInit::prepareConnectionPool(
+        KTimesReconnectionStrategyFactory{0},
+        options_,
+        pool_options_,
+        getTestLoggerManager()->getChild("Storage"));
+    IROHA_ASSERT_RESULT_VALUE(pool);
+    pool_wrapper_ = std::move(
+        boost::get<iroha::expected::Value<std::shared_ptr<PoolWrapper>>>(pool)
+            .value);
+    ASSERT_TRUE(pool_wrapper_->query_lane_);
+  }
+
+  /// Lease a connection of the query lane or fail the test
+  std::unique_ptr<soci::session> leaseQuery() {
+    auto session = pool_wrapper_->query_lane_->lease();
+    if (auto e = iroha::expected::resultToOptionalError(session)) {
+      ADD_FAILURE() << e.value();
+      return nullptr;
+    }
+    return std::move(session).assumeValue();
+  }
+
+  PoolOptions pool_options_;
+  std::shared_ptr<PoolWrapper> pool_wrapper_;
+  logger::LoggerPtr storage_logger_ = getTestLogger("Storage");
+  std::string dbname_ = integration_framework::getRandomDbName();
+  std::string pgopt_ = "dbname=" + dbname_ + " "
+      + integration_framework::getPostgresCredsOrDefault();
+  PostgresOptions options_{pgopt_, dbname_, storage_logger_};
+};
+
+/**
+ * @given pool options without the validation and query connections
+ * @when the pool is prepared
+ * @then only the commit lane is created
+ */
+TEST_F(PoolLaneTest, ZeroSizedLanesShareCommitConnections) {
+  pool_options_.query_connections = 0;
+  auto pool = PgConnectionInit::prepareConnectionPool(
+      KTimesReconnectionStrategyFactory{0},
+      options_,
+      pool_options_,
+      getTestLoggerManager()->getChild("Storage"));
+  IROHA_ASSERT_RESULT_VALUE(pool);
+  pool_wrapper_ = std::move(
+      boost::get<iroha::expected::Value<std::shared_ptr<PoolWrapper>>>(pool)
+          .value);
+
+  EXPECT_FALSE(pool_wrapper_->validation_lane_);
+  EXPECT_FALSE(pool_wrapper_->query_lane_);
+  ASSERT_EQ(pool_wrapper_->lanes().size(), 1);
+  EXPECT_EQ(pool_wrapper_->lanes().front()->stats().size, 2);
+}
+
+/**
+ * @given query lane with a single connection
+ * @when the connection is leased
+ * @then it works and is accounted as in use until the session is destroyed
+ */
+TEST_F(PoolLaneTest, LeasedConnectionIsInUse) {
+  preparePool();
+  {
+    auto sql = leaseQuery();
+    ASSERT_TRUE(sql);
+    int one = 0;
+    *sql << "SELECT 1", soci::into(one);
+    EXPECT_EQ(one, 1);
+    EXPECT_EQ(pool_wrapper_->query_lane_->stats().in_use, 1);
+  }
+  auto stats = pool_wrapper_->query_lane_->stats();
+  EXPECT_EQ(stats.in_use, 0);
+  EXPECT_EQ(stats.leased, 1);
+  EXPECT_EQ(stats.rejected, 0);
+  EXPECT_EQ(stats.timed_out, 0);
+}
+
+/**
+ * @given query lane with its only connection leased
+ * @when another connection is leased
+ * @then the lease fails after the wait timeout
+ */
+TEST_F(PoolLaneTest, WaitTimesOut) {
+  preparePool();
+  auto sql = leaseQuery();
+  ASSERT_TRUE(sql);
+
+  const auto started = std::chrono::steady_clock::now();
+  IROHA_ASSERT_RESULT_ERROR(pool_wrapper_->query_lane_->lease());
+  EXPECT_GE(std::chrono::steady_clock::now() - started,
+            pool_options_.query_wait_timeout);
+
+  auto stats = pool_wrapper_->query_lane_->stats();
+  EXPECT_EQ(stats.leased, 1);
+  EXPECT_EQ(stats.timed_out, 1);
+  EXPECT_GE(stats.max_wait, pool_options_.query_wait_timeout);
+}
+
+/**
+ * @given query lane with its only connection leased and a caller waiting for
+ * it, which is the most allowed
+ * @when another connection is leased
+ * @then the lease is rejected at once, and the waiting caller gets the
+ * connection when it is returned
+ */
+TEST_F(PoolLaneTest, SaturatedLaneRejects) {
+  pool_options_.query_wait_timeout = 10s;
+  preparePool();
+  auto sql = leaseQuery();
+  ASSERT_TRUE(sql);
+
+  std::thread waiting([this] { EXPECT_TRUE(leaseQuery()); });
+  while (pool_wrapper_->query_lane_->stats().waiting == 0) {
+    std::this_thread::sleep_for(1ms);
+  }
+
+  const auto started = std::chrono::steady_clock::now();
+  IROHA_ASSERT_RESULT_ERROR(pool_wrapper_->query_lane_->lease());
+  EXPECT_LT(std::chrono::steady_clock::now() - started,
+            pool_options_.query_wait_timeout);
+
+  sql.reset();
+  waiting.join();
+
+  auto stats = pool_wrapper_->query_lane_->stats();
+  EXPECT_EQ(stats.waiting, 0);
+  EXPECT_EQ(stats.leased, 2);
+  EXPECT_EQ(stats.rejected, 1);
+  EXPECT_EQ(stats.timed_out, 0);
+}
+
+/**
+ * @given commit lane with its only connection taken directly from the shared
+ * pool, as the block store does
+ * @when a connection of the commit lane is leased
+ * @then the lease waits until the connection is returned, and is accounted
+ */
+TEST_F(PoolLaneTest, CommitLeaseWaitsForDirectSession) {
+  pool_options_.commit_connections = 1;
+  preparePool();
+  auto direct =
+      std::make_unique<soci::session>(*pool_wrapper_->connection_pool_);
+
+  std::thread leasing([this] {
+    auto session = pool_wrapper_->commit_lane_->lease();
+    IROHA_ASSERT_RESULT_VALUE(session);
+  });
+  while (pool_wrapper_->commit_lane_->stats().waiting == 0) {
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(pool_wrapper_->commit_lane_->stats().in_use, 1);
+
+  direct.reset();
+  leasing.join();
+
+  auto stats = pool_wrapper_->commit_lane_->stats();
+  EXPECT_EQ(stats.in_use, 0);
+  EXPECT_EQ(stats.waiting, 0);
+  EXPECT_EQ(stats.leased, 1);
+  EXPECT_EQ(stats.timed_out, 0);
+}
@@ -6,6 +6,7 @@
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 #include "ametsuchi/impl/postgres_block_storage_factory.hpp"
 
+#include "ametsuchi/impl/block_transactions.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
@@ -141,6 +142,69 @@ TEST_F(PostgresBlockStorageTest, FetchExisting) {
   ASSERT_EQ(block.blob(), block_var->blob());
 }
 
+/**
+ * @given initialized block storage, single block with height_ inserted
+ * @when serialized block with height_ is fetched
+ * @then the bytes of the inserted block are returned
+ * @and nothing is returned for the other heights
+ */
+TEST_F(PostgresBlockStorageTest, FetchSerialized) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+
+  ASSERT_TRUE(block_storage_->insert(clone(block)));
+
+  auto bytes = block_storage_->fetchSerialized(block.height());
+  ASSERT_TRUE(bytes);
+  EXPECT_EQ(*bytes, shared_model::crypto::toBinaryString(block.blob()));
+  EXPECT_FALSE(block_storage_->fetchSerialized(height_ + 1));
+}
+
+/**
+ * @given initialized block storage, block with several transactions inserted
+ * @when some of the transactions are fetched by their locations
+ * @then they are returned in the order of the locations, both when only their
+ * bytes are read and when the sizes are unknown and the block is read
+ * @and nothing is returned for the locations beyond the block
+ */
+TEST_F(PostgresBlockStorageTest, FetchTransactions) {
+  std::vector<shared_model::proto::Transaction> txs;
+  for (auto quorum : {1, 2, 3}) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(creator_)
+                      .quorum(quorum)
+                      .build());
+  }
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+  ASSERT_TRUE(block_storage_->insert(clone(block)));
+
+  auto all_locations = findTransactions(block.blob().range());
+  ASSERT_TRUE(all_locations);
+  ASSERT_EQ(all_locations->size(), txs.size());
+  std::vector<BlockStorage::TxLocation> locations{(*all_locations)[2],
+                                                  (*all_locations)[0]};
+
+  auto check = [&](const auto &fetched) {
+    ASSERT_TRUE(fetched);
+    ASSERT_EQ(fetched->size(), 2);
+    EXPECT_EQ(*fetched->at(0), txs[2]);
+    EXPECT_EQ(*fetched->at(1), txs[0]);
+  };
+  check(block_storage_->fetchTransactions(height_, locations));
+  for (auto &location : locations) {
+    location.size = 0;
+  }
+  check(block_storage_->fetchTransactions(height_, locations));
+
+  EXPECT_FALSE(block_storage_->fetchTransactions(
+      height_, {BlockStorage::TxLocation{3, block.blob().size(), 1}}));
+  EXPECT_FALSE(block_storage_->fetchTransactions(
+      height_, {BlockStorage::TxLocation{3, 0, 0}}));
+  EXPECT_FALSE(block_storage_->fetchTransactions(height_ + 1, locations));
+}
+
 /**
  * @given initialized block storage without blocks
  * @when block with height_ is fetched
@@ -204,3 +268,57 @@ TEST_F(PostgresBlockStorageTest, ForEach) {
 
   ASSERT_EQ(2, count);
 }
+
+/**
+ * @given table with hex-encoded blocks created by a previous version
+ * @when the table is created again
+ * @then the blocks are converted to raw bytes, can be fetched, and new blocks
+ * can be appended
+ */
+TEST_F(PostgresBlockStorageTest, MigrateHexBlocks) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+  auto another_block =
+      TestBlockBuilder().height(height_ + 1).transactions(txs).build();
+
+  const std::string table = "legacy_blocks";
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  sql << "CREATE TABLE " << table
+      << "(height bigint PRIMARY KEY, block_data text not null)";
+  auto height = block.height();
+  auto hex = block.blob().hex();
+  sql << "INSERT INTO " << table
+      << " (height, block_data) VALUES (:height, :block_data)",
+      soci::use(height), soci::use(hex);
+
+  IROHA_ASSERT_RESULT_VALUE(
+      PostgresBlockStorageFactory::createTable(sql, table));
+
+  PostgresBlockStorage storage(pool_wrapper_,
+                               block_factory_,
+                               table,
+                               getTestLogger("PostgresBlockStorage"));
+  auto fetched = storage.fetch(height_);
+  ASSERT_TRUE(fetched);
+  ASSERT_EQ(block.blob(), (*fetched)->blob());
+  ASSERT_TRUE(storage.insert(clone(another_block)));
+  ASSERT_EQ(2, storage.size());
+}
+
+/**
+ * @given created block table
+ * @when the storage of its block column is queried
+ * @then the blocks are stored uncompressed, so that the transactions are read
+ * by ranges without decompressing the blocks
+ */
+TEST_F(PostgresBlockStorageTest, BlocksAreStoredUncompressed) {
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  std::string storage;
+  sql << "SELECT CAST(attstorage AS text) FROM pg_attribute "
+         "WHERE attrelid = CAST(:table AS regclass) "
+         "AND attname = 'block_data'",
+      soci::use(test_table_), soci::into(storage);
+  EXPECT_EQ(storage, "e");
+}
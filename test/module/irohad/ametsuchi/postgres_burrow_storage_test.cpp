@@ -101,6 +101,17 @@ class PostgresBurrowStorageTest : public testing::Test {
     EXPECT_THAT(fetchLogs(), UnorderedElementsAreArray(matchers));
   }
 
+  std::optional<std::string> fetchStorage(std::string const &address,
+                                          std::string const &key) {
+    std::optional<std::string> value;
+    *sql_ << "select encode(value, 'hex') from burrow_account_key_value "
+             "where address = decode(:address, 'hex') "
+             "and key = decode(:key, 'hex')",
+        soci::use(address, "address"), soci::use(key, "key"),
+        soci::into(value);
+    return value;
+  }
+
   Result<void, std::string> storeLog(LogData const &log) {
     std::vector<std::string_view> topics_sv;
     std::transform(log.topics.begin(),
@@ -130,6 +141,7 @@ TEST_F(PostgresBurrowStorageTest, Store2LogsWithNoTopics) {
   // when
   IROHA_ASSERT_RESULT_VALUE(storeLog(log1));
   IROHA_ASSERT_RESULT_VALUE(storeLog(log2));
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
 
   // then
   checkEngineCalls();
@@ -148,8 +160,49 @@ TEST_F(PostgresBurrowStorageTest, StoreLogWith3Topics) {
 
   // when
   IROHA_ASSERT_RESULT_VALUE(storeLog(log1));
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
 
   // then
   checkEngineCalls();
   checkLogs({log1});
 }
+
+/**
+ * @given storage slot set in the storage
+ * @when the slot is read before and after flush
+ * @then the buffered value is returned, and it is written to the database
+ * only by flush
+ */
+TEST_F(PostgresBurrowStorageTest, SetStorageIsWrittenOnFlush) {
+  const std::string addr{"00000000000000000000000000000000000000aa"};
+  const std::string key{"01"};
+  const std::string value{"0abc"};
+
+  IROHA_ASSERT_RESULT_VALUE(storage_.setStorage(addr, key, value));
+  EXPECT_EQ(fetchStorage(addr, key), std::nullopt);
+  EXPECT_EQ(storage_.getStorage(addr, key).assumeValue(), value);
+
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
+  EXPECT_EQ(fetchStorage(addr, key), value);
+}
+
+/**
+ * @given storage slot stored in the database
+ * @when the slot is read in another storage, changed in the database and read
+ * again
+ * @then the cached value is returned
+ */
+TEST_F(PostgresBurrowStorageTest, GetStorageIsCached) {
+  const std::string addr{"00000000000000000000000000000000000000AA"};
+  const std::string key{"02"};
+  const std::string value{"0def"};
+
+  IROHA_ASSERT_RESULT_VALUE(storage_.setStorage(addr, key, value));
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
+
+  PostgresBurrowStorage storage{*sql_, kTxHash, kCmdIdx};
+  EXPECT_EQ(storage.getStorage(addr, key).assumeValue(), value);
+  *sql_ << "delete from burrow_account_key_value";
+  EXPECT_EQ(storage.getStorage(addr, key).assumeValue(), value);
+  EXPECT_EQ(storage.getStorage(addr, "03").assumeValue(), std::nullopt);
+}
@@ -1711,6 +1711,27 @@ namespace iroha {
           executeQuery(query), 4);
     }
 
+    /**
+     * @given query executor without pending txs storage, as on a query replica
+     * @when get pending transactions
+     * @then query executor produces a stateful failed error
+     */
+    TEST_F(QueryExecutorTest, GetPendingTxsWithoutPendingTxsStorage) {
+      auto query_executor_result =
+          storage->createQueryExecutor(nullptr, query_response_factory);
+      IROHA_ASSERT_RESULT_VALUE(query_executor_result)
+          << "Failed to create a QueryExecutor.";
+      query_executor_ = std::move(query_executor_result).assumeValue();
+
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getPendingTransactions(100u)
+                       .build();
+
+      checkStatefulError<shared_model::interface::StatefulFailedErrorResponse>(
+          executeQuery(query), 1);
+    }
+
     /**
      * @given initialized storage, root permission
      * @when get account asset transactions
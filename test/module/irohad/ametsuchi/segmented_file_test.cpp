@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_file/segmented_file.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+using Bytes = SegmentedFile::Bytes;
+
+class SegmentedFileTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    fs::remove_all(block_store_path_);
+  }
+
+  std::unique_ptr<SegmentedFile> createStore() {
+    auto store = SegmentedFile::create(
+        block_store_path_, log_, kSegmentSize, kSyncInterval);
+    EXPECT_TRUE(store);
+    return store ? std::move(*store) : nullptr;
+  }
+
+  Bytes record(uint8_t value) const {
+    return Bytes(kRecordSize, value);
+  }
+
+  /// Add records [first, last] to the store
+  void fill(SegmentedFile &store, uint32_t first, uint32_t last) {
+    for (auto id = first; id <= last; ++id) {
+      ASSERT_TRUE(store.add(id, record(id)));
+    }
+  }
+
+  void expectRecord(const SegmentedFile &store, uint32_t id) const {
+    auto stored = store.get(id);
+    ASSERT_TRUE(stored) << "no record " << id;
+    EXPECT_EQ(*stored, record(id));
+  }
+
+  /// @return paths of files in the store with the given extension
+  std::vector<fs::path> files(const std::string &extension) const {
+    std::vector<fs::path> result;
+    for (auto it = fs::directory_iterator{block_store_path_};
+         it != fs::directory_iterator{};
+         ++it) {
+      if (it->path().extension() == extension) {
+        result.push_back(it->path());
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  static constexpr size_t kRecordSize = 1000;
+  // every record has a 12 byte header, so a segment holds 3 records
+  static constexpr size_t kSegmentSize = 2 * (kRecordSize + 12) + 1;
+  static constexpr size_t kSyncInterval = 2;
+
+  const std::string block_store_path_ =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  logger::LoggerPtr log_ = getTestLogger("SegmentedFile");
+};
+
+/**
+ * @given empty storage
+ * @when records are added
+ * @then they are split into segments and can be read back
+ */
+TEST_F(SegmentedFileTest, AddAndGet) {
+  auto store = createStore();
+  fill(*store, 1, 7);
+
+  EXPECT_EQ(files(".seg").size(), 3);
+  EXPECT_EQ(store->first_id(), 1);
+  EXPECT_EQ(store->last_id(), 7);
+  EXPECT_EQ(store->size(), 7);
+  for (uint32_t id = 1; id <= 7; ++id) {
+    expectRecord(*store, id);
+  }
+  EXPECT_FALSE(store->get(0));
+  EXPECT_FALSE(store->get(8));
+}
+
+/**
+ * @given storage with records
+ * @when parts of a record are read
+ * @then only the bytes of the parts are returned
+ * @and parts beyond the end of the record are not returned
+ */
+TEST_F(SegmentedFileTest, GetPart) {
+  auto store = createStore();
+  Bytes bytes(kRecordSize);
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    bytes[i] = static_cast<uint8_t>(i);
+  }
+  fill(*store, 1, 1);
+  ASSERT_TRUE(store->add(2, bytes));
+
+  auto part = store->get(2, 300, 20);
+  ASSERT_TRUE(part);
+  EXPECT_EQ(*part, Bytes(bytes.begin() + 300, bytes.begin() + 320));
+  part = store->get(2, kRecordSize - 1, 1);
+  ASSERT_TRUE(part);
+  EXPECT_EQ(*part, Bytes(1, bytes.back()));
+  EXPECT_FALSE(store->get(2, kRecordSize - 1, 2));
+  EXPECT_FALSE(store->get(2, kRecordSize, 1));
+  EXPECT_FALSE(store->get(3, 0, 1));
+}
+
+/**
+ * @given storage with a record
+ * @when a record which does not directly follow the last one is added
+ * @then the insertion fails
+ */
+TEST_F(SegmentedFileTest, NonSequentialAdd) {
+  auto store = createStore();
+  ASSERT_TRUE(store->add(5, record(5)));
+  EXPECT_FALSE(store->add(5, record(5)));
+  EXPECT_FALSE(store->add(7, record(7)));
+  EXPECT_TRUE(store->add(6, record(6)));
+  EXPECT_EQ(store->first_id(), 5);
+}
+
+/**
+ * @given storage with records
+ * @when the storage is reopened, with index files removed
+ * @then all the records are available and new ones can be added
+ */
+TEST_F(SegmentedFileTest, Reopen) {
+  fill(*createStore(), 1, 5);
+  fs::remove(files(".idx").back());
+
+  auto store = createStore();
+  EXPECT_EQ(store->last_id(), 5);
+  fill(*store, 6, 7);
+  for (uint32_t id = 1; id <= 7; ++id) {
+    expectRecord(*store, id);
+  }
+}
+
+/**
+ * @given storage with records, the last one written partially
+ * @when the storage is reopened
+ * @then the partial record is dropped and can be added again
+ */
+TEST_F(SegmentedFileTest, PartialRecordDropped) {
+  fill(*createStore(), 1, 5);
+  const auto segment = files(".seg").back();
+  fs::resize_file(segment, fs::file_size(segment) - 1);
+
+  auto store = createStore();
+  EXPECT_EQ(store->last_id(), 4);
+  EXPECT_FALSE(store->get(5));
+  ASSERT_TRUE(store->add(5, record(5)));
+  expectRecord(*store, 5);
+}
+
+/**
+ * @given storage with records
+ * @when it is dropped
+ * @then no records are left, and new ones can start from any id
+ */
+TEST_F(SegmentedFileTest, DropAll) {
+  auto store = createStore();
+  fill(*store, 1, 4);
+  store->dropAll();
+
+  EXPECT_EQ(store->size(), 0);
+  EXPECT_EQ(store->last_id(), 0);
+  EXPECT_FALSE(store->get(1));
+  fill(*store, 10, 11);
+  store.reset();
+  EXPECT_EQ(createStore()->first_id(), 10);
+}
@@ -19,6 +19,7 @@ namespace iroha {
         TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
+        TRUNCATE TABLE account_has_detail RESTART IDENTITY CASCADE;
         TRUNCATE TABLE account RESTART IDENTITY CASCADE;
         TRUNCATE TABLE asset RESTART IDENTITY CASCADE;
         TRUNCATE TABLE domain RESTART IDENTITY CASCADE;
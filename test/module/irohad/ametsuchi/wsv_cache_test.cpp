@@ -0,0 +1,176 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+
+class WsvCacheTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<WsvCache> cache_ = std::make_shared<WsvCache>(100);
+  WsvCacheOverlay overlay_{cache_};
+
+  const WsvCacheBalanceKey key_{"alice@test", "coin#test"};
+  const WsvCacheBalanceKey other_key_{"bob@test", "coin#test"};
+};
+
+/**
+ * @given decimal strings
+ * @when they are parsed with precision 2 and formatted back
+ * @then valid strings are scaled and restored with exactly 2 fractional
+ * digits, invalid ones are rejected
+ */
+TEST(WsvCacheBalanceTest, ParseAndFormat) {
+  EXPECT_EQ(parseWsvCacheBalance("1.5", 2), WsvCacheBalance{150});
+  EXPECT_EQ(parseWsvCacheBalance("0", 2), WsvCacheBalance{0});
+  EXPECT_EQ(formatWsvCacheBalance(150, 2), "1.50");
+  EXPECT_EQ(formatWsvCacheBalance(5, 2), "0.05");
+  EXPECT_EQ(formatWsvCacheBalance(5, 0), "5");
+
+  EXPECT_FALSE(parseWsvCacheBalance("1.505", 2));
+  EXPECT_FALSE(parseWsvCacheBalance("-1", 2));
+  EXPECT_FALSE(parseWsvCacheBalance("1.", 2));
+  EXPECT_FALSE(parseWsvCacheBalance(".1", 2));
+  EXPECT_FALSE(parseWsvCacheBalance("1e3", 2));
+}
+
+/**
+ * @given maximal 256-bit value as a decimal string
+ * @when it is parsed with precision 0 and 1
+ * @then it fits without scaling and overflows with scaling
+ */
+TEST(WsvCacheBalanceTest, ParseOverflow) {
+  const auto max = std::numeric_limits<WsvCacheBalance>::max();
+  EXPECT_EQ(parseWsvCacheBalance(max.str(), 0), max);
+  EXPECT_FALSE(parseWsvCacheBalance(max.str(), 1));
+}
+
+/**
+ * @given overlay with a balance changed in memory
+ * @when the transaction is rolled back
+ * @then the change is neither visible in the overlay nor in the shared cache
+ */
+TEST_F(WsvCacheTest, RollbackDiscardsChanges) {
+  overlay_.begin();
+  overlay_.setBalance(key_, 10);
+  EXPECT_TRUE(overlay_.hasDirtyBalances());
+  EXPECT_EQ(overlay_.getBalance(key_), WsvCacheBalance{10});
+
+  overlay_.rollback();
+  EXPECT_FALSE(overlay_.hasDirtyBalances());
+  EXPECT_FALSE(overlay_.getBalance(key_));
+  EXPECT_EQ(cache_->size(), 0);
+}
+
+/**
+ * @given overlay with a balance read before a savepoint
+ * @when the balance is changed after the savepoint and the savepoint is rolled
+ * back
+ * @then the balance read before the savepoint is restored and nothing is dirty
+ */
+TEST_F(WsvCacheTest, RollbackToSavepoint) {
+  overlay_.begin();
+  overlay_.putBalance(key_, 10);
+  overlay_.savepoint("tx");
+  overlay_.setBalance(key_, 5);
+  overlay_.setBalance(other_key_, 5);
+
+  overlay_.rollbackToSavepoint("tx");
+  EXPECT_EQ(overlay_.getBalance(key_), WsvCacheBalance{10});
+  EXPECT_FALSE(overlay_.getBalance(other_key_));
+  EXPECT_FALSE(overlay_.hasDirtyBalances());
+}
+
+/**
+ * @given overlay with dirty balances taken for flush after a savepoint
+ * @when the savepoint is rolled back
+ * @then balances dirty before the savepoint become dirty again, because the
+ * database rolls back the flush as well
+ */
+TEST_F(WsvCacheTest, RollbackToSavepointRestoresDirtiness) {
+  overlay_.begin();
+  overlay_.setBalance(key_, 10);
+  overlay_.savepoint("tx");
+  ASSERT_EQ(overlay_.takeDirtyBalances().size(), 1);
+  EXPECT_FALSE(overlay_.hasDirtyBalances());
+
+  overlay_.rollbackToSavepoint("tx");
+  auto dirty = overlay_.takeDirtyBalances();
+  ASSERT_EQ(dirty.size(), 1);
+  EXPECT_EQ(dirty.front().first, key_);
+  EXPECT_EQ(dirty.front().second, WsvCacheBalance{10});
+}
+
+/**
+ * @given overlay with a balance changed inside a released savepoint
+ * @when the transaction is flushed and published
+ * @then the balance is visible to another overlay sharing the cache
+ */
+TEST_F(WsvCacheTest, PublishAfterRelease) {
+  overlay_.begin();
+  overlay_.savepoint("tx");
+  overlay_.setBalance(key_, 7);
+  overlay_.putAsset("coin#test", WsvCacheAsset{true, 2});
+  overlay_.releaseSavepoint("tx");
+  overlay_.takeDirtyBalances();
+  overlay_.publish();
+
+  WsvCacheOverlay other{cache_};
+  EXPECT_EQ(other.getBalance(key_), WsvCacheBalance{7});
+  ASSERT_TRUE(other.getAsset("coin#test"));
+  EXPECT_EQ(other.getAsset("coin#test")->precision, 2);
+}
+
+/**
+ * @given shared cache with a committed account
+ * @when an overlay invalidates the account and publishes
+ * @then the account is not served by the overlay and is dropped from the
+ * shared cache
+ */
+TEST_F(WsvCacheTest, InvalidateDropsCommittedRow) {
+  overlay_.begin();
+  overlay_.putAccount("alice@test", WsvCacheAccount{false, {}});
+  overlay_.publish();
+  ASSERT_TRUE(overlay_.getAccount("alice@test"));
+
+  overlay_.begin();
+  overlay_.invalidateAccount("alice@test");
+  EXPECT_FALSE(overlay_.getAccount("alice@test"));
+
+  overlay_.publish();
+  EXPECT_FALSE(cache_->getAccount("alice@test"));
+}
+
+/**
+ * @given shared cache limited to 2 rows
+ * @when 3 rows are published
+ * @then the cache is dropped as a whole
+ */
+TEST(WsvCacheLimitTest, DropsWhenFull) {
+  auto cache = std::make_shared<WsvCache>(2);
+  WsvCacheOverlay overlay{cache};
+  overlay.putBalance({"a@test", "coin#test"}, 1);
+  overlay.putBalance({"b@test", "coin#test"}, 1);
+  overlay.publish();
+  EXPECT_EQ(cache->size(), 2);
+
+  overlay.putBalance({"c@test", "coin#test"}, 1);
+  overlay.publish();
+  EXPECT_EQ(cache->size(), 0);
+}
+
+/**
+ * @given overlay without shared cache
+ * @when rows are read
+ * @then only rows of the current transaction are served
+ */
+TEST(WsvCacheDisabledTest, ServesLocalRowsOnly) {
+  WsvCacheOverlay overlay{nullptr};
+  EXPECT_FALSE(overlay.enabled());
+  EXPECT_FALSE(overlay.getAsset("coin#test"));
+  overlay.publish();
+}
@@ -78,6 +78,26 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given a vote which has been verified
+       * @when the vote is verified again, and then its payload is changed
+       * @then the same vote is valid, and the changed one is not
+       */
+      TEST_F(YacCryptoProviderTest, VerifiedVoteIsNotAcceptedWhenChanged) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        hash.block_signature = makeSignature();
+
+        auto vote = crypto_provider->getVote(hash);
+
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+
+        vote.hash.vote_round.reject_round = 2;
+
+        ASSERT_FALSE(crypto_provider->verify({vote}));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -19,6 +19,9 @@ namespace iroha {
     MOCK_METHOD2(onNewState,
                  void(shared_model::interface::types::PublicKeyHexStringView,
                       MstState &&));
+    MOCK_CONST_METHOD1(
+        findBatch,
+        DataType(const shared_model::interface::types::HashType &));
   };
 }  // namespace iroha
 
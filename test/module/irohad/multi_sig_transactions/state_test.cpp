@@ -426,3 +426,27 @@ TEST(StateTest, RemovingTestWhenByTimeHasExpired) {
 
   ASSERT_EQ(2, diff_state.getBatches().size());
 }
+
+/**
+ * @given a state with a batch of two transactions
+ * @when  the batch is searched by the hashes of its transactions
+ * AND  after the batch is erased by the hash of its first transaction
+ * @then the batch is found by any of the hashes @and not found after erasure
+ */
+TEST(StateTest, FindBatchByTransactionHash) {
+  auto state = MstState::empty(mst_state_log_, completer_);
+  auto batch = addSignatures(makeTestBatch(txBuilder(1), txBuilder(2)),
+                             0,
+                             makeSignature("1"_hex_sig, "1"_hex_pubkey));
+  state += batch;
+  const auto first_hash = batch->transactions().at(0)->hash();
+  const auto second_hash = batch->transactions().at(1)->hash();
+
+  ASSERT_TRUE(state.findBatch(first_hash));
+  EXPECT_EQ(*batch, *state.findBatch(first_hash));
+  EXPECT_EQ(*batch, *state.findBatch(second_hash));
+
+  state.eraseByTransactionHash(first_hash);
+  EXPECT_FALSE(state.findBatch(first_hash));
+  EXPECT_FALSE(state.findBatch(second_hash));
+}
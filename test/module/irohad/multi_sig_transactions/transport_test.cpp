@@ -5,6 +5,9 @@
 
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 
+#include <future>
+
+#include <grpcpp/alarm.h>
 #include <gtest/gtest.h>
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
@@ -35,6 +38,7 @@ using ::testing::_;
 using ::testing::A;
 using ::testing::DoAll;
 using ::testing::Invoke;
+using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 using ::testing::SaveArg;
 
@@ -118,6 +122,67 @@ class TransportTest : public ::testing::Test {
   iroha::network::transport::MockMstTransportGrpcStub *stub;
 };
 
+/**
+ * Answers the digest sent with the stub like a server does: the response is
+ * delivered to the completion queue of the call after the delay, or when the
+ * answer is destroyed
+ */
+class DigestAnswer {
+ public:
+  using AnswerType = std::function<grpc::Status(
+      const transport::MstStateDigest &, transport::MstMissing *)>;
+
+  DigestAnswer(transport::MockMstTransportGrpcStub &stub,
+               AnswerType answer,
+               std::chrono::milliseconds delay = {})
+      : answer_(std::move(answer)) {
+    EXPECT_CALL(stub, AsyncGetMissingRaw(_, _, _))
+        .WillOnce(Invoke([this, delay](auto, const auto &digest, auto *cq) {
+          // owned by the call
+          auto reader = new grpc::testing::MockClientAsyncResponseReader<
+              transport::MstMissing>();
+          EXPECT_CALL(*reader, Finish(_, _, _))
+              .WillOnce(Invoke([this, delay, digest, cq](
+                                   auto *missing, auto *status, void *tag) {
+                *status = answer_(digest, missing);
+                alarm_.Set(cq, std::chrono::system_clock::now() + delay, tag);
+              }));
+          return reader;
+        }));
+  }
+
+ private:
+  AnswerType answer_;
+  grpc::Alarm alarm_;
+};
+
+/**
+ * @return answer of the transport itself, which parts of the state it misses
+ */
+DigestAnswer::AnswerType answerOf(MstTransportGrpc &receiver) {
+  return [&receiver](const auto &digest, auto *missing) {
+    ::grpc::ServerContext context;
+    return receiver.GetMissing(&context, &digest, missing);
+  };
+}
+
+/**
+ * Make the transactions look new to the presence cache
+ */
+void expectTxsMissing(iroha::ametsuchi::MockTxPresenceCache &cache) {
+  EXPECT_CALL(cache,
+              check(A<const shared_model::interface::TransactionBatch &>()))
+      .WillRepeatedly(Invoke([](const auto &batch) {
+        iroha::ametsuchi::TxPresenceCache::BatchStatusCollectionType result;
+        for (const auto &tx : batch.transactions()) {
+          result.push_back(
+              iroha::ametsuchi::tx_cache_status_responses::Missing{
+                  tx->hash()});
+        }
+        return result;
+      }));
+}
+
 static bool statesEqual(const iroha::MstState &a, const iroha::MstState &b) {
   // treat them like sets of batches:
   return (a - b).isEmpty() and (b - a).isEmpty();
@@ -172,9 +237,17 @@ TEST_F(TransportTest, SendAndReceive) {
   ::iroha::network::transport::MstState request;
   auto r = std::make_unique<
       grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
+  // the peer does not support digests, so the state is sent in full
+  DigestAnswer answer(*stub, [](const auto &, auto *) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "");
+  });
+  std::promise<void> sent;
   EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
-      .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+      .WillOnce(DoAll(SaveArg<1>(&request),
+                      InvokeWithoutArgs([&sent] { sent.set_value(); }),
+                      Return(r.get())));
   transport->sendState(peer, state).subscribe();
+  ASSERT_EQ(sent.get_future().wait_for(5s), std::future_status::ready);
   auto response = transport->SendState(&context, &request, nullptr);
   ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
 }
@@ -243,3 +316,103 @@ TEST_F(TransportTest, ReplayAttack) {
   transport->SendState(&context, &proto_state, &response);
   transport->SendState(&context, &proto_state, &response);
 }
+
+/**
+ * @given MstState with a batch the receiver has with fewer signatures and a
+ * batch the receiver does not have
+ * @when the state is sent via transport
+ * @then only the unknown batch and the missing signature are transmitted
+ * @and the receiver restores the whole state from them
+ */
+TEST_F(TransportTest, SendOnlyMissing) {
+  expectTxsMissing(*tx_presence_cache_);
+  auto time = iroha::time::now();
+  auto first_key = makeKey();
+  auto known_batch = addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(1, time)), 0, first_key);
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state += addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(1, time)), 0, first_key, makeKey());
+  state += addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(2, time)), 0, makeKey());
+  const auto known_hash = known_batch->transactions().front()->hash();
+  EXPECT_CALL(*mst_notification_transport_, findBatch(_))
+      .WillRepeatedly(Invoke([&](const auto &hash) {
+        return hash == known_hash ? known_batch : iroha::DataType{};
+      }));
+
+  ::iroha::network::transport::MstState request;
+  auto r = std::make_unique<
+      grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
+  DigestAnswer answer(*stub, answerOf(*transport));
+  std::promise<void> sent;
+  EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request),
+                      InvokeWithoutArgs([&sent] { sent.set_value(); }),
+                      Return(r.get())));
+  transport->sendState(peer, state).subscribe();
+  ASSERT_EQ(sent.get_future().wait_for(5s), std::future_status::ready);
+
+  ASSERT_EQ(request.transactions_size(), 1);
+  ASSERT_EQ(request.batch_signatures_size(), 1);
+  ASSERT_EQ(request.batch_signatures(0).transactions_size(), 1);
+  EXPECT_EQ(request.batch_signatures(0).transactions(0).signatures_size(), 1);
+
+  EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
+      .WillOnce(Invoke([&](const auto &, auto const &target_state) {
+        EXPECT_TRUE(statesEqual(state, target_state));
+        auto restored = target_state.findBatch(known_hash);
+        ASSERT_TRUE(restored);
+        EXPECT_EQ(boost::size(restored->transactions().front()->signatures()),
+                  2);
+      }));
+  ::grpc::ServerContext context;
+  auto response = transport->SendState(&context, &request, nullptr);
+  ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+}
+
+/**
+ * @given MstState, which the receiver already has
+ * @when the state is sent via transport
+ * @then nothing but the digest is transmitted @and the sending succeeds
+ */
+TEST_F(TransportTest, SendNothingWhenNothingMissing) {
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state += addSignaturesFromKeyPairs(makeTestBatch(txBuilder(1)), 0, makeKey());
+  EXPECT_CALL(*mst_notification_transport_, findBatch(_))
+      .WillRepeatedly(Invoke(
+          [&](const auto &hash) { return state.findBatch(hash); }));
+
+  DigestAnswer answer(*stub, answerOf(*transport));
+  EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _)).Times(0);
+  std::promise<bool> sent;
+  transport->sendState(peer, state).subscribe(
+      [&sent](bool ok) { sent.set_value(ok); });
+  auto result = sent.get_future();
+  ASSERT_EQ(result.wait_for(5s), std::future_status::ready);
+  EXPECT_TRUE(result.get());
+}
+
+/**
+ * @given peer, which does not answer the digest
+ * @when the state is sent to it
+ * @then sending does not wait for the answer @and the state is not sent
+ */
+TEST_F(TransportTest, UnansweredDigestDoesNotBlock) {
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state += addSignaturesFromKeyPairs(makeTestBatch(txBuilder(1)), 0, makeKey());
+
+  // the answer is delivered when the test is over
+  DigestAnswer answer(
+      *stub,
+      [](const auto &, auto *) {
+        return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "");
+      },
+      1h);
+  EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _)).Times(0);
+  auto sent = std::make_shared<std::promise<bool>>();
+  auto result = sent->get_future();
+  transport->sendState(peer, state).subscribe(
+      [sent](bool ok) { sent->set_value(ok); });
+  EXPECT_EQ(result.wait_for(100ms), std::future_status::timeout);
+}
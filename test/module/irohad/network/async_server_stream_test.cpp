@@ -0,0 +1,186 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_server_stream.hpp"
+
+#include <condition_variable>
+#include <future>
+
+#include <gtest/gtest.h>
+#include "endpoint.grpc.pb.h"
+#include "framework/test_logger.hpp"
+#include "main/server_runner.hpp"
+
+using namespace iroha::network;
+using namespace std::chrono_literals;
+
+using Response = iroha::protocol::BlockQueryResponse;
+using Stream = AsyncServerStream<iroha::protocol::BlocksQuery, Response>;
+
+/**
+ * Service which serves FetchCommits calls with AsyncServerStream and passes
+ * the streams to the test
+ */
+class StreamService
+    : public iroha::protocol::QueryService_v1::WithAsyncMethod_FetchCommits<
+          iroha::protocol::QueryService_v1::Service>,
+      public AsyncGrpcService {
+ public:
+  explicit StreamService(size_t max_queued_responses)
+      : max_queued_responses_(max_queued_responses) {}
+
+  void requestCalls(std::shared_ptr<AsyncCallQueue> queue) override {
+    Stream::request(
+        std::move(queue),
+        [this](auto *context,
+               auto *request,
+               auto *writer,
+               auto *cq,
+               auto *tag) {
+          RequestFetchCommits(context, request, writer, cq, cq, tag);
+        },
+        [this](const auto &, auto stream) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          streams_.push_back(std::move(stream));
+          cv_.notify_all();
+        },
+        max_queued_responses_);
+  }
+
+  /// @return the stream of the next arrived call, or nullptr on timeout
+  std::shared_ptr<ServerStream<Response>> waitStream() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (not cv_.wait_for(lock, 10s, [this] { return not streams_.empty(); })) {
+      return nullptr;
+    }
+    auto stream = std::move(streams_.front());
+    streams_.pop_front();
+    return stream;
+  }
+
+ private:
+  const size_t max_queued_responses_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::shared_ptr<ServerStream<Response>>> streams_;
+};
+
+class AsyncServerStreamTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    service_ = std::make_shared<StreamService>(kMaxQueuedResponses);
+    runner_ = std::make_unique<ServerRunner>(kAddress + ":0",
+                                             getTestLogger("ServerRunner"));
+    runner_->append(service_).run().match(
+        [this](const auto &port) {
+          stub_ = iroha::protocol::QueryService_v1::NewStub(
+              grpc::CreateChannel(kAddress + ":" + std::to_string(port.value),
+                                  grpc::InsecureChannelCredentials()));
+        },
+        [](const auto &error) { FAIL() << error.error; });
+    runner_->waitForServersReady();
+  }
+
+  void TearDown() override {
+    runner_.reset();
+  }
+
+  /// @return response which is distinguished by the message
+  static Response makeResponse(std::string message) {
+    Response response;
+    response.mutable_block_error_response()->set_message(std::move(message));
+    return response;
+  }
+
+  const std::string kAddress = "127.0.0.1";
+  static constexpr size_t kMaxQueuedResponses = 2;
+
+  std::shared_ptr<StreamService> service_;
+  std::unique_ptr<ServerRunner> runner_;
+  std::unique_ptr<iroha::protocol::QueryService_v1::Stub> stub_;
+};
+
+/**
+ * @given server stream of a call
+ * @when several responses are written and the stream is finished
+ * @then the client receives all the responses in order and the finish status,
+ * and the done callback is called
+ */
+TEST_F(AsyncServerStreamTest, ResponsesAreSentInOrder) {
+  grpc::ClientContext context;
+  auto reader = stub_->FetchCommits(&context, {});
+  auto stream = service_->waitStream();
+  ASSERT_TRUE(stream);
+
+  std::promise<void> done;
+  stream->setOnDone([&done] { done.set_value(); });
+  for (auto message : {"1", "2", "3"}) {
+    EXPECT_TRUE(stream->write(makeResponse(message)));
+  }
+  stream->finish(grpc::Status::OK);
+  EXPECT_FALSE(stream->write(makeResponse("4")));
+
+  Response response;
+  for (auto message : {"1", "2", "3"}) {
+    ASSERT_TRUE(reader->Read(&response));
+    EXPECT_EQ(response.block_error_response().message(), message);
+  }
+  EXPECT_FALSE(reader->Read(&response));
+  EXPECT_TRUE(reader->Finish().ok());
+  EXPECT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+}
+
+/**
+ * @given server stream of a call, which client does not read the responses
+ * @when the responses are written until the queue limit is exceeded
+ * @then the write is rejected, and the client receives the responses sent
+ * before the limit was exceeded and RESOURCE_EXHAUSTED status
+ */
+TEST_F(AsyncServerStreamTest, SlowClientIsDisconnected) {
+  grpc::ClientContext context;
+  auto reader = stub_->FetchCommits(&context, {});
+  auto stream = service_->waitStream();
+  ASSERT_TRUE(stream);
+
+  // large responses fill the flow control window of the transport, so that
+  // the writes are not completed until the client reads them
+  constexpr size_t kMaxWrites = 100;
+  const std::string payload(1024 * 1024, 'a');
+  size_t written = 0;
+  while (written < kMaxWrites and stream->write(makeResponse(payload))) {
+    ++written;
+  }
+  ASSERT_LT(written, kMaxWrites);
+  EXPECT_GT(written, kMaxQueuedResponses);
+  EXPECT_FALSE(stream->write(makeResponse(payload)));
+
+  size_t received = 0;
+  Response response;
+  while (reader->Read(&response)) {
+    ++received;
+  }
+  EXPECT_LE(received, written);
+  EXPECT_EQ(reader->Finish().error_code(),
+            grpc::StatusCode::RESOURCE_EXHAUSTED);
+}
+
+/**
+ * @given server stream of a call
+ * @when the client cancels the call
+ * @then the done callback is called and the responses are not accepted
+ */
+TEST_F(AsyncServerStreamTest, CancelledByClient) {
+  grpc::ClientContext context;
+  auto reader = stub_->FetchCommits(&context, {});
+  auto stream = service_->waitStream();
+  ASSERT_TRUE(stream);
+
+  std::promise<void> done;
+  stream->setOnDone([&done] { done.set_value(); });
+  context.TryCancel();
+
+  ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+  EXPECT_FALSE(stream->write(makeResponse("1")));
+}
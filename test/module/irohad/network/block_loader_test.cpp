@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <future>
+
 #include <grpc++/security/server_credentials.h>
 #include <grpc++/server.h>
 #include <grpc++/server_builder.h>
@@ -18,12 +20,14 @@
 #include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
 #include "module/irohad/ametsuchi/mock_peer_query.hpp"
 #include "module/irohad/ametsuchi/mock_peer_query_factory.hpp"
+#include "module/irohad/ametsuchi/mock_wsv_snapshot.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "module/shared_model/cryptography/crypto_defaults.hpp"
 #include "module/shared_model/interface_mocks.hpp"
 #include "network/impl/block_loader_impl.hpp"
 #include "network/impl/block_loader_service.hpp"
+#include "network/impl/wsv_snapshot_loader.hpp"
 #include "validators/default_validator.hpp"
 
 using namespace std::literals;
@@ -36,6 +40,7 @@ using namespace shared_model::validation;
 using testing::_;
 using testing::A;
 using testing::ByMove;
+using testing::Invoke;
 using testing::Return;
 
 using wPeer = std::shared_ptr<shared_model::interface::Peer>;
@@ -63,8 +68,12 @@ class BlockLoaderTest : public testing::Test {
             std::move(validator_ptr),
             std::make_unique<MockValidator<iroha::protocol::Block>>()),
         getTestLogger("BlockLoader"));
+    snapshot_exporter = std::make_shared<MockWsvSnapshotExporter>();
     service = std::make_shared<BlockLoaderService>(
-        block_query_factory, block_cache, getTestLogger("BlockLoaderService"));
+        block_query_factory,
+        block_cache,
+        getTestLogger("BlockLoaderService"),
+        snapshot_exporter);
 
     grpc::ServerBuilder builder;
     int port = 0;
@@ -113,6 +122,7 @@ class BlockLoaderTest : public testing::Test {
   std::shared_ptr<MockBlockQuery> storage;
   std::shared_ptr<MockBlockQueryFactory> block_query_factory;
   std::shared_ptr<BlockLoaderImpl> loader;
+  std::shared_ptr<MockWsvSnapshotExporter> snapshot_exporter;
   std::shared_ptr<BlockLoaderService> service;
   std::unique_ptr<grpc::Server> server;
   std::shared_ptr<iroha::consensus::ConsensusResultCache> block_cache;
@@ -165,9 +175,9 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getTopBlockHeight())
       .WillOnce(Return(top_block.height()));
-  EXPECT_CALL(*storage, getBlock(top_block.height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(top_block)))));
+  EXPECT_CALL(*storage, getSerializedBlock(top_block.height()))
+      .WillOnce(Return(
+          iroha::expected::makeValue(toBinaryString(top_block.blob()))));
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
   wrapper.subscribe([&top_block](auto block) { ASSERT_EQ(*block, top_block); });
@@ -202,9 +212,9 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
                    .signAndAddSignature(key)
                    .finish();
 
-    EXPECT_CALL(*storage, getBlock(i))
-        .WillOnce(Return(ByMove(iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(blk)))));
+    EXPECT_CALL(*storage, getSerializedBlock(i))
+        .WillOnce(
+            Return(iroha::expected::makeValue(toBinaryString(blk.blob()))));
   }
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
@@ -218,6 +228,36 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block loader and storage, which fails to read a block in the middle
+ * @when retrieveBlocks is called
+ * @then only the blocks below the failed one are received
+ */
+TEST_F(BlockLoaderTest, BlocksAreNotSentAfterStorageError) {
+  auto blk = getBaseBlockBuilder()
+                 .height(2)
+                 .build()
+                 .signAndAddSignature(key)
+                 .finish();
+
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillOnce(Return(4));
+  EXPECT_CALL(*storage, getSerializedBlock(2))
+      .WillOnce(
+          Return(iroha::expected::makeValue(toBinaryString(blk.blob()))));
+  EXPECT_CALL(*storage, getSerializedBlock(3))
+      .WillOnce(Return(iroha::expected::makeError(BlockQuery::GetBlockError{
+          BlockQuery::GetBlockError::Code::kInternalError, "read error"})));
+  EXPECT_CALL(*storage, getSerializedBlock(4)).Times(0);
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  auto wrapper =
+      make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
+  wrapper.subscribe([](auto block) { ASSERT_EQ(block->height(), 2); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 MATCHER_P(RefAndPointerEq, arg1, "") {
   return arg == *arg1;
 }
@@ -315,3 +355,125 @@ TEST_F(BlockLoaderTest, NoBlocksInStorage) {
   auto block = loader->retrieveBlock(peer_key, 1);
   ASSERT_FALSE(block);
 }
+
+/**
+ * @given block loader service with WSV snapshot exporter
+ * @when WSV snapshot is retrieved by the snapshot loader
+ * @then the rows are passed to the importer in the order of their export
+ * @and the summary of the snapshot is received
+ */
+TEST_F(BlockLoaderTest, WsvSnapshotIsStreamed) {
+  WsvSnapshotInfo info{
+      iroha::TopBlockInfo{5, Hash(std::string(32, '1'))},
+      Hash(std::string(32, '2'))};
+  EXPECT_CALL(*snapshot_exporter, exportSnapshot(_))
+      .WillOnce(Invoke([&](const auto &consumer)
+                           -> iroha::expected::Result<WsvSnapshotInfo,
+                                                      std::string> {
+        consumer("role", "admin\n");
+        consumer("peer", "peer_key\taddress\n");
+        return info;
+      }));
+  MockWsvSnapshotImporter importer;
+  {
+    testing::InSequence s;
+    EXPECT_CALL(importer, importRows("role", "admin\n"))
+        .WillOnce(Return(iroha::expected::Value<void>{}));
+    EXPECT_CALL(importer, importRows("peer", "peer_key\taddress\n"))
+        .WillOnce(Return(iroha::expected::Value<void>{}));
+  }
+
+  WsvSnapshotLoader snapshot_loader(
+      proto::Loader::NewStub(
+          grpc::CreateChannel(address, grpc::InsecureChannelCredentials())),
+      shared_model::proto::ProtoBlockFactory(
+          std::make_unique<MockValidator<shared_model::interface::Block>>(),
+          std::make_unique<MockValidator<iroha::protocol::Block>>()),
+      10s,
+      getTestLogger("WsvSnapshotLoader"));
+  auto result = snapshot_loader.retrieveSnapshot(importer);
+
+  ASSERT_TRUE(iroha::expected::hasValue(result));
+  EXPECT_EQ(result.assumeValue().top_block_info.height,
+            info.top_block_info.height);
+  EXPECT_EQ(result.assumeValue().top_block_info.top_hash,
+            info.top_block_info.top_hash);
+  EXPECT_EQ(result.assumeValue().snapshot_hash, info.snapshot_hash);
+}
+
+/**
+ * @given block loader service with WSV snapshot exporter, which fails
+ * @when WSV snapshot is retrieved by the snapshot loader
+ * @then the loader returns error
+ */
+TEST_F(BlockLoaderTest, WsvSnapshotExportFails) {
+  EXPECT_CALL(*snapshot_exporter, exportSnapshot(_))
+      .WillOnce(Return(iroha::expected::makeError("export failed")));
+  MockWsvSnapshotImporter importer;
+  EXPECT_CALL(importer, importRows(_, _)).Times(0);
+
+  WsvSnapshotLoader snapshot_loader(
+      proto::Loader::NewStub(
+          grpc::CreateChannel(address, grpc::InsecureChannelCredentials())),
+      shared_model::proto::ProtoBlockFactory(
+          std::make_unique<MockValidator<shared_model::interface::Block>>(),
+          std::make_unique<MockValidator<iroha::protocol::Block>>()),
+      10s,
+      getTestLogger("WsvSnapshotLoader"));
+
+  ASSERT_TRUE(iroha::expected::hasError(
+      snapshot_loader.retrieveSnapshot(importer)));
+}
+
+/**
+ * @given block loader service without WSV snapshot exporter
+ * @when WSV snapshot is requested
+ * @then UNIMPLEMENTED status is returned
+ */
+TEST_F(BlockLoaderTest, WsvSnapshotIsNotServedWithoutExporter) {
+  BlockLoaderService service_without_snapshots(
+      block_query_factory, block_cache, getTestLogger("BlockLoaderService"));
+  grpc::ServerContext context;
+  proto::WsvSnapshotRequest request;
+
+  auto status = service_without_snapshots.retrieveWsvSnapshot(
+      &context, &request, nullptr);
+
+  ASSERT_EQ(status.error_code(), grpc::StatusCode::UNIMPLEMENTED);
+}
+
+/**
+ * @given block loader service with WSV snapshot exporter, which is exporting
+ * a snapshot
+ * @when another WSV snapshot is requested
+ * @then RESOURCE_EXHAUSTED status is returned at once @and a snapshot is
+ * exported again after the first export ends
+ */
+TEST_F(BlockLoaderTest, ConcurrentWsvSnapshotIsRejected) {
+  std::promise<void> export_started;
+  std::promise<void> export_released;
+  auto released = export_released.get_future().share();
+  EXPECT_CALL(*snapshot_exporter, exportSnapshot(_))
+      .WillOnce(Invoke([&](const auto &)
+                           -> iroha::expected::Result<WsvSnapshotInfo,
+                                                      std::string> {
+        export_started.set_value();
+        released.wait();
+        return iroha::expected::makeError("export failed");
+      }))
+      .WillOnce(Return(iroha::expected::makeError("export failed")));
+  auto retrieve = [this] {
+    grpc::ServerContext context;
+    proto::WsvSnapshotRequest request;
+    return service->retrieveWsvSnapshot(&context, &request, nullptr);
+  };
+
+  auto first = std::async(std::launch::async, retrieve);
+  ASSERT_EQ(export_started.get_future().wait_for(10s),
+            std::future_status::ready);
+  EXPECT_EQ(retrieve().error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+
+  export_released.set_value();
+  EXPECT_EQ(first.get().error_code(), grpc::StatusCode::INTERNAL);
+  EXPECT_EQ(retrieve().error_code(), grpc::StatusCode::INTERNAL);
+}
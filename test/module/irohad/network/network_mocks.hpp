@@ -12,6 +12,7 @@
 #include "network/consensus_gate.hpp"
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
+#include "network/server_stream.hpp"
 #include "simulator/block_creator_common.hpp"
 #include "synchronizer/synchronizer_common.hpp"
 
@@ -51,6 +52,12 @@ namespace iroha {
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::interface::types::HeightType,
               shared_model::interface::types::PublicKeyHexStringView));
+      MOCK_METHOD3(
+          retrieveBlockRange,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
+              const shared_model::interface::types::HeightType,
+              const shared_model::interface::types::HeightType,
+              shared_model::interface::types::PublicKeyHexStringView));
       MOCK_METHOD2(
           retrieveBlock,
           boost::optional<std::shared_ptr<shared_model::interface::Block>>(
@@ -85,6 +92,15 @@ namespace iroha {
       MOCK_METHOD0(stop, void());
     };
 
+    template <typename Response>
+    class MockServerStream : public ServerStream<Response> {
+     public:
+      MOCK_METHOD1_T(write, bool(Response));
+      MOCK_METHOD1_T(finish, void(grpc::Status));
+      MOCK_METHOD1_T(setOnDone, void(std::function<void()>));
+      MOCK_CONST_METHOD0_T(peer, std::string());
+    };
+
   }  // namespace network
 }  // namespace iroha
 
@@ -417,6 +417,9 @@ TEST_F(OnDemandOrderingGateTest, BatchesRemoveFromCache) {
 
   EXPECT_CALL(*cache, pop()).Times(1);
   EXPECT_CALL(*cache, remove(UnorderedElementsAre(hash1, hash2))).Times(1);
+  EXPECT_CALL(*ordering_service,
+              onTxsCommitted(UnorderedElementsAre(hash1, hash2)))
+      .Times(1);
 
   auto hashes =
       std::make_shared<ordering::cache::OrderingGateCache::HashesSetType>();
@@ -5,7 +5,9 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <future>
 #include <memory>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include "backend/protobuf/proto_proposal_factory.hpp"
@@ -91,7 +93,9 @@ class OnDemandOsTest : public ::testing::Test {
 
   OnDemandOrderingService::CollectionType generateTransactions(
       std::pair<uint64_t, uint64_t> range,
-      shared_model::interface::types::TimestampType now = iroha::time::now()) {
+      shared_model::interface::types::TimestampType now = iroha::time::now(),
+      const shared_model::interface::types::AccountIdType &creator =
+          "foo@bar") {
     OnDemandOrderingService::CollectionType collection;
 
     for (auto i = range.first; i < range.second; ++i) {
@@ -101,7 +105,7 @@ class OnDemandOsTest : public ::testing::Test {
                   std::make_unique<shared_model::proto::Transaction>(
                       shared_model::proto::TransactionBuilder()
                           .createdTime(now + i)
-                          .creatorAccountId("foo@bar")
+                          .creatorAccountId(creator)
                           .createAsset("asset", "domain", 1)
                           .quorum(1)
                           .build()
@@ -272,8 +276,10 @@ TEST_F(OnDemandOsTest, PassMissingTransaction) {
   auto batches = generateTransactions({1, 2});
   auto &batch = *batches.at(0);
 
+  // the batch is checked on arrival and when the proposal is packed
   EXPECT_CALL(*mock_cache, check(batchRef(batch)))
-      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+      .Times(2)
+      .WillRepeatedly(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
           iroha::ametsuchi::tx_cache_status_responses::Missing()}));
 
   os->onBatches(batches);
@@ -299,13 +305,15 @@ TEST_F(OnDemandOsTest, SeveralTransactionsOneCommited) {
   auto &batch3 = *batches.at(2);
 
   EXPECT_CALL(*mock_cache, check(batchRef(batch1)))
-      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+      .Times(2)
+      .WillRepeatedly(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
           iroha::ametsuchi::tx_cache_status_responses::Missing()}));
   EXPECT_CALL(*mock_cache, check(batchRef(batch2)))
       .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
           iroha::ametsuchi::tx_cache_status_responses::Committed()}));
   EXPECT_CALL(*mock_cache, check(batchRef(batch3)))
-      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+      .Times(2)
+      .WillRepeatedly(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
           iroha::ametsuchi::tx_cache_status_responses::Missing()}));
 
   os->onBatches(batches);
@@ -380,3 +388,170 @@ TEST_F(OnDemandOsTest, FailOnCreationStrategy) {
 
   ASSERT_FALSE(os->onRequestProposal(target_round));
 }
+
+/**
+ * @given initialized on-demand OS with more transactions than fit into a
+ * proposal
+ * @when transactions of the first proposal are committed
+ * @then the rest of transactions are used for the next proposal
+ */
+TEST_F(OnDemandOsTest, LeftoversUsedInNextRound) {
+  generateTransactionsAndInsert({1, transaction_limit + 5});
+  os->onCollaborationOutcome(commit_round);
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(transaction_limit, boost::size((*proposal)->transactions()));
+
+  OnDemandOrderingService::HashesSetType hashes;
+  for (const auto &tx : (*proposal)->transactions()) {
+    hashes.insert(tx.hash());
+  }
+  os->onTxsCommitted(hashes);
+
+  consensus::Round next_round = {commit_round.block_round + 1,
+                                 kFirstRejectRound};
+  os->onCollaborationOutcome(next_round);
+  proposal = os->onRequestProposal(
+      {next_round.block_round + 1, kNextCommitRoundConsumer});
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(4, boost::size((*proposal)->transactions()));
+  for (const auto &tx : (*proposal)->transactions()) {
+    EXPECT_EQ(0, hashes.count(tx.hash()));
+  }
+}
+
+/**
+ * @given initialized on-demand OS with many batches of one creator, followed
+ * by a batch of another creator
+ * @when proposal is requested
+ * @then the batch of the second creator is included in the proposal
+ */
+TEST_F(OnDemandOsTest, CreatorsServedInTurns) {
+  auto now = iroha::time::now();
+  os->onBatches(generateTransactions({1, transaction_limit * 2}, now));
+  os->onBatches(generateTransactions({1, 2}, now, "baz@bar"));
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(transaction_limit, boost::size((*proposal)->transactions()));
+  EXPECT_TRUE(std::any_of(
+      (*proposal)->transactions().begin(),
+      (*proposal)->transactions().end(),
+      [](const auto &tx) { return tx.creatorAccountId() == "baz@bar"; }));
+}
+
+/**
+ * @given on-demand OS with the pending batches limit, filled by one creator
+ * @when batches of another creator arrive
+ * @then batches of the first creator are evicted to make room for them
+ */
+TEST_F(OnDemandOsTest, PoolBoundedPerCreator) {
+  const size_t max_pending_batches = 4;
+  auto tx_cache =
+      std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
+  ON_CALL(*tx_cache,
+          check(testing::Matcher<
+                const shared_model::interface::TransactionBatch &>(_)))
+      .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+  os = std::make_shared<OnDemandOrderingServiceImpl>(
+      transaction_limit,
+      std::make_unique<
+          shared_model::proto::ProtoProposalFactory<MockProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      std::move(tx_cache),
+      proposal_creation_strategy,
+      getTestLogger("OdOrderingService"),
+      proposal_limit,
+      max_pending_batches);
+  auto now = iroha::time::now();
+  os->onBatches(generateTransactions({1, 10}, now));
+  os->onBatches(generateTransactions({1, 3}, now, "baz@bar"));
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(max_pending_batches, boost::size((*proposal)->transactions()));
+  EXPECT_EQ(2,
+            std::count_if((*proposal)->transactions().begin(),
+                          (*proposal)->transactions().end(),
+                          [](const auto &tx) {
+                            return tx.creatorAccountId() == "baz@bar";
+                          }));
+}
+
+/**
+ * @given initialized on-demand OS
+ * @when a batch created longer than the batch lifetime ago and a fresh batch
+ * arrive
+ * @then only the fresh batch is in the proposal
+ */
+TEST_F(OnDemandOsTest, ExpiredBatchesDropped) {
+  auto now = iroha::time::now();
+  auto lifetime =
+      OnDemandOrderingServiceImpl::kDefaultMaxBatchLifetime.count();
+  os->onBatches(generateTransactions({1, 2}, now - lifetime - 10));
+  os->onBatches(generateTransactions({1, 2}, now));
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(1, boost::size((*proposal)->transactions()));
+  EXPECT_GE((*proposal)->transactions().begin()->createdTime(), now);
+}
+
+/**
+ * @given initialized on-demand OS with a pending batch
+ * @when the batch is committed in a block built by another peer, so the
+ * transaction cache reports it as committed
+ * @then the batch is not proposed again
+ */
+TEST_F(OnDemandOsTest, CommittedBatchDroppedWhenPacked) {
+  auto batches = generateTransactions({1, 2});
+  auto &batch = *batches.at(0);
+  EXPECT_CALL(*mock_cache, check(batchRef(batch)))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Missing()}))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Committed()}));
+
+  os->onBatches(batches);
+  os->onCollaborationOutcome(commit_round);
+
+  EXPECT_FALSE(os->onRequestProposal(target_round));
+}
+
+/**
+ * @given initialized on-demand OS with a pending batch
+ * @when the batch is checked in the transaction cache while the proposal is
+ * packed, and another batch arrives meanwhile
+ * @then the arrived batch is accepted without waiting for the check
+ */
+TEST_F(OnDemandOsTest, BatchesAcceptedWhilePackedBatchesAreChecked) {
+  using namespace std::chrono_literals;
+  auto batches = generateTransactions({1, 2});
+  auto &batch = *batches.at(0);
+  std::promise<void> checking, accepted;
+  auto accepted_future = accepted.get_future();
+  std::future_status accepted_status = std::future_status::timeout;
+  EXPECT_CALL(*mock_cache, check(batchRef(batch)))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Missing()}))
+      .WillOnce(Invoke([&](const auto &) {
+        checking.set_value();
+        accepted_status = accepted_future.wait_for(10s);
+        return boost::make_optional(
+            std::vector<iroha::ametsuchi::TxCacheStatusType>{
+                iroha::ametsuchi::tx_cache_status_responses::Missing()});
+      }));
+
+  os->onBatches(batches);
+  std::thread packing([this] { os->onCollaborationOutcome(commit_round); });
+  checking.get_future().wait();
+  os->onBatches(generateTransactions({2, 3}));
+  accepted.set_value();
+  packing.join();
+
+  EXPECT_EQ(accepted_status, std::future_status::ready);
+}
@@ -43,6 +43,8 @@ namespace iroha {
                        consensus::Round));
 
       MOCK_METHOD1(onCollaborationOutcome, void(consensus::Round));
+
+      MOCK_METHOD1(onTxsCommitted, void(const HashesSetType &));
     };
 
   }  // namespace ordering
@@ -0,0 +1,250 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/chain_follower.hpp"
+
+#include <gmock/gmock.h>
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
+#include "module/irohad/ametsuchi/mock_command_executor.hpp"
+#include "module/irohad/ametsuchi/mock_mutable_factory.hpp"
+#include "module/irohad/ametsuchi/mock_mutable_storage.hpp"
+#include "module/irohad/ametsuchi/mock_peer_query.hpp"
+#include "module/irohad/ametsuchi/mock_peer_query_factory.hpp"
+#include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/validation/validation_mocks.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace iroha::synchronizer;
+using namespace iroha::validation;
+using namespace iroha::network;
+using namespace shared_model::interface::types;
+
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::Invoke;
+using ::testing::InSequence;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using shared_model::interface::Block;
+
+using Chain = rxcpp::observable<std::shared_ptr<Block>>;
+
+static constexpr HeightType kTopHeight{4};
+
+class ChainFollowerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    chain_validator = std::make_shared<MockChainValidator>();
+    mutable_factory = std::make_shared<MockMutableFactory>();
+    block_query_factory = std::make_shared<NiceMock<MockBlockQueryFactory>>();
+    block_query = std::make_shared<NiceMock<MockBlockQuery>>();
+    peer_query_factory = std::make_shared<NiceMock<MockPeerQueryFactory>>();
+    peer_query = std::make_shared<NiceMock<MockPeerQuery>>();
+    block_loader = std::make_shared<MockBlockLoader>();
+
+    for (auto key : {"aa", "bb"}) {
+      peers.push_back(makePeer(key, PublicKeyHexStringView{key}));
+    }
+
+    ON_CALL(*block_query_factory, createBlockQuery())
+        .WillByDefault(Return(
+            boost::make_optional(std::shared_ptr<BlockQuery>(block_query))));
+    ON_CALL(*block_query, getTopBlockHeight())
+        .WillByDefault(Return(kTopHeight));
+    ON_CALL(*peer_query_factory, createPeerQuery())
+        .WillByDefault(Return(
+            boost::make_optional(std::shared_ptr<PeerQuery>(peer_query))));
+    ON_CALL(*peer_query, getLedgerPeers())
+        .WillByDefault(Return(boost::make_optional(peers)));
+    EXPECT_CALL(*mutable_factory, createMutableStorage(_))
+        .WillRepeatedly(Invoke([this](auto) {
+          applied_height = kTopHeight;
+          auto storage = std::make_unique<NiceMock<MockMutableStorage>>();
+          ON_CALL(*storage, getLedgerState()).WillByDefault(Invoke([this] {
+            return boost::make_optional(std::make_shared<const LedgerState>(
+                peers, applied_height, HashType{"hash"}));
+          }));
+          return storage;
+        }));
+
+    follower =
+        std::make_shared<ChainFollower>(std::make_unique<MockCommandExecutor>(),
+                                        chain_validator,
+                                        mutable_factory,
+                                        block_query_factory,
+                                        peer_query_factory,
+                                        block_loader,
+                                        getTestLogger("ChainFollower"));
+  }
+
+  std::shared_ptr<Block> makeBlock(HeightType height) {
+    auto block = std::make_shared<MockBlock>();
+    EXPECT_CALL(*block, height()).WillRepeatedly(Return(height));
+    return block;
+  }
+
+  /// validation result, which consumes the whole chain, as the real
+  /// validator does. A rejected chain is applied up to its last block,
+  /// unless the whole chain is applied before the connection is broken
+  auto applyChain(bool result, bool connection_broken = false) {
+    return Invoke([this, result, connection_broken](Chain chain,
+                                                    MutableStorage &) {
+      std::vector<HeightType> heights;
+      chain.subscribe([&heights](const auto &block) {
+        heights.push_back(block->height());
+      });
+      if (not result and not connection_broken and not heights.empty()) {
+        heights.pop_back();
+      }
+      if (not heights.empty()) {
+        applied_height = heights.back();
+      }
+      return result;
+    });
+  }
+
+  std::shared_ptr<MockChainValidator> chain_validator;
+  std::shared_ptr<MockMutableFactory> mutable_factory;
+  std::shared_ptr<MockBlockQueryFactory> block_query_factory;
+  std::shared_ptr<MockBlockQuery> block_query;
+  std::shared_ptr<MockPeerQueryFactory> peer_query_factory;
+  std::shared_ptr<MockPeerQuery> peer_query;
+  std::shared_ptr<MockBlockLoader> block_loader;
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+  HeightType applied_height{kTopHeight};
+
+  std::shared_ptr<ChainFollower> follower;
+};
+
+/**
+ * @given ledger peers, which do not have blocks above the local top block
+ * @when the follower synchronizes
+ * @then only the first peer is asked for the blocks
+ * @and nothing is committed and the local height is reported
+ */
+TEST_F(ChainFollowerTest, NothingIsCommittedWithoutNewBlocks) {
+  EXPECT_CALL(*block_loader, retrieveBlocks(kTopHeight, _))
+      .WillOnce(Return(Chain{rxcpp::observable<>::empty<
+                                       std::shared_ptr<Block>>()}));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillRepeatedly(applyChain(true));
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(0);
+
+  auto result = follower->synchronize();
+  ASSERT_TRUE(iroha::expected::hasValue(result));
+  EXPECT_EQ(result.assumeValue(), kTopHeight);
+}
+
+/**
+ * @given a ledger peer, which has the blocks above the local top block
+ * @when the follower synchronizes
+ * @then the blocks are downloaded from the first peer only and committed
+ */
+TEST_F(ChainFollowerTest, NewBlocksAreCommitted) {
+  std::vector<std::shared_ptr<Block>> blocks{makeBlock(kTopHeight + 1),
+                                             makeBlock(kTopHeight + 2)};
+  EXPECT_CALL(*block_loader, retrieveBlocks(kTopHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(blocks)));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(applyChain(true));
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(expected::makeValue(std::make_shared<LedgerState>(
+          peers, kTopHeight + 2, HashType{"hash"})))));
+
+  auto result = follower->synchronize();
+  ASSERT_TRUE(iroha::expected::hasValue(result));
+  EXPECT_EQ(result.assumeValue(), kTopHeight + 2);
+}
+
+/**
+ * @given a ledger peer, which sends an invalid block, and another one, which
+ * sends the valid blocks
+ * @when the follower synchronizes
+ * @then the invalid block is asked again from the other peer
+ * @and the blocks applied from both peers are committed
+ */
+TEST_F(ChainFollowerTest, InvalidBlockIsAskedFromOtherPeer) {
+  InSequence s;
+  EXPECT_CALL(*block_loader, retrieveBlocks(kTopHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<std::shared_ptr<Block>>{makeBlock(kTopHeight + 1),
+                                              makeBlock(kTopHeight + 2)})));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(applyChain(false));
+  EXPECT_CALL(*block_loader, retrieveBlocks(kTopHeight + 1, _))
+      .WillOnce(Return(rxcpp::observable<>::just(makeBlock(kTopHeight + 2))));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(applyChain(true));
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(expected::makeValue(std::make_shared<LedgerState>(
+          peers, kTopHeight + 2, HashType{"hash"})))));
+
+  auto result = follower->synchronize();
+  ASSERT_TRUE(iroha::expected::hasValue(result));
+  EXPECT_EQ(result.assumeValue(), kTopHeight + 2);
+}
+
+/**
+ * @given a ledger peer, which sends the valid blocks and breaks the connection
+ * after them, and another one, which has no newer blocks
+ * @when the follower synchronizes
+ * @then the other peer is asked for the blocks above the applied ones
+ * @and the applied blocks are committed
+ */
+TEST_F(ChainFollowerTest, AppliedBlocksAreKeptWhenConnectionIsBroken) {
+  InSequence s;
+  EXPECT_CALL(*block_loader, retrieveBlocks(kTopHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<std::shared_ptr<Block>>{makeBlock(kTopHeight + 1),
+                                              makeBlock(kTopHeight + 2)})));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(applyChain(false, true));
+  EXPECT_CALL(*block_loader, retrieveBlocks(kTopHeight + 2, _))
+      .WillOnce(Return(Chain{
+          rxcpp::observable<>::empty<std::shared_ptr<Block>>()}));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(applyChain(true));
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(expected::makeValue(std::make_shared<LedgerState>(
+          peers, kTopHeight + 2, HashType{"hash"})))));
+
+  auto result = follower->synchronize();
+  ASSERT_TRUE(iroha::expected::hasValue(result));
+  EXPECT_EQ(result.assumeValue(), kTopHeight + 2);
+}
+
+/**
+ * @given two ledger peers
+ * @when the follower synchronizes twice
+ * @then each attempt starts from another peer
+ */
+TEST_F(ChainFollowerTest, PeersAreAskedInTurns) {
+  auto one_block = [this](HeightType height) {
+    return Return(rxcpp::observable<>::just(makeBlock(height)));
+  };
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillRepeatedly(applyChain(true));
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillRepeatedly(Invoke([this](auto &) -> CommitResult {
+        return expected::makeValue(std::make_shared<LedgerState>(
+            peers, kTopHeight + 1, HashType{"hash"}));
+      }));
+
+  InSequence s;
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(kTopHeight, PublicKeyHexStringView{"aa"}))
+      .WillOnce(one_block(kTopHeight + 1));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(kTopHeight, PublicKeyHexStringView{"bb"}))
+      .WillOnce(one_block(kTopHeight + 1));
+
+  ASSERT_TRUE(iroha::expected::hasValue(follower->synchronize()));
+  ASSERT_TRUE(iroha::expected::hasValue(follower->synchronize()));
+}
@@ -6,7 +6,9 @@
 #include "interfaces/common_objects/string_view_types.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 
+#include <atomic>
 #include <string_view>
+#include <thread>
 
 #include <gmock/gmock-generated-matchers.h>
 #include <gmock/gmock.h>
@@ -831,3 +833,225 @@ TEST_F(SynchronizerTest, OneRoundDifference) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+class ParallelSynchronizerTest : public SynchronizerTest {
+ public:
+  void SetUp() override {
+    SynchronizerTest::SetUp();
+    DefaultValue<
+        expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+        SetFactory(&createMockMutableStorage);
+
+    ParallelDownloadOptions options;
+    options.chunk_size = kChunkSize;
+    options.chunks_ahead = 2;
+    // the eviction of slow peers depends on timing
+    options.min_relative_throughput = 0;
+    options.chunk_timeout = kChunkTimeout;
+    EXPECT_CALL(*consensus_gate, onOutcome())
+        .WillOnce(Return(gate_outcome.get_observable()));
+    synchronizer = std::make_shared<SynchronizerImpl>(
+        std::make_unique<MockCommandExecutor>(),
+        consensus_gate,
+        chain_validator,
+        mutable_factory,
+        block_query_factory,
+        block_loader,
+        getTestLogger("Synchronizer"),
+        options);
+
+    for (auto height = kInitTopBlockHeight + 1; height <= kTargetHeight;
+         ++height) {
+      chain.push_back(makeCommit(height));
+    }
+    EXPECT_CALL(*mutable_factory, commit_(_))
+        .WillOnce(Return(ByMove(expected::makeValue(
+            std::make_shared<LedgerState>(
+                ledger_peers, kTargetHeight, chain.back()->hash())))));
+  }
+
+  /// Peer returns the blocks of the given chain in the requested range
+  static auto serveRange(
+      std::vector<std::shared_ptr<shared_model::interface::Block>> chain) {
+    return [chain = std::move(chain)](HeightType height,
+                                      HeightType last_height,
+                                      PublicKeyHexStringView) -> Chain {
+      std::vector<std::shared_ptr<shared_model::interface::Block>> blocks;
+      for (const auto &block : chain) {
+        if (block->height() > height and block->height() <= last_height) {
+          blocks.push_back(block);
+        }
+      }
+      return rxcpp::observable<>::iterate(blocks);
+    };
+  }
+
+  /// Peer starts the stream of the blocks and never completes it, until the
+  /// request is cancelled, which is counted
+  static Chain stallRange(std::shared_ptr<std::atomic<size_t>> cancelled) {
+    return rxcpp::observable<>::create<
+        std::shared_ptr<shared_model::interface::Block>>(
+        [cancelled](auto subscriber) {
+          while (subscriber.is_subscribed()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          }
+          ++*cancelled;
+        });
+  }
+
+  /// Validator accepts the blocks of the chain and records them
+  void expectValidChain() {
+    EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+        .WillRepeatedly(::testing::Invoke([this](auto blocks, auto &) {
+          bool valid = true;
+          blocks
+              .take_while([&](const auto &block) {
+                valid = std::find(chain.begin(), chain.end(), block)
+                    != chain.end();
+                return valid;
+              })
+              .as_blocking()
+              .subscribe(
+                  [this](const auto &block) { applied.push_back(block); });
+          return valid;
+        }));
+  }
+
+  void synchronize() {
+    auto wrapper =
+        make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+    wrapper.subscribe([](auto commit_event) {
+      EXPECT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+      EXPECT_EQ(commit_event.round, (consensus::Round{kTargetHeight, 0}));
+    });
+
+    gate_outcome.get_subscriber().on_next(consensus::Future{
+        consensus::Round{kTargetHeight + 1, 1}, ledger_state, public_keys});
+
+    ASSERT_TRUE(wrapper.validate());
+  }
+
+  static constexpr HeightType kChunkSize{3};
+  static constexpr std::chrono::milliseconds kChunkTimeout{200};
+  static constexpr HeightType kTargetHeight{kInitTopBlockHeight + 20};
+
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> applied;
+};
+
+/**
+ * @given peers which have all the missing blocks
+ * @when the node is behind by several chunks
+ * @then the blocks are downloaded by ranges from the peers and applied in
+ * order, without requesting the whole chain from a peer
+ */
+TEST_F(ParallelSynchronizerTest, BlocksAreDownloadedFromSeveralPeers) {
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(::testing::Invoke(serveRange(chain)));
+  expectValidChain();
+
+  synchronize();
+
+  EXPECT_EQ(applied, chain);
+}
+
+/**
+ * @given one of the peers sends invalid blocks
+ * @when the node is behind by several chunks
+ * @then the rejected blocks are downloaded again from the other peers and
+ * the valid chain is applied
+ */
+TEST_F(ParallelSynchronizerTest, InvalidBlocksAreDownloadedFromOtherPeers) {
+  std::vector<std::shared_ptr<shared_model::interface::Block>> bad_chain;
+  for (const auto &block : chain) {
+    bad_chain.push_back(makeCommit(block->height(), iroha::time::now() + 1));
+  }
+  const std::string bad_peer = public_keys.front();
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+  EXPECT_CALL(*block_loader, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(::testing::Invoke(
+          [bad_peer,
+           serve_good = serveRange(chain),
+           serve_bad = serveRange(bad_chain)](HeightType height,
+                                              HeightType last_height,
+                                              PublicKeyHexStringView peer) {
+            return static_cast<const std::string_view &>(peer) == bad_peer
+                ? serve_bad(height, last_height, peer)
+                : serve_good(height, last_height, peer);
+          }));
+  expectValidChain();
+
+  synchronize();
+
+  EXPECT_EQ(applied, chain);
+}
+
+/**
+ * @given one of the peers never completes the streams of the blocks
+ * @when the node is behind by several chunks
+ * @then the requests to the peer are cancelled after the chunk timeout, and
+ * the valid chain is downloaded from the other peers and applied
+ */
+TEST_F(ParallelSynchronizerTest, StalledRequestsAreCancelled) {
+  const std::string stalled_peer = public_keys.front();
+  auto cancelled = std::make_shared<std::atomic<size_t>>(0);
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+  EXPECT_CALL(*block_loader, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(::testing::Invoke(
+          [stalled_peer, cancelled, serve = serveRange(chain)](
+              HeightType height,
+              HeightType last_height,
+              PublicKeyHexStringView peer) {
+            return static_cast<const std::string_view &>(peer) == stalled_peer
+                ? stallRange(cancelled)
+                : serve(height, last_height, peer);
+          }));
+  expectValidChain();
+
+  synchronize();
+
+  EXPECT_EQ(applied, chain);
+  EXPECT_GT(cancelled->load(), 0);
+}
+
+/**
+ * @given peers which never complete the streams of the blocks
+ * @when the downloader is destroyed during the download
+ * @then the requests to the peers are cancelled and the destruction does not
+ * wait for the chunk timeout
+ */
+TEST(ParallelBlockDownloaderTest, RequestsAreCancelledWhenDestroyed) {
+  const PublicKeyCollectionType public_keys{"peer_1", "peer_2"};
+  auto block_loader = std::make_shared<MockBlockLoader>();
+  auto started = std::make_shared<std::atomic<size_t>>(0);
+  auto cancelled = std::make_shared<std::atomic<size_t>>(0);
+  EXPECT_CALL(*block_loader, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(::testing::InvokeWithoutArgs([started, cancelled] {
+        ++*started;
+        return ParallelSynchronizerTest::stallRange(cancelled);
+      }));
+
+  ParallelDownloadOptions options;
+  options.chunk_size = 3;
+  options.chunk_timeout = std::chrono::hours(1);
+  const auto started_at = std::chrono::steady_clock::now();
+  {
+    ParallelBlockDownloader downloader(block_loader,
+                                       options,
+                                       kInitTopBlockHeight,
+                                       kInitTopBlockHeight + 20,
+                                       public_keys,
+                                       getTestLogger("BlockDownloader"));
+    while (*started < public_keys.size()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  EXPECT_EQ(cancelled->load(), public_keys.size());
+  EXPECT_LT(std::chrono::steady_clock::now() - started_at,
+            std::chrono::seconds(10));
+}
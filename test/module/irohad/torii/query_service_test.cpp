@@ -4,13 +4,17 @@
  */
 
 #include "torii/query_service.hpp"
+#include "backend/protobuf/block.hpp"
 #include "backend/protobuf/proto_query_response_factory.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
+#include "backend/protobuf/query_responses/proto_block_query_response.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "builders/protobuf/queries.hpp"
 #include "framework/test_logger.hpp"
 #include "module/irohad/common/validators_config.hpp"
+#include "module/irohad/network/network_mocks.hpp"
 #include "module/irohad/torii/processor/mock_query_processor.hpp"
+#include "module/shared_model/builders/protobuf/test_query_builder.hpp"
 #include "module/shared_model/cryptography/crypto_defaults.hpp"
 #include "utils/query_error_response_visitor.hpp"
 #include "validators/protobuf/proto_query_validator.hpp"
@@ -23,8 +27,12 @@ using namespace shared_model::interface;
 using ::testing::_;
 using ::testing::Invoke;
 using ::testing::Return;
+using ::testing::SaveArg;
 using ::testing::Truly;
 
+using MockBlockStream = ::testing::NiceMock<
+    network::MockServerStream<protocol::BlockQueryResponse>>;
+
 class QueryServiceTest : public ::testing::Test {
  public:
   void SetUp() override {
@@ -83,6 +91,44 @@ class QueryServiceTest : public ::testing::Test {
         .createAccountResponse("a", "ru", 2, "", {"user"}, query->hash());
   }
 
+  /// @return blocks query signed by the given creator
+  static protocol::BlocksQuery makeBlocksQuery(std::string creator) {
+    return TestUnsignedBlocksQueryBuilder()
+        .creatorAccountId(std::move(creator))
+        .createdTime(iroha::time::now())
+        .queryCounter(1)
+        .build()
+        .signAndAddSignature(shared_model::crypto::DefaultCryptoAlgorithmType::
+                                 generateKeypair())
+        .finish()
+        .getTransport();
+  }
+
+  /// @return block response with a block of the given height
+  static std::shared_ptr<shared_model::interface::BlockQueryResponse>
+  makeBlockResponse(shared_model::interface::types::HeightType height) {
+    protocol::Block block;
+    block.mutable_block_v1()->mutable_payload()->set_height(height);
+    return shared_model::proto::ProtoQueryResponseFactory()
+        .createBlockQueryResponse(
+            std::make_unique<shared_model::proto::Block>(block.block_v1()));
+  }
+
+  /// @return matcher of the block response with a block of the given height
+  static auto blockWithHeight(
+      shared_model::interface::types::HeightType height) {
+    return Truly([height](const protocol::BlockQueryResponse &response) {
+      return response.block_response().block().block_v1().payload().height()
+          == height;
+    });
+  }
+
+  rxcpp::subjects::subject<
+      std::shared_ptr<shared_model::interface::BlockQueryResponse>>
+      blocks;
+  std::shared_ptr<MockBlockStream> block_stream =
+      std::make_shared<MockBlockStream>();
+
   std::shared_ptr<shared_model::proto::Query> query;
   std::shared_ptr<QueryService> query_service;
   std::shared_ptr<QueryService::QueryFactoryType> query_factory;
@@ -138,3 +184,88 @@ TEST_F(QueryServiceTest, InvalidWhenDuplicateHash) {
           shared_model::interface::StatelessFailedErrorResponse>(),
       resp.get()));
 }
+
+/**
+ * @given valid blocks query
+ * @when query processor emits blocks and completes
+ * @then the blocks are written to the stream in order, and the stream is
+ * finished
+ */
+TEST_F(QueryServiceTest, FetchCommitsWritesBlocks) {
+  EXPECT_CALL(*query_processor, blocksQueryHandle(_))
+      .WillOnce(Return(blocks.get_observable()));
+  {
+    ::testing::InSequence s;
+    EXPECT_CALL(*block_stream, write(blockWithHeight(1)))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*block_stream, write(blockWithHeight(2)))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*block_stream, finish(_));
+  }
+  init();
+
+  query_service->fetchCommits(makeBlocksQuery("user@domain"), block_stream);
+  blocks.get_subscriber().on_next(makeBlockResponse(1));
+  blocks.get_subscriber().on_next(makeBlockResponse(2));
+  blocks.get_subscriber().on_completed();
+}
+
+/**
+ * @given blocks stream of a client, which does not keep up with the blocks
+ * @when the stream rejects a block
+ * @then the service unsubscribes from the blocks and writes no more
+ */
+TEST_F(QueryServiceTest, FetchCommitsStopsWhenStreamRejects) {
+  EXPECT_CALL(*query_processor, blocksQueryHandle(_))
+      .WillOnce(Return(blocks.get_observable()));
+  EXPECT_CALL(*block_stream, write(_)).WillOnce(Return(false));
+  EXPECT_CALL(*block_stream, finish(_)).Times(0);
+  init();
+
+  query_service->fetchCommits(makeBlocksQuery("user@domain"), block_stream);
+  blocks.get_subscriber().on_next(makeBlockResponse(1));
+  EXPECT_FALSE(blocks.has_observers());
+  blocks.get_subscriber().on_next(makeBlockResponse(2));
+}
+
+/**
+ * @given blocks stream of a client
+ * @when the call is over
+ * @then the service unsubscribes from the blocks
+ */
+TEST_F(QueryServiceTest, FetchCommitsStopsWhenCallIsDone) {
+  EXPECT_CALL(*query_processor, blocksQueryHandle(_))
+      .WillOnce(Return(blocks.get_observable()));
+  std::function<void()> on_done;
+  EXPECT_CALL(*block_stream, setOnDone(_)).WillOnce(SaveArg<0>(&on_done));
+  EXPECT_CALL(*block_stream, write(_)).Times(0);
+  init();
+
+  query_service->fetchCommits(makeBlocksQuery("user@domain"), block_stream);
+  ASSERT_TRUE(on_done);
+  EXPECT_TRUE(blocks.has_observers());
+  on_done();
+  EXPECT_FALSE(blocks.has_observers());
+}
+
+/**
+ * @given stateless invalid blocks query
+ * @when it is served
+ * @then block error response is written and the stream is finished without
+ * querying the blocks
+ */
+TEST_F(QueryServiceTest, FetchCommitsInvalidQuery) {
+  EXPECT_CALL(*query_processor, blocksQueryHandle(_)).Times(0);
+  {
+    ::testing::InSequence s;
+    EXPECT_CALL(*block_stream,
+                write(Truly([](const protocol::BlockQueryResponse &response) {
+                  return response.has_block_error_response();
+                })))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*block_stream, finish(_));
+  }
+  init();
+
+  query_service->fetchCommits(makeBlocksQuery("asd@@domain"), block_stream);
+}
@@ -640,3 +640,59 @@ TEST_F(ToriiQueriesTest, FindManyTimesWhereQueryServiceSync) {
     ASSERT_EQ(model_query.hash(), resp.queryHash());
   }
 }
+
+/**
+ * @given valid query
+ * @when the storage has no database connection for it, since the query
+ * connections are saturated
+ * @then the query is rejected with RESOURCE_EXHAUSTED status, so that the
+ * client may retry it, and a retry is served
+ */
+TEST_F(ToriiQueriesTest, FindWhenConnectionsAreSaturated) {
+  auto creator = "a@domain";
+  EXPECT_CALL(*wsv_query, getSignatories(creator))
+      .WillRepeatedly(Return(signatories));
+
+  auto make_query = [&](uint64_t counter) {
+    return shared_model::proto::QueryBuilder()
+        .creatorAccountId(creator)
+        .queryCounter(counter)
+        .createdTime(iroha::time::now())
+        .getAccount("b@domain")
+        .build()
+        .signAndAddSignature(pair)
+        .finish();
+  };
+  auto model_query = make_query(1);
+
+  iroha::expected::Result<std::unique_ptr<QueryExecutor>, std::string>
+      saturated = iroha::expected::makeError(
+          "All query connections are busy and 64 requests are waiting for "
+          "them.");
+  EXPECT_CALL(*query_executor, validateAndExecute_(_))
+      .WillOnce(Return(query_response_factory
+                           ->createErrorQueryResponse(
+                               ErrorQueryType::kStatefulFailed,
+                               "",
+                               2,
+                               model_query.hash())
+                           .release()));
+  EXPECT_CALL(*storage, createQueryExecutor(_, _))
+      .WillOnce(Return(ByMove(std::move(saturated))))
+      .WillOnce(Return(ByMove(std::move(query_executor))));
+
+  iroha::protocol::QueryResponse response;
+  auto stat = torii_utils::QuerySyncClient(ip, port).Find(
+      model_query.getTransport(), response);
+  EXPECT_EQ(stat.error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+
+  stat = torii_utils::QuerySyncClient(ip, port).Find(
+      model_query.getTransport(), response);
+  ASSERT_TRUE(stat.ok());
+  shared_model::proto::QueryResponse resp{
+      iroha::protocol::QueryResponse{response}};
+  EXPECT_TRUE(boost::apply_visitor(
+      shared_model::interface::QueryErrorResponseChecker<
+          shared_model::interface::StatefulFailedErrorResponse>(),
+      resp.get()));
+}
@@ -6,6 +6,8 @@
 #include "torii/impl/command_service_transport_grpc.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <iterator>
 #include <string>
 #include <utility>
@@ -24,7 +26,6 @@
 #include "module/irohad/torii/torii_mocks.hpp"
 #include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
 #include "module/shared_model/validators/validators.hpp"
-#include "module/vendor/grpc_mocks.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "validators/protobuf/proto_transaction_validator.hpp"
 
@@ -32,6 +33,7 @@ using ::testing::_;
 using ::testing::A;
 using ::testing::AtLeast;
 using ::testing::Invoke;
+using ::testing::InvokeWithoutArgs;
 using ::testing::Property;
 using ::testing::Return;
 using ::testing::StrEq;
@@ -216,7 +218,8 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
     request.add_transactions();
   }
 
-  size_t counter = 0;
+  // transactions are validated concurrently
+  std::atomic<size_t> counter{0};
   EXPECT_CALL(*proto_tx_validator, validate(_))
       .Times(kTimes)
       .WillRepeatedly(Return(std::nullopt));
@@ -250,30 +253,36 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
 /**
  * @given torii service and command_service with empty status stream
  * @when calling StatusStream on transport
- * @then Ok status is eventually returned without any fault
+ * @then the stream is finished with Ok status
  *       and nothing is written to the status stream
  */
 TEST_F(CommandServiceTransportGrpcTest, StatusStreamEmpty) {
-  grpc::ServerContext context;
   iroha::protocol::TxStatusRequest request;
+  auto stream = std::make_shared<
+      iroha::network::MockServerStream<iroha::protocol::ToriiResponse>>();
 
   EXPECT_CALL(*command_service, getStatusStream(_))
       .WillOnce(Return(rxcpp::observable<>::empty<std::shared_ptr<
                            shared_model::interface::TransactionResponse>>()));
+  EXPECT_CALL(*stream, write(_)).Times(0);
+  std::promise<void> finished;
+  EXPECT_CALL(*stream, finish(Property(&grpc::Status::ok, true)))
+      .WillOnce(InvokeWithoutArgs([&finished] { finished.set_value(); }));
 
-  ASSERT_TRUE(transport_grpc->StatusStream(&context, &request, nullptr).ok());
+  transport_grpc->statusStream(request, stream);
+  ASSERT_EQ(finished.get_future().wait_for(5s), std::future_status::ready);
 }
 
 /**
  * @given torii service with changed timeout, a transaction
  *        and a status stream with one NotRecieved status
  * @when calling StatusStream
- * @then ServerWriter calls Write method
+ * @then the status is written to the stream, and the stream is finished
  */
 TEST_F(CommandServiceTransportGrpcTest, StatusStreamOnNotReceived) {
-  grpc::ServerContext context;
   iroha::protocol::TxStatusRequest request;
-  iroha::MockServerWriter<iroha::protocol::ToriiResponse> response_writer;
+  auto stream = std::make_shared<
+      iroha::network::MockServerStream<iroha::protocol::ToriiResponse>>();
 
   std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
       responses;
@@ -281,18 +290,43 @@ TEST_F(CommandServiceTransportGrpcTest, StatusStreamOnNotReceived) {
   responses.emplace_back(status_factory->makeNotReceived(hash, {}));
   EXPECT_CALL(*command_service, getStatusStream(_))
       .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
-  EXPECT_CALL(response_writer,
-              Write(Property(&iroha::protocol::ToriiResponse::tx_hash,
-                             StrEq(hash.hex())),
-                    _))
+  EXPECT_CALL(*stream,
+              write(Property(&iroha::protocol::ToriiResponse::tx_hash,
+                             StrEq(hash.hex()))))
       .WillOnce(Return(true));
+  std::promise<void> finished;
+  EXPECT_CALL(*stream, finish(Property(&grpc::Status::ok, true)))
+      .WillOnce(InvokeWithoutArgs([&finished] { finished.set_value(); }));
+
+  transport_grpc->statusStream(request, stream);
+  ASSERT_EQ(finished.get_future().wait_for(5s), std::future_status::ready);
+}
+
+/**
+ * @given torii service and command_service which blocks while looking up the
+ *        initial status of the transaction
+ * @when calling StatusStream on transport
+ * @then the call returns before the status is looked up
+ * @and the stream is finished when the lookup completes
+ */
+TEST_F(CommandServiceTransportGrpcTest, StatusStreamDoesNotBlockOnLookup) {
+  iroha::protocol::TxStatusRequest request;
+  auto stream = std::make_shared<
+      iroha::network::MockServerStream<iroha::protocol::ToriiResponse>>();
+
+  std::promise<void> lookup_allowed;
+  auto lookup = lookup_allowed.get_future().share();
+  EXPECT_CALL(*command_service, getStatusStream(_))
+      .WillOnce(InvokeWithoutArgs([lookup] {
+        lookup.wait();
+        return rxcpp::observable<>::empty<
+            std::shared_ptr<shared_model::interface::TransactionResponse>>();
+      }));
+  std::promise<void> finished;
+  EXPECT_CALL(*stream, finish(Property(&grpc::Status::ok, true)))
+      .WillOnce(InvokeWithoutArgs([&finished] { finished.set_value(); }));
 
-  ASSERT_TRUE(transport_grpc
-                  ->StatusStream(
-                      &context,
-                      &request,
-                      reinterpret_cast<
-                          grpc::ServerWriter<iroha::protocol::ToriiResponse> *>(
-                          &response_writer))
-                  .ok());
+  transport_grpc->statusStream(request, stream);
+  lookup_allowed.set_value();
+  ASSERT_EQ(finished.get_future().wait_for(5s), std::future_status::ready);
 }
@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cache/sharded_cache.hpp"
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+
+using iroha::cache::ShardedCache;
+
+/**
+ * @given initialized cache
+ * @when items are inserted and looked up
+ * @then inserted items are found @and hits and misses are counted
+ */
+TEST(ShardedCacheTest, FindValues) {
+  ShardedCache<std::string, int> cache;
+  for (int i = 0; i < 5; ++i) {
+    cache.addItem(std::to_string(i), i);
+  }
+  ASSERT_EQ(cache.getCacheItemCount(), 5);
+  ASSERT_EQ(cache.findItem("2"), 2);
+  ASSERT_EQ(cache.findItem("7"), boost::none);
+  ASSERT_EQ(cache.getHits(), 1);
+  ASSERT_EQ(cache.getMisses(), 1);
+}
+
+/**
+ * @given initialized cache
+ * @when an item with an existing key is inserted
+ * @then the value is updated @and amount of items does not change
+ */
+TEST(ShardedCacheTest, InsertSameKey) {
+  ShardedCache<std::string, int> cache;
+  cache.addItem("key", 1);
+  cache.addItem("key", 2);
+  ASSERT_EQ(cache.getCacheItemCount(), 1);
+  ASSERT_EQ(cache.findItem("key"), 2);
+}
+
+/// Hasher which maps every key to the same value
+struct CollidingHasher {
+  std::size_t operator()(const std::string &) const {
+    return 0;
+  }
+};
+
+/**
+ * @given cache with keys which have the same hash
+ * @when both keys are inserted
+ * @then each key is mapped to its own value
+ */
+TEST(ShardedCacheTest, CollidingKeys) {
+  ShardedCache<std::string, int, CollidingHasher> cache;
+  cache.addItem("a", 1);
+  cache.addItem("b", 2);
+  ASSERT_EQ(cache.findItem("a"), 1);
+  ASSERT_EQ(cache.findItem("b"), 2);
+}
+
+/**
+ * @given cache of a single shard with capacity 2
+ * @when 3 items are inserted
+ * @then the oldest item is evicted
+ */
+TEST(ShardedCacheTest, OldestEvicted) {
+  ShardedCache<std::string, int> cache(2, 1);
+  ASSERT_EQ(cache.getIndexSizeHigh(), 2);
+  cache.addItem("a", 1);
+  cache.addItem("b", 2);
+  cache.addItem("a", 3);
+  cache.addItem("c", 4);
+  ASSERT_EQ(cache.getCacheItemCount(), 2);
+  ASSERT_EQ(cache.findItem("a"), boost::none);
+  ASSERT_EQ(cache.findItem("b"), 2);
+  ASSERT_EQ(cache.findItem("c"), 4);
+}
+
+/**
+ * @given cache with runtime capacity
+ * @when more items than capacity are inserted
+ * @then amount of items does not exceed the capacity
+ */
+TEST(ShardedCacheTest, CapacityRespected) {
+  ShardedCache<std::string, int> cache(64);
+  for (int i = 0; i < 1000; ++i) {
+    cache.addItem(std::to_string(i), i);
+  }
+  ASSERT_EQ(cache.getIndexSizeHigh(), 64);
+  ASSERT_LE(cache.getCacheItemCount(), cache.getIndexSizeHigh());
+  ASSERT_EQ(cache.findItem("999"), 999);
+}
+
+/**
+ * @given initialized cache
+ * @when items are inserted and looked up from several threads
+ * @then every lookup is counted either as a hit or as a miss
+ */
+TEST(ShardedCacheTest, ConcurrentAccess) {
+  ShardedCache<std::string, int> cache(128);
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&cache, t] {
+      for (int i = 0; i < kIterations; ++i) {
+        cache.addItem(std::to_string(t * kIterations + i), i);
+        cache.findItem(std::to_string(i));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(cache.getHits() + cache.getMisses(), kThreads * kIterations);
+  ASSERT_LE(cache.getCacheItemCount(), cache.getIndexSizeHigh());
+}
@@ -102,3 +102,54 @@ TEST(ProtoTransaction, BuilderWithInvalidTx) {
                    .build(),
                std::invalid_argument);
 }
+
+/**
+ * @given transaction with a command and a batch meta
+ * @when its blobs are requested
+ * @then they are equal to serializations of the corresponding transport
+ * messages
+ */
+TEST(ProtoTransaction, BlobsMatchTransport) {
+  iroha::protocol::Transaction proto_tx = generateEmptyTransaction();
+  proto_tx.mutable_payload()
+      ->mutable_reduced_payload()
+      ->add_commands()
+      ->mutable_add_asset_quantity()
+      ->CopyFrom(generateAddAssetQuantity("coin#test"));
+  proto_tx.mutable_payload()->mutable_batch()->add_reduced_hashes("hash");
+
+  shared_model::proto::Transaction tx(proto_tx);
+
+  EXPECT_EQ(tx.blob(),
+            shared_model::crypto::Blob(proto_tx.SerializeAsString()));
+  EXPECT_EQ(tx.payload(),
+            shared_model::crypto::Blob(proto_tx.payload().SerializeAsString()));
+  EXPECT_EQ(tx.reducedPayload(),
+            shared_model::crypto::Blob(
+                proto_tx.payload().reduced_payload().SerializeAsString()));
+}
+
+/**
+ * @given transaction with its blob and hash already calculated
+ * @when a signature is added
+ * @then the blob includes the signature, and the hash stays the same
+ */
+TEST(ProtoTransaction, AddSignatureUpdatesBlob) {
+  shared_model::proto::Transaction tx(generateEmptyTransaction());
+  auto hash = tx.hash();
+  auto blob = tx.blob();
+
+  auto keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto signature =
+      shared_model::crypto::CryptoSigner::sign(tx.payload(), keypair);
+  using namespace shared_model::interface::types;
+  ASSERT_TRUE(tx.addSignature(SignedHexStringView{signature},
+                              PublicKeyHexStringView{keypair.publicKey()}));
+
+  EXPECT_NE(tx.blob(), blob);
+  EXPECT_EQ(tx.blob(),
+            shared_model::crypto::Blob(tx.getTransport().SerializeAsString()));
+  EXPECT_EQ(tx.hash(), hash);
+  EXPECT_EQ(boost::size(tx.signatures()), 1);
+}
@@ -126,6 +126,27 @@ TYPED_TEST(CryptoUsageTest, RawSignAndVerifyTest) {
   IROHA_ASSERT_RESULT_VALUE(verified);
 }
 
+/**
+ * @given Initialized keypair with _concrete_ algorithm
+ * @when sign data and verify the raw bytes of the signature and the key
+ * @then the signature is valid, and it is not valid for other data
+ */
+TYPED_TEST(CryptoUsageTest, RawBytesSignAndVerifyTest) {
+  auto signature = iroha::hexstringToBytestringResult(
+                       CryptoSigner::sign(this->data, this->keypair))
+                       .assumeValue();
+  auto public_key =
+      iroha::hexstringToBytestringResult(this->keypair.publicKey())
+          .assumeValue();
+  using namespace shared_model::interface::types;
+  const SignatureByteRangeView signature_bytes{makeByteRange(signature)};
+  const PublicKeyByteRangeView public_key_bytes{makeByteRange(public_key)};
+  IROHA_ASSERT_RESULT_VALUE(
+      CryptoVerifier::verify(signature_bytes, this->data, public_key_bytes));
+  IROHA_ASSERT_RESULT_ERROR(CryptoVerifier::verify(
+      signature_bytes, Blob("other data"), public_key_bytes));
+}
+
 /**
  * @given unsigned block
  * @when verify block
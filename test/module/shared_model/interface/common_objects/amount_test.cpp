@@ -5,7 +5,9 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
+#include <limits>
 #include <sstream>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -60,3 +62,53 @@ TEST_F(AmountTest, Invalid) {
   checkInvalid(Amount{"."});
   checkInvalid(Amount{""});
 }
+
+/**
+ * @given amounts with the greatest value and with the greatest precision
+ * @when they are parsed and formatted
+ * @then the string representation is preserved
+ */
+TEST_F(AmountTest, Limits) {
+  const std::string max_value{
+      "115792089237316195423570985008687907853269984665640564039457584007913129"
+      "639935"};
+  checkValid(Amount{max_value}, 1, 0, max_value);
+  EXPECT_EQ(Amount{max_value}.value(),
+            std::numeric_limits<boost::multiprecision::uint256_t>::max());
+  checkValid(Amount{"1157920892373161954235709850086879078532699846656405640394"
+                    ".57584007913129639935"},
+             1,
+             20,
+             "1157920892373161954235709850086879078532699846656405640394"
+             ".57584007913129639935");
+
+  const std::string max_precision = "0." + std::string(254, '0') + "1";
+  checkValid(Amount{max_precision}, 1, 255, max_precision);
+}
+
+/**
+ * @given amounts which do not fit the 256-bit value or the precision
+ * @when they are parsed
+ * @then they are invalid
+ */
+TEST_F(AmountTest, Overflow) {
+  checkInvalid(Amount{
+      "115792089237316195423570985008687907853269984665640564039457584007913129"
+      "639936"});
+  checkInvalid(
+      Amount{"1157920892373161954235709850086879078532699846656405640394"
+             ".57584007913129639936"});
+  checkInvalid(Amount{"0." + std::string(256, '1')});
+}
+
+/**
+ * @given amounts with the same value
+ * @when they are compared
+ * @then they are equal only if the precision is the same
+ */
+TEST_F(AmountTest, Equality) {
+  EXPECT_EQ(Amount{"0012.30"}, Amount{"12.30"});
+  EXPECT_EQ(Amount{"12.30"}.value(), 1230);
+  EXPECT_NE(Amount{"12.30"}, Amount{"12.3"});
+  EXPECT_NE(Amount{"1230"}, Amount{"12.30"});
+}
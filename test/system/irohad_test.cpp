@@ -504,6 +504,35 @@ TEST_F(IrohadTest, SendTxSecure) {
   sendDefaultTxAndCheck(std::move(key_pair).assumeValue(), true);
 }
 
+/**
+ * Test verifies that the asynchronously served status stream works through
+ * both the plain and the TLS ports of the same Torii
+ * @given running Iroha with an open TLS port
+ * @when a client sends a transaction through the TLS port AND follows its
+ *       status stream through each of the ports
+ * @then both streams end with the COMMITTED status
+ */
+TEST_F(IrohadTest, StatusStreamSecureAndInsecure) {
+  launchIroha();
+
+  auto key_pair = keys_manager_admin_.loadKeys(boost::none);
+  IROHA_ASSERT_RESULT_VALUE(key_pair);
+
+  auto tx = createDefaultTx(std::move(key_pair).assumeValue());
+  iroha::protocol::TxStatusRequest tx_request;
+  tx_request.set_tx_hash(tx.hash().hex());
+  ASSERT_TRUE(createToriiClient(true).Torii(tx.getTransport()).ok());
+
+  for (bool enable_tls : {true, false}) {
+    SCOPED_TRACE(enable_tls ? "TLS port" : "plain port");
+    std::vector<iroha::protocol::ToriiResponse> responses;
+    createToriiClient(enable_tls).StatusStream(tx_request, responses);
+    ASSERT_FALSE(responses.empty());
+    EXPECT_EQ(responses.back().tx_status(),
+              iroha::protocol::TxStatus::COMMITTED);
+  }
+}
+
 /**
  * Test verifies that you could not connect to the TLS port and send plaintext
  * data. (well you surely can, but it will not be processed)